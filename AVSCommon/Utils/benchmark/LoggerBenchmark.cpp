@@ -0,0 +1,352 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Measures the cost of logging, from building a @c LogEntry to writing it out through @c ConsoleLogger, so that
+ * changes to @c LogEntry, @c LogEntryBuffer, @c LogStringFormatter or the sinks can be compared between releases:
+ *
+ * - @c entry: building an entry with 0, 4 and 16 metadata fields, and building and rendering it.
+ * - @c escape: adding a 64 byte and a 1KB metadata value in which every eighth character must be escaped.
+ * - @c format: formatting the text of an entry in to a line with @c LogStringFormatter.
+ * - @c acsdkInfo: @c ACSDK_INFO through the module logger to @c ConsoleLogger, with 1 to 32 threads logging at once.
+ * - @c acsdkInfoRejected: @c ACSDK_INFO when the level of the module rejects it.
+ *
+ * Each case that depends on @c LogEntry::CaptureMode is measured in both modes.  Standard output is redirected to
+ * @c /dev/null while the cases run, so that the console sink does not measure a terminal, and the results are
+ * written to the original standard output as JSON, for example:
+ *
+ *     {"benchmark":"LoggerBenchmark","iterations":200000,"hardwareConcurrency":4,"results":[
+ *         {"name":"entry.build","variant":"text","size":4,"threads":1,"nsPerOp":182.4,"opsPerSecond":5482456.1},
+ *         ...]}
+ *
+ * A table of the results is printed to standard error as the cases run.
+ *
+ * Usage: LoggerBenchmark [iterations] > results.json
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/JSON/JSONGenerator.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+
+using namespace alexaClientSDK::avsCommon::utils;
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LoggerBenchmark");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) LogEntry(TAG, event)
+
+/// Default number of operations in each case, shared between its threads.
+static const long DEFAULT_ITERATIONS = 200000;
+
+/// The field counts to measure.
+static const int FIELD_COUNTS[] = {0, 4, 16};
+
+/// The thread counts to measure.
+static const int THREAD_COUNTS[] = {1, 2, 4, 8, 16, 32};
+
+/// Keys of the fields added to entries.  String literals, as keys must outlive entries in binary capture mode.
+static const char* const FIELD_KEYS[] = {"id",
+                                         "name",
+                                         "connected",
+                                         "rssi",
+                                         "address",
+                                         "profile",
+                                         "volume",
+                                         "muted",
+                                         "state",
+                                         "reason",
+                                         "offsetMs",
+                                         "sequence",
+                                         "dialogId",
+                                         "attempts",
+                                         "latency",
+                                         "result"};
+
+/// The capture modes to measure, and their names in the results.
+static const struct {
+    const char* name;
+    LogEntry::CaptureMode mode;
+} CAPTURE_MODES[] = {{"text", LogEntry::CaptureMode::TEXT}, {"binary", LogEntry::CaptureMode::BINARY}};
+
+/// The result of a case.
+struct Result {
+    /// The name of the case.
+    std::string name;
+
+    /// The variant of the case, such as the capture mode.
+    std::string variant;
+
+    /// The number of metadata fields or bytes the case logs, or zero.
+    int size;
+
+    /// The number of threads that ran the case.
+    int threads;
+
+    /// The wall time per operation, in nanoseconds.
+    double nsPerOp;
+
+    /// The number of operations per second, across all threads.
+    double opsPerSecond;
+};
+
+/// The results of the cases that have run.
+static std::vector<Result> g_results;
+
+/**
+ * Add fields to an entry.
+ *
+ * @param entry The entry.
+ * @param fieldCount The number of fields to add, up to 16.
+ * @param ix The index of the operation, so that values vary.
+ * @return @c entry.
+ */
+static LogEntry& addFields(LogEntry& entry, int fieldCount, long ix) {
+    for (int field = 0; field < fieldCount; field++) {
+        auto key = FIELD_KEYS[field];
+        switch (field % 4) {
+            case 0:
+                entry.d(key, ix + field);
+                break;
+            case 1:
+                entry.d(key, "Living Room Speaker");
+                break;
+            case 2:
+                entry.d(key, 0 == (ix & 1));
+                break;
+            case 3:
+                entry.d(key, -67.5 + field);
+                break;
+        }
+    }
+    return entry;
+}
+
+/**
+ * Time a case on one or more threads, report the result and add it to @c g_results.
+ *
+ * @param name The name of the case.
+ * @param variant The variant of the case.
+ * @param size The number of metadata fields or bytes the case logs, or zero.
+ * @param threadCount The number of threads to run the case on.
+ * @param iterations The number of operations, shared between the threads.
+ * @param run The operation, given its index.  Returns a value that is accumulated so it cannot be optimized away.
+ */
+template <typename Run>
+static void measure(
+    const char* name,
+    const char* variant,
+    int size,
+    int threadCount,
+    long iterations,
+    Run run) {
+    auto perThread = std::max(iterations / threadCount, 1L);
+    std::atomic<int> readyCount{0};
+    std::atomic<bool> go{false};
+    std::atomic<size_t> checksum{0};
+    auto body = [&]() {
+        size_t sum = 0;
+        readyCount++;
+        while (!go) {
+            std::this_thread::yield();
+        }
+        for (long ix = 0; ix < perThread; ix++) {
+            sum += run(ix);
+        }
+        checksum += sum;
+    };
+
+    std::vector<std::thread> threads;
+    for (int ix = 1; ix < threadCount; ix++) {
+        threads.emplace_back(body);
+    }
+    while (readyCount < threadCount - 1) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    body();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto operations = static_cast<double>(perThread) * threadCount;
+    Result result{name, variant, size, threadCount, elapsed * 1e9 / operations, operations / elapsed};
+    fprintf(
+        stderr,
+        "%-18s %-7s %5d %7d %10.1f %14.0f   (checksum %zu)\n",
+        name,
+        variant,
+        size,
+        threadCount,
+        result.nsPerOp,
+        result.opsPerSecond,
+        checksum.load());
+    g_results.push_back(result);
+}
+
+/**
+ * Build a metadata value in which every eighth character must be escaped.
+ *
+ * @param size The length of the value.
+ * @return The value.
+ */
+static std::string buildEscapedValue(size_t size) {
+    static const char RESERVED[] = {',', '=', ':', '\\'};
+    std::string value(size, 'x');
+    for (size_t ix = 7; ix < size; ix += 8) {
+        value[ix] = RESERVED[(ix / 8) % sizeof(RESERVED)];
+    }
+    return value;
+}
+
+/**
+ * Write the results as JSON.
+ *
+ * @param fd The file descriptor to write to.
+ * @param iterations The number of operations in each case.
+ * @return Whether the results were written.
+ */
+static bool writeResults(int fd, long iterations) {
+    json::JsonGenerator generator;
+    generator.addMember("benchmark", "LoggerBenchmark");
+    generator.addMember("iterations", static_cast<int64_t>(iterations));
+    generator.addMember("hardwareConcurrency", std::thread::hardware_concurrency());
+    generator.startArray("results");
+    for (const auto& result : g_results) {
+        generator.startArrayElement();
+        generator.addMember("name", result.name);
+        generator.addMember("variant", result.variant);
+        generator.addMember("size", result.size);
+        generator.addMember("threads", result.threads);
+        generator.addMember("nsPerOp", result.nsPerOp);
+        generator.addMember("opsPerSecond", result.opsPerSecond);
+        generator.finishArrayElement();
+    }
+    generator.finishArray();
+    auto text = generator.toString() + "\n";
+    return write(fd, text.data(), text.size()) == static_cast<ssize_t>(text.size());
+}
+
+int main(int argc, char** argv) {
+    long iterations = DEFAULT_ITERATIONS;
+    if (argc > 1) {
+        iterations = std::atol(argv[1]);
+        if (iterations <= 0) {
+            fprintf(stderr, "usage: %s [iterations] > results.json\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Keep the original standard output for the results, and send what the console sink writes to /dev/null.
+    fflush(stdout);
+    int resultsFd = dup(STDOUT_FILENO);
+    int nullFd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    if (resultsFd < 0 || nullFd < 0 || dup2(nullFd, STDOUT_FILENO) < 0) {
+        perror("redirecting standard output");
+        return EXIT_FAILURE;
+    }
+    close(nullFd);
+
+    fprintf(stderr, "%-18s %-7s %5s %7s %10s %14s\n", "case", "variant", "size", "threads", "ns/op", "ops/s");
+    for (const auto& captureMode : CAPTURE_MODES) {
+        LogEntry::setCaptureMode(captureMode.mode);
+        for (auto fieldCount : FIELD_COUNTS) {
+            measure("entry.build", captureMode.name, fieldCount, 1, iterations, [fieldCount](long ix) {
+                LogEntry entry(TAG, "event");
+                addFields(entry, fieldCount, ix);
+                return static_cast<size_t>(1);
+            });
+            measure("entry.render", captureMode.name, fieldCount, 1, iterations, [fieldCount](long ix) {
+                LogEntry entry(TAG, "event");
+                return strlen(addFields(entry, fieldCount, ix).c_str());
+            });
+        }
+    }
+    LogEntry::setCaptureMode(LogEntry::CaptureMode::TEXT);
+
+    for (size_t size : {64, 1024}) {
+        auto value = buildEscapedValue(size);
+        measure("escape", "text", static_cast<int>(size), 1, iterations, [&value](long) {
+            return strlen(LogEntry(TAG, "event").d("value", value).c_str());
+        });
+    }
+
+    LogStringFormatter formatter;
+    LogEntry entry(TAG, "deviceConnected");
+    std::string text = addFields(entry, 4, 0).c_str();
+    auto moniker = ThreadMoniker::getThisThreadMonikerCString();
+    auto now = std::chrono::system_clock::now();
+    measure("format", "text", 4, 1, iterations, [&](long ix) {
+        // Reused as the sinks reuse their buffers.
+        static thread_local std::string line;
+        line.clear();
+        formatter.format(Level::INFO, now + std::chrono::milliseconds(ix), moniker, text.c_str(), &line);
+        return line.size();
+    });
+
+    for (const auto& captureMode : CAPTURE_MODES) {
+        LogEntry::setCaptureMode(captureMode.mode);
+        for (auto threadCount : THREAD_COUNTS) {
+            measure("acsdkInfo", captureMode.name, 4, threadCount, iterations, [](long ix) {
+                ACSDK_INFO(LX("deviceConnected")
+                               .d("id", ix)
+                               .d("name", "Living Room Speaker")
+                               .d("connected", true)
+                               .d("rssi", -67.5));
+                return static_cast<size_t>(1);
+            });
+        }
+    }
+    LogEntry::setCaptureMode(LogEntry::CaptureMode::TEXT);
+
+    // Raise the level of the module above INFO, then return it to the level of the sink.
+    ACSDK_GET_LOGGER_FUNCTION().setLevel(Level::WARN);
+    measure("acsdkInfoRejected", "text", 4, 1, iterations, [](long ix) {
+        ACSDK_INFO(LX("deviceConnected")
+                       .d("id", ix)
+                       .d("name", "Living Room Speaker")
+                       .d("connected", true)
+                       .d("rssi", -67.5));
+        return static_cast<size_t>(1);
+    });
+    ACSDK_GET_LOGGER_FUNCTION().setLevel(Level::UNKNOWN);
+
+    if (!writeResults(resultsFd, iterations)) {
+        perror("writing results");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Measures escaping of log entry metadata values of the sizes and shapes logged by the BlueZ implementation:
+ * D-Bus object paths, property change dictionaries, GetManagedObjects dumps and JSON bodies.  The previous
+ * strlen()/strpbrk() implementation is compared with each @c MetadataEscaper supported by the CPU, and with
+ * @c LogEntry::d() itself.
+ *
+ * Usage: MetadataEscapingBenchmark [iterations]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/LogEntryStream.h"
+#include "AVSCommon/Utils/Logger/MetadataEscaping.h"
+
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+/// Default number of times each payload is escaped.
+static const long DEFAULT_ITERATIONS = 200000;
+
+/// A D-Bus object path, as logged for most BlueZ device events.
+static const std::string OBJECT_PATH = "/org/bluez/hci0/dev_AA_BB_CC_DD_EE_FF";
+
+/// A GVariant rendering of a PropertiesChanged dictionary.
+static const std::string PROPERTIES_CHANGED =
+    "('org.bluez.Device1', {'Connected': <true>, 'ServicesResolved': <true>, 'RSSI': <int16 -67>, "
+    "'Address': <'AA:BB:CC:DD:EE:FF'>, 'Alias': <'Living Room Speaker'>, 'Class': <uint32 2360340>, "
+    "'UUIDs': <['0000110a-0000-1000-8000-00805f9b34fb', '0000110b-0000-1000-8000-00805f9b34fb']>}, @as [])";
+
+/**
+ * Build a GVariant rendering of a GetManagedObjects reply.
+ *
+ * @param deviceCount The number of devices in the reply.
+ * @return The rendering.
+ */
+static std::string buildManagedObjects(int deviceCount) {
+    std::string result = "({";
+    for (int ix = 0; ix < deviceCount; ix++) {
+        char address[32];
+        snprintf(address, sizeof(address), "AA:BB:CC:DD:EE:%02X", ix);
+        std::string path = "/org/bluez/hci0/dev_" + std::string(address);
+        for (auto& c : path) {
+            if (':' == c) {
+                c = '_';
+            }
+        }
+        result += "objectpath '" + path + "': {'org.bluez.Device1': {'Address': <'" + address +
+                  "'>, 'AddressType': <'public'>, 'Name': <'Device " + std::to_string(ix) +
+                  "'>, 'Paired': <true>, 'Trusted': <true>, 'Blocked': <false>, 'LegacyPairing': <false>, "
+                  "'Connected': <false>, 'Adapter': <objectpath '/org/bluez/hci0'>}}, ";
+    }
+    result += "},)";
+    return result;
+}
+
+/**
+ * Build a JSON body similar to an AVS directive payload.
+ *
+ * @param size The approximate size of the body.
+ * @return The body.
+ */
+static std::string buildJsonBody(size_t size) {
+    std::string result = "{\"directive\":{\"header\":{\"namespace\":\"Bluetooth\",\"name\":\"ScanDevices\","
+                         "\"messageId\":\"6f2b8f5e-7c2a-4a57-9d0b-1b9e3c0c2f11\"},\"payload\":{\"devices\":[";
+    while (result.size() < size) {
+        result += "{\"uniqueDeviceId\":\"a1b2c3d4-0000-1000-8000-00805f9b34fb\",\"friendlyName\":\"Speaker\","
+                  "\"truncatedMacAddress\":\"XX:XX:XX:XX:EE:FF\",\"metadata\":{\"vendorId\":76,\"productId\":8202}},";
+    }
+    result += "]}}}";
+    return result;
+}
+
+/**
+ * The previous implementation of @c LogEntry::appendEscapedString(), used as the baseline.
+ *
+ * @param stream The stream to append to.
+ * @param in The string to escape and append.
+ */
+static void appendEscapedStringStrpbrk(LogEntryStream& stream, const char* in) {
+    auto pos = in;
+    auto maxCount = strlen(in);
+    while (maxCount-- > 0 && *pos != 0) {
+        auto next = strpbrk(pos, R"(\,=:)");
+        if (next) {
+            stream.write(pos, next - pos);
+            stream << '\\' << *next;
+            pos = next + 1;
+        } else {
+            stream << pos;
+            return;
+        }
+    }
+}
+
+/// Number of characters escaped at a time, as in @c LogEntry::appendEscapedString().
+static const size_t ESCAPE_BLOCK_SIZE = 256;
+
+/**
+ * Escape a string with a specific @c MetadataEscaper, as @c LogEntry::appendEscapedString() does.
+ *
+ * @param escaper The escaper to use.
+ * @param stream The stream to append to.
+ * @param in The string to escape and append.
+ */
+static void appendEscapedStringEscaper(MetadataEscaper escaper, LogEntryStream& stream, const char* in) {
+    auto remaining = strlen(in);
+    char escaped[2 * ESCAPE_BLOCK_SIZE];
+    while (remaining > 0) {
+        auto blockSize = std::min(remaining, ESCAPE_BLOCK_SIZE);
+        stream.write(escaped, escapeMetadata(escaper, in, blockSize, escaped));
+        in += blockSize;
+        remaining -= blockSize;
+    }
+}
+
+/**
+ * Time a case and report the result.
+ *
+ * @param name The name of the case.
+ * @param payload The payload being escaped.
+ * @param iterations The number of times to run the case.
+ * @param run The case.  Returns the length of its output, which is accumulated so it cannot be optimized away.
+ */
+template <typename Run>
+static void measure(const char* name, const std::string& payload, long iterations, Run run) {
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long ix = 0; ix < iterations; ix++) {
+        checksum += run(payload.c_str());
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf(
+        "  %-10s %10.1f ns/op %10.1f MB/s   (checksum %zu)\n",
+        name,
+        elapsed * 1e9 / iterations,
+        payload.size() * iterations / elapsed / 1e6,
+        checksum);
+}
+
+int main(int argc, char** argv) {
+    long iterations = DEFAULT_ITERATIONS;
+    if (argc > 1) {
+        iterations = std::atol(argv[1]);
+        if (iterations <= 0) {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    struct Payload {
+        const char* name;
+        std::string text;
+    };
+    const std::vector<Payload> payloads = {{"object path", OBJECT_PATH},
+                                           {"properties changed", PROPERTIES_CHANGED},
+                                           {"managed objects (8 devices)", buildManagedObjects(8)},
+                                           {"json body (4KB)", buildJsonBody(4096)},
+                                           {"clean text (1KB)", std::string(1024, 'x')}};
+    const struct {
+        const char* name;
+        MetadataEscaper escaper;
+    } escapers[] = {{"scalar", MetadataEscaper::SCALAR},
+                    {"sse2", MetadataEscaper::SSE2},
+                    {"avx2", MetadataEscaper::AVX2}};
+
+    bool outputsMatch = true;
+    for (auto& payload : payloads) {
+        printf("%s: %zu bytes\n", payload.name, payload.text.size());
+        LogEntryStream expected;
+        appendEscapedStringStrpbrk(expected, payload.text.c_str());
+        measure("strpbrk", payload.text, iterations, [](const char* in) {
+            LogEntryStream stream;
+            appendEscapedStringStrpbrk(stream, in);
+            return strlen(stream.c_str());
+        });
+        for (auto& escaper : escapers) {
+            if (!isMetadataEscaperSupported(escaper.escaper)) {
+                printf("  %-10s (not supported)\n", escaper.name);
+                continue;
+            }
+            LogEntryStream actual;
+            appendEscapedStringEscaper(escaper.escaper, actual, payload.text.c_str());
+            outputsMatch = outputsMatch && 0 == strcmp(expected.c_str(), actual.c_str());
+            measure(escaper.name, payload.text, iterations, [&](const char* in) {
+                LogEntryStream stream;
+                appendEscapedStringEscaper(escaper.escaper, stream, in);
+                return strlen(stream.c_str());
+            });
+        }
+        measure("LogEntry", payload.text, iterations, [](const char* in) {
+            return strlen(LogEntry("Benchmark", "event").d("value", in).c_str());
+        });
+    }
+    if (!outputsMatch) {
+        fprintf(stderr, "ERROR: escaped output differs between implementations\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
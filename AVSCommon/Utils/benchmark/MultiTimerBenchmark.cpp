@@ -0,0 +1,379 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Compares @c WheelMultiTimer with the ordered maps that @c MultiTimer keeps its tasks in:
+ *
+ * - @c submitCancel: submitting a task due in 1 to 60 seconds and cancelling another, with 1 to 100000 tasks pending,
+ *   which is how retry and timeout paths use a timer.
+ * - @c submitCancel with 4 threads: the same, with the threads sharing the timer.
+ * - @c submitFire: submitting tasks that are due at once and waiting for all of them to run.
+ *
+ * The map based timer is @c MapMultiTimer below, which keeps the same @c std::multimap and @c std::map as
+ * @c MultiTimer under one mutex and runs its tasks on a thread of its own, so that both timers are measured with the
+ * same thread and lock behaviour.  The results are written to standard output as JSON, for example:
+ *
+ *     {"benchmark":"MultiTimerBenchmark","iterations":200000,"hardwareConcurrency":4,"results":[
+ *         {"name":"submitCancel","variant":"wheel","size":10000,"threads":1,"nsPerOp":95.2,"opsPerSecond":10504201.7},
+ *         ...]}
+ *
+ * A table of the results is printed to standard error as the cases run.
+ *
+ * Usage: MultiTimerBenchmark [iterations] > results.json
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/JSON/JSONGenerator.h"
+#include "AVSCommon/Utils/Timing/WheelMultiTimer.h"
+
+using namespace alexaClientSDK::avsCommon::utils;
+using namespace alexaClientSDK::avsCommon::utils::timing;
+
+/// Default number of operations in each case, shared between its threads.
+static const long DEFAULT_ITERATIONS = 200000;
+
+/// The numbers of tasks to keep pending while submitting and cancelling.
+static const int PENDING_COUNTS[] = {1, 1000, 10000, 100000};
+
+/// The number of threads of the shared case.
+static const int SHARED_THREAD_COUNT = 4;
+
+/// The number of tasks pending in the shared case.
+static const int SHARED_PENDING_COUNT = 10000;
+
+/// The shortest delay of the tasks that are cancelled.
+static const std::chrono::milliseconds MIN_DELAY(1000);
+
+/// The number of different delays of the tasks that are cancelled, one millisecond apart.
+static const long DELAY_RANGE_MS = 59000;
+
+/// A timer that keeps its tasks in the same ordered maps as @c MultiTimer.
+class MapMultiTimer {
+public:
+    /// Alias for the token used to identify a task.
+    using Token = uint64_t;
+
+    /// Constructor.
+    MapMultiTimer() : m_isBeingDestroyed{false}, m_nextToken{0}, m_thread{&MapMultiTimer::timerLoop, this} {
+    }
+
+    /// Destructor.
+    ~MapMultiTimer() {
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_isBeingDestroyed = true;
+            m_waitCondition.notify_all();
+        }
+        m_thread.join();
+    }
+
+    /**
+     * Submit a task.
+     *
+     * @param delay The time to wait before calling the task.
+     * @param task The task.
+     * @return The token of the task.
+     */
+    Token submitTask(const std::chrono::milliseconds& delay, std::function<void()> task) {
+        auto time = std::chrono::steady_clock::now() + delay;
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        auto token = m_nextToken++;
+        auto wakeEarlier = m_timers.empty() || time < m_timers.begin()->first;
+        m_timers.insert({time, token});
+        m_tasks[token] = std::make_pair(time, std::move(task));
+        if (wakeEarlier) {
+            m_waitCondition.notify_one();
+        }
+        return token;
+    }
+
+    /**
+     * Cancel a task.
+     *
+     * @param token The token of the task.
+     */
+    void cancelTask(Token token) {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        auto task = m_tasks.find(token);
+        if (task == m_tasks.end()) {
+            return;
+        }
+        auto range = m_timers.equal_range(task->second.first);
+        for (auto timer = range.first; timer != range.second; ++timer) {
+            if (timer->second == token) {
+                m_timers.erase(timer);
+                break;
+            }
+        }
+        m_tasks.erase(task);
+    }
+
+private:
+    /// Alias for the time point used in this class.
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+    /// Run the tasks as they fall due.
+    void timerLoop() {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        while (!m_isBeingDestroyed) {
+            if (m_timers.empty()) {
+                m_waitCondition.wait(lock);
+                continue;
+            }
+            auto next = m_timers.begin();
+            if (next->first > std::chrono::steady_clock::now()) {
+                m_waitCondition.wait_until(lock, next->first);
+                continue;
+            }
+            auto task = m_tasks.find(next->second);
+            auto function = std::move(task->second.second);
+            m_tasks.erase(task);
+            m_timers.erase(next);
+            lock.unlock();
+            function();
+            lock.lock();
+        }
+    }
+
+    /// The condition variable used to wait for the next task.
+    std::condition_variable m_waitCondition;
+
+    /// The mutex for @c m_waitCondition.
+    std::mutex m_waitMutex;
+
+    /// A map of timers and the token used to identify the task to be run.
+    std::multimap<TimePoint, Token> m_timers;
+
+    /// A map of tasks to be run.
+    std::map<Token, std::pair<TimePoint, std::function<void()>>> m_tasks;
+
+    /// Flag indicating whether object is being destructed.
+    bool m_isBeingDestroyed;
+
+    /// The next token available.
+    Token m_nextToken;
+
+    /// The thread used to trigger tasks.
+    std::thread m_thread;
+};
+
+/// The result of a case.
+struct Result {
+    /// The name of the case.
+    std::string name;
+
+    /// The timer the case ran with.
+    std::string variant;
+
+    /// The number of tasks pending, or submitted at once, in the case.
+    int size;
+
+    /// The number of threads that ran the case.
+    int threads;
+
+    /// The wall time per operation, in nanoseconds.
+    double nsPerOp;
+
+    /// The number of operations per second, across all threads.
+    double opsPerSecond;
+};
+
+/// The results of the cases that have run.
+static std::vector<Result> g_results;
+
+/**
+ * Get the delay of a task that is cancelled before it falls due.
+ *
+ * @param ix The index of the operation, so that delays vary.
+ * @return The delay.
+ */
+static std::chrono::milliseconds getDelay(long ix) {
+    return MIN_DELAY + std::chrono::milliseconds((ix * 7919) % DELAY_RANGE_MS);
+}
+
+/**
+ * Report the result of a case and add it to @c g_results.
+ *
+ * @param name The name of the case.
+ * @param variant The timer the case ran with.
+ * @param size The number of tasks pending, or submitted at once, in the case.
+ * @param threadCount The number of threads that ran the case.
+ * @param operations The number of operations, across all threads.
+ * @param elapsed The wall time of the case, in seconds.
+ */
+static void report(const char* name, const char* variant, int size, int threadCount, long operations, double elapsed) {
+    Result result{name, variant, size, threadCount, elapsed * 1e9 / operations, operations / elapsed};
+    fprintf(
+        stderr,
+        "%-14s %-7s %7d %7d %10.1f %14.0f\n",
+        name,
+        variant,
+        size,
+        threadCount,
+        result.nsPerOp,
+        result.opsPerSecond);
+    g_results.push_back(result);
+}
+
+/**
+ * Time submitting a task and cancelling another, keeping a number of tasks pending on each thread.
+ *
+ * @tparam Timer @c WheelMultiTimer or @c MapMultiTimer.
+ * @param variant The name of the timer.
+ * @param pendingCount The number of tasks to keep pending, shared between the threads.
+ * @param threadCount The number of threads to run the case on.
+ * @param iterations The number of operations, shared between the threads.
+ */
+template <typename Timer>
+static void measureSubmitCancel(const char* variant, int pendingCount, int threadCount, long iterations) {
+    Timer timer;
+    auto perThread = std::max(iterations / threadCount, 1L);
+    auto pendingPerThread = std::max(pendingCount / threadCount, 1);
+
+    // Each operation cancels the task that was submitted pendingPerThread operations before it on the same thread.
+    std::vector<std::vector<typename Timer::Token>> tokens(threadCount);
+    for (int thread = 0; thread < threadCount; thread++) {
+        for (int ix = 0; ix < pendingPerThread; ix++) {
+            tokens[thread].push_back(timer.submitTask(getDelay(ix + thread), [] {}));
+        }
+    }
+
+    std::atomic<int> readyCount{0};
+    std::atomic<bool> go{false};
+    auto body = [&](int thread) {
+        auto& threadTokens = tokens[thread];
+        readyCount++;
+        while (!go) {
+            std::this_thread::yield();
+        }
+        for (long ix = 0; ix < perThread; ix++) {
+            auto& token = threadTokens[ix % pendingPerThread];
+            timer.cancelTask(token);
+            token = timer.submitTask(getDelay(ix), [] {});
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int ix = 1; ix < threadCount; ix++) {
+        threads.emplace_back(body, ix);
+    }
+    while (readyCount < threadCount - 1) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    body(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("submitCancel", variant, pendingCount, threadCount, perThread * threadCount, elapsed);
+}
+
+/**
+ * Time submitting tasks that are due at once and running all of them.
+ *
+ * @tparam Timer @c WheelMultiTimer or @c MapMultiTimer.
+ * @param variant The name of the timer.
+ * @param iterations The number of tasks.
+ */
+template <typename Timer>
+static void measureSubmitFire(const char* variant, long iterations) {
+    Timer timer;
+    std::mutex mutex;
+    std::condition_variable done;
+    long fired = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long ix = 0; ix < iterations; ix++) {
+        timer.submitTask(std::chrono::milliseconds(0), [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++fired == iterations) {
+                done.notify_one();
+            }
+        });
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return fired == iterations; });
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("submitFire", variant, static_cast<int>(iterations), 1, iterations, elapsed);
+}
+
+/**
+ * Write the results as JSON.
+ *
+ * @param iterations The number of operations in each case.
+ * @return Whether the results were written.
+ */
+static bool writeResults(long iterations) {
+    json::JsonGenerator generator;
+    generator.addMember("benchmark", "MultiTimerBenchmark");
+    generator.addMember("iterations", static_cast<int64_t>(iterations));
+    generator.addMember("hardwareConcurrency", std::thread::hardware_concurrency());
+    generator.startArray("results");
+    for (const auto& result : g_results) {
+        generator.startArrayElement();
+        generator.addMember("name", result.name);
+        generator.addMember("variant", result.variant);
+        generator.addMember("size", result.size);
+        generator.addMember("threads", result.threads);
+        generator.addMember("nsPerOp", result.nsPerOp);
+        generator.addMember("opsPerSecond", result.opsPerSecond);
+        generator.finishArrayElement();
+    }
+    generator.finishArray();
+    auto text = generator.toString() + "\n";
+    return write(STDOUT_FILENO, text.data(), text.size()) == static_cast<ssize_t>(text.size());
+}
+
+int main(int argc, char** argv) {
+    long iterations = DEFAULT_ITERATIONS;
+    if (argc > 1) {
+        iterations = std::atol(argv[1]);
+        if (iterations <= 0) {
+            fprintf(stderr, "usage: %s [iterations] > results.json\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf(stderr, "%-14s %-7s %7s %7s %10s %14s\n", "case", "variant", "size", "threads", "ns/op", "ops/s");
+    for (auto pendingCount : PENDING_COUNTS) {
+        measureSubmitCancel<MapMultiTimer>("map", pendingCount, 1, iterations);
+        measureSubmitCancel<WheelMultiTimer>("wheel", pendingCount, 1, iterations);
+    }
+    measureSubmitCancel<MapMultiTimer>("map", SHARED_PENDING_COUNT, SHARED_THREAD_COUNT, iterations);
+    measureSubmitCancel<WheelMultiTimer>("wheel", SHARED_PENDING_COUNT, SHARED_THREAD_COUNT, iterations);
+    measureSubmitFire<MapMultiTimer>("map", iterations);
+    measureSubmitFire<WheelMultiTimer>("wheel", iterations);
+
+    if (!writeResults(iterations)) {
+        perror("writing results");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
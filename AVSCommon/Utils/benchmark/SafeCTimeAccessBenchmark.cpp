@@ -0,0 +1,174 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Measures the throughput of @c SafeCTimeAccess::getGmtime() and @c SafeCTimeAccess::getLocaltime() with 1 to 16
+ * threads converting times concurrently, against the previous implementation which serialized calls to
+ * @c std::gmtime() and @c std::localtime() with a global mutex.
+ *
+ * Usage: SafeCTimeAccessBenchmark [iterationsPerThread]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Timing/SafeCTimeAccess.h"
+
+using namespace alexaClientSDK::avsCommon::utils::timing;
+
+/// Default number of conversions performed by each thread.
+static const long DEFAULT_ITERATIONS_PER_THREAD = 1000000;
+
+/// The thread counts to measure.
+static const int THREAD_COUNTS[] = {1, 2, 4, 8, 16};
+
+/// The previous implementation of @c SafeCTimeAccess, used as the baseline.
+class MutexCTimeAccess {
+public:
+    /**
+     * Call @c std::gmtime() with the global lock held.
+     *
+     * @param time The time since epoch to convert.
+     * @param[out] calendarTime The output in calendar time.
+     * @return true if successful, false otherwise.
+     */
+    bool getGmtime(const std::time_t& time, std::tm* calendarTime) {
+        return safeAccess(std::gmtime, time, calendarTime);
+    }
+
+    /**
+     * Call @c std::localtime() with the global lock held.
+     *
+     * @param time The time since epoch to convert.
+     * @param[out] calendarTime The output in calendar time.
+     * @return true if successful, false otherwise.
+     */
+    bool getLocaltime(const std::time_t& time, std::tm* calendarTime) {
+        return safeAccess(std::localtime, time, calendarTime);
+    }
+
+private:
+    /**
+     * Call a time conversion function with the global lock held.
+     *
+     * @param timeAccessFunction The function to call.
+     * @param time The time since epoch to convert.
+     * @param[out] calendarTime The output in calendar time.
+     * @return true if successful, false otherwise.
+     */
+    bool safeAccess(
+        std::tm* (*timeAccessFunction)(const std::time_t* time),
+        const std::time_t& time,
+        std::tm* calendarTime) {
+        std::lock_guard<std::mutex> lock{m_timeLock};
+        auto tempCalendarTime = timeAccessFunction(&time);
+        if (!tempCalendarTime) {
+            return false;
+        }
+        *calendarTime = *tempCalendarTime;
+        return true;
+    }
+
+    /// Mutex used to protect access to the ctime functions.
+    std::mutex m_timeLock;
+};
+
+/**
+ * Run @c convert on @c threadCount threads concurrently and report the throughput.
+ *
+ * @param name The name of the case being measured.
+ * @param threadCount The number of threads to run.
+ * @param iterations The number of conversions performed by each thread.
+ * @param convert The conversion to measure.
+ */
+template <typename Convert>
+static void measure(const char* name, int threadCount, long iterations, Convert convert) {
+    std::atomic<int> readyCount{0};
+    std::atomic<bool> go{false};
+    std::atomic<long> checksum{0};
+    std::vector<std::thread> threads;
+    for (int ix = 0; ix < threadCount; ix++) {
+        threads.emplace_back([&, ix] {
+            std::time_t time = std::time(nullptr) + ix * 86400;
+            long sum = 0;
+            readyCount++;
+            while (!go) {
+                std::this_thread::yield();
+            }
+            std::tm calendarTime;
+            for (long count = 0; count < iterations; count++) {
+                if (convert(time + count, &calendarTime)) {
+                    sum += calendarTime.tm_sec;
+                }
+            }
+            checksum += sum;
+        });
+    }
+    while (readyCount < threadCount) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto totalConversions = static_cast<double>(iterations) * threadCount;
+    printf(
+        "%-22s %7d %14.0f %12.1f   (checksum %ld)\n",
+        name,
+        threadCount,
+        totalConversions / elapsed,
+        elapsed * 1e9 / totalConversions,
+        checksum.load());
+}
+
+int main(int argc, char** argv) {
+    long iterations = DEFAULT_ITERATIONS_PER_THREAD;
+    if (argc > 1) {
+        iterations = std::atol(argv[1]);
+        if (iterations <= 0) {
+            fprintf(stderr, "usage: %s [iterationsPerThread]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    MutexCTimeAccess mutexAccess;
+    auto safeAccess = SafeCTimeAccess::instance();
+
+    printf("%-22s %7s %14s %12s\n", "case", "threads", "conversions/s", "ns/conv");
+    for (auto threadCount : THREAD_COUNTS) {
+        measure("gmtime mutex", threadCount, iterations, [&](std::time_t time, std::tm* out) {
+            return mutexAccess.getGmtime(time, out);
+        });
+        measure("gmtime lock-free", threadCount, iterations, [&](std::time_t time, std::tm* out) {
+            return safeAccess->getGmtime(time, out);
+        });
+        measure("localtime mutex", threadCount, iterations, [&](std::time_t time, std::tm* out) {
+            return mutexAccess.getLocaltime(time, out);
+        });
+        measure("localtime lock-free", threadCount, iterations, [&](std::time_t time, std::tm* out) {
+            return safeAccess->getLocaltime(time, out);
+        });
+    }
+    return EXIT_SUCCESS;
+}
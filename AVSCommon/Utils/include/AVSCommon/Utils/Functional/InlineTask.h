@@ -0,0 +1,324 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FUNCTIONAL_INLINETASK_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FUNCTIONAL_INLINETASK_H_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace functional {
+
+/**
+ * A move-only callable taking no arguments, like a @c std::function<void()> that may hold move-only callables such
+ * as a @c std::packaged_task.  Any value the callable returns is discarded.
+ *
+ * A callable of up to @c CAPACITY bytes, that can be moved without throwing, is kept in storage inside the
+ * @c InlineTask, so creating, moving and calling it do not touch the allocator.  A larger callable is kept on the heap.
+ */
+class InlineTask {
+public:
+    /// The size of the largest callable kept inside the @c InlineTask.
+    static const size_t CAPACITY = 48;
+
+    /**
+     * Constructor, for an empty task.
+     */
+    InlineTask() noexcept;
+
+    /**
+     * Constructor, for an empty task.
+     */
+    InlineTask(std::nullptr_t) noexcept;
+
+    /**
+     * Constructor.
+     *
+     * @tparam Callable The type of the callable.
+     * @param callable The callable.  If it is a null function pointer or an empty @c std::function, the task is empty.
+     */
+    template <
+        typename Callable,
+        typename = typename std::enable_if<!std::is_same<typename std::decay<Callable>::type, InlineTask>::value>::type>
+    InlineTask(Callable&& callable);
+
+    /**
+     * Move constructor.
+     *
+     * @param other The task to move from, which is left empty.
+     */
+    InlineTask(InlineTask&& other) noexcept;
+
+    /**
+     * Move assignment operator.
+     *
+     * @param other The task to move from, which is left empty.
+     * @return This task.
+     */
+    InlineTask& operator=(InlineTask&& other) noexcept;
+
+    /**
+     * Assignment operator, which destroys the callable.
+     *
+     * @return This task.
+     */
+    InlineTask& operator=(std::nullptr_t) noexcept;
+
+    /**
+     * Deleted copy constructor.
+     */
+    InlineTask(const InlineTask&) = delete;
+
+    /**
+     * Deleted copy assignment operator.
+     */
+    InlineTask& operator=(const InlineTask&) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~InlineTask();
+
+    /**
+     * Call the callable.  The task must not be empty.
+     */
+    void operator()();
+
+    /**
+     * Return whether the task holds a callable.
+     *
+     * @return Whether the task holds a callable.
+     */
+    explicit operator bool() const noexcept;
+
+private:
+    /// The functions that operate on the callable of a task, one set for each type of callable and way of keeping it.
+    struct Operations {
+        /// Call the callable in the storage.
+        void (*call)(void* storage);
+
+        /// Move the callable from one storage to another, destroying it in the first.
+        void (*move)(void* from, void* to);
+
+        /// Destroy the callable in the storage.
+        void (*destroy)(void* storage);
+    };
+
+    /**
+     * The operations of a callable kept inside the task.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct InlineOperations {
+        /// The operations.
+        static const Operations operations;
+
+        /// @c Operations::call.
+        static void call(void* storage) {
+            (*static_cast<Callable*>(storage))();
+        }
+
+        /// @c Operations::move.
+        static void move(void* from, void* to) {
+            new (to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        }
+
+        /// @c Operations::destroy.
+        static void destroy(void* storage) {
+            static_cast<Callable*>(storage)->~Callable();
+        }
+    };
+
+    /**
+     * The operations of a callable kept on the heap, with a pointer to it in the storage of the task.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct HeapOperations {
+        /// The operations.
+        static const Operations operations;
+
+        /// @c Operations::call.
+        static void call(void* storage) {
+            (**static_cast<Callable**>(storage))();
+        }
+
+        /// @c Operations::move.
+        static void move(void* from, void* to) {
+            *static_cast<Callable**>(to) = *static_cast<Callable**>(from);
+        }
+
+        /// @c Operations::destroy.
+        static void destroy(void* storage) {
+            delete *static_cast<Callable**>(storage);
+        }
+    };
+
+    /**
+     * Whether a type of callable is kept inside the task.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct IsInline
+            : std::integral_constant<
+                  bool,
+                  sizeof(Callable) <= CAPACITY && alignof(Callable) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Callable>::value> {};
+
+    /**
+     * Keep a callable inside the task.
+     *
+     * @param callable The callable.
+     */
+    template <typename Callable, typename Argument>
+    void store(Argument&& callable, std::true_type);
+
+    /**
+     * Keep a callable on the heap.
+     *
+     * @param callable The callable.
+     */
+    template <typename Callable, typename Argument>
+    void store(Argument&& callable, std::false_type);
+
+    /**
+     * Return whether a callable is null.
+     *
+     * @return @c false, for a type of callable that cannot be null.
+     */
+    template <typename Callable>
+    static bool isNull(const Callable&) {
+        return false;
+    }
+
+    /**
+     * Return whether a function pointer is null.
+     *
+     * @param function The function pointer.
+     * @return Whether @c function is null.
+     */
+    template <typename Result, typename... Args>
+    static bool isNull(Result (*function)(Args...)) {
+        return !function;
+    }
+
+    /**
+     * Return whether a @c std::function is empty.
+     *
+     * @param function The function.
+     * @return Whether @c function is empty.
+     */
+    template <typename Signature>
+    static bool isNull(const std::function<Signature>& function) {
+        return !function;
+    }
+
+    /// The storage of the callable, or of a pointer to it.
+    alignas(std::max_align_t) unsigned char m_storage[CAPACITY];
+
+    /// The operations of the callable, or @c nullptr if the task is empty.
+    const Operations* m_operations;
+};
+
+template <typename Callable>
+const InlineTask::Operations InlineTask::InlineOperations<Callable>::operations = {call, move, destroy};
+
+template <typename Callable>
+const InlineTask::Operations InlineTask::HeapOperations<Callable>::operations = {call, move, destroy};
+
+inline InlineTask::InlineTask() noexcept : m_operations{nullptr} {
+}
+
+inline InlineTask::InlineTask(std::nullptr_t) noexcept : m_operations{nullptr} {
+}
+
+template <typename Callable, typename>
+InlineTask::InlineTask(Callable&& callable) : m_operations{nullptr} {
+    using CallableType = typename std::decay<Callable>::type;
+    if (isNull(callable)) {
+        return;
+    }
+    store<CallableType>(std::forward<Callable>(callable), IsInline<CallableType>());
+}
+
+inline InlineTask::InlineTask(InlineTask&& other) noexcept : m_operations{other.m_operations} {
+    if (m_operations) {
+        m_operations->move(other.m_storage, m_storage);
+        other.m_operations = nullptr;
+    }
+}
+
+inline InlineTask& InlineTask::operator=(InlineTask&& other) noexcept {
+    if (this != &other) {
+        *this = nullptr;
+        if (other.m_operations) {
+            other.m_operations->move(other.m_storage, m_storage);
+            m_operations = other.m_operations;
+            other.m_operations = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline InlineTask& InlineTask::operator=(std::nullptr_t) noexcept {
+    if (m_operations) {
+        // Clear the operations first, so that the task is empty if the callable's destructor reaches it.
+        auto operations = m_operations;
+        m_operations = nullptr;
+        operations->destroy(m_storage);
+    }
+    return *this;
+}
+
+inline InlineTask::~InlineTask() {
+    *this = nullptr;
+}
+
+inline void InlineTask::operator()() {
+    m_operations->call(m_storage);
+}
+
+inline InlineTask::operator bool() const noexcept {
+    return m_operations != nullptr;
+}
+
+template <typename Callable, typename Argument>
+void InlineTask::store(Argument&& callable, std::true_type) {
+    new (m_storage) Callable(std::forward<Argument>(callable));
+    m_operations = &InlineOperations<Callable>::operations;
+}
+
+template <typename Callable, typename Argument>
+void InlineTask::store(Argument&& callable, std::false_type) {
+    *reinterpret_cast<Callable**>(m_storage) = new Callable(std::forward<Argument>(callable));
+    m_operations = &HeapOperations<Callable>::operations;
+}
+
+}  // namespace functional
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FUNCTIONAL_INLINETASK_H_
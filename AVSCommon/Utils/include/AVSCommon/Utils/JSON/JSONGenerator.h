@@ -190,6 +190,21 @@ public:
      */
     std::string toString(bool finalize = true);
 
+    /**
+     * Return the string representation of the object without copying it.
+     *
+     * @param[out] length The length of the returned string.
+     * @param finalize If set to @c true the object will be finalized first, as with @c toString().
+     * @return The string representation of the json object.  Only valid until the generator is next modified.
+     */
+    const char* toCString(size_t* length, bool finalize = true);
+
+    /**
+     * Discard the json built so far and start a new object.  The memory of the buffer is kept, so that a generator
+     * that is reused does not allocate once the buffer has grown.
+     */
+    void reset();
+
 private:
     /// Checks if the writer is still open and ready to be used.
     bool checkWriter();
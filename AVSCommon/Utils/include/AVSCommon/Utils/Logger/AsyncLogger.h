@@ -0,0 +1,277 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger that logs to console from a background thread.
+ *
+ * @c emit() copies the level, time, thread moniker and text of each entry into a slot of a bounded multi-producer
+ * queue and returns.  A single writer thread drains the queue, formats the records with @c LogStringFormatter and
+ * writes them to @c std::cout in batches, so threads that log are not serialized behind terminal or pipe I/O.
+ *
+ * Each queue slot keeps its string storage between uses, so once the queue has warmed up enqueuing a record is a
+ * copy into existing storage and an atomic update.  If the queue is full, @c emit() blocks until the writer has
+ * made room rather than dropping entries.
+ *
+ * Entries captured with @c LogEntry::CaptureMode::BINARY are queued as their @c LogEntryRecord bytes and rendered
+ * to text on the writer thread, so the emitting thread does no text formatting at all.  The queued bytes hold
+ * copies of the keys and events that the record refers to, which may be gone by the time it is rendered.
+ *
+ * The queue size may be configured with the @c "queueSize" value of the @c "asyncLogger" configuration object.
+ * Setting its @c "deferFormatting" value to @c true switches @c LogEntry to @c LogEntry::CaptureMode::BINARY.
+ * To use this sink, pass @c getAsyncLogger() to @c LoggerSinkManager::initialize(), or define @c ACSDK_LOG_SINK
+ * as @c Async.
+ *
+ * Inheriting @c std::ios_base::Init ensures that the standard iostreams objects are properly initialized before @c
+ * AsyncLogger uses them.
+ */
+class AsyncLogger
+        : public Logger
+        , private std::ios_base::Init {
+public:
+    /**
+     * Return the one and only @c AsyncLogger instance.
+     *
+     * @return The one and only @c AsyncLogger instance.
+     */
+    static std::shared_ptr<Logger> instance();
+
+    /**
+     * Destructor.  Writes out any entries that are still queued and stops the writer thread.
+     */
+    ~AsyncLogger();
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    void emitEntry(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogEntry& entry) override;
+
+    void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const char* line,
+        size_t length) override;
+
+    bool usesFormattedLines() const override;
+
+    void emitAtExit(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text) override;
+
+    /**
+     * Block until every entry emitted before this call has been written to @c std::cout.
+     */
+    void flush();
+
+private:
+    /// What the text of a queued record holds.
+    enum class Content {
+        /// The text of the entry, to be formatted by the writer.
+        TEXT,
+        /// The bytes of a @c LogEntryRecord, to be rendered and formatted by the writer.
+        RECORD,
+        /// A line that has already been formatted, to be written as is.
+        LINE
+    };
+
+    /// A captured log entry waiting to be written.
+    struct Record {
+        /// Sequence number used to hand the slot back and forth between producers and the writer.
+        std::atomic<size_t> sequence;
+
+        /// The severity level of the entry.
+        Level level;
+
+        /// The time that the entry was emitted.
+        std::chrono::system_clock::time_point time;
+
+        /// The moniker of the thread that emitted the entry.
+        std::string threadMoniker;
+
+        /// The text, record bytes or formatted line of the entry, as indicated by @c content.
+        std::string text;
+
+        /// What @c text holds.
+        Content content;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param queueSize The number of records the queue can hold.  Rounded up to a power of two.
+     */
+    AsyncLogger(size_t queueSize);
+
+    /**
+     * Queue an entry, waiting for the writer to make room if the queue is full.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was emitted.
+     * @param threadMoniker Moniker of the thread that emitted the entry.
+     * @param data The text of the entry, the bytes of its @c LogEntryRecord, or its formatted line.
+     * @param size The number of bytes in @c data.
+     * @param content What @c data holds.
+     * @return Whether the entry was queued.  @c false means the logger is stopping and the entry was not queued.
+     */
+    bool enqueue(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* data,
+        size_t size,
+        Content content);
+
+    /**
+     * Try to copy an entry in to a free slot of the queue.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was emitted.
+     * @param threadMoniker Moniker of the thread that emitted the entry.
+     * @param data The text of the entry, the bytes of its @c LogEntryRecord, or its formatted line.
+     * @param size The number of bytes in @c data.
+     * @param content What @c data holds.
+     * @return Whether the entry was queued.  @c false means the queue is full.
+     */
+    bool tryEnqueue(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* data,
+        size_t size,
+        Content content);
+
+    /**
+     * Wake the writer thread if it is waiting for entries.
+     */
+    void wakeWriter();
+
+    /// Main loop of the writer thread.
+    void writerLoop();
+
+    /**
+     * Stop the writer thread and write out any entries that are still queued.  Subsequent entries are written
+     * synchronously by the emitting thread.  Safe to call more than once.
+     */
+    void shutdown();
+
+    /// Function registered with @c std::atexit() to call @c shutdown() on the singleton instance.
+    static void shutdownAtExit();
+
+    /**
+     * Format and write out every entry in the queue.  @c m_consumerMutex must be held when calling this method.
+     *
+     * @return Whether any entries were written.
+     */
+    bool drainLocked();
+
+    /**
+     * Write the accumulated @c m_batch to @c std::cout and clear it.  @c m_consumerMutex must be held when calling
+     * this method.
+     */
+    void writeBatchLocked();
+
+    /// The slots of the queue.
+    std::unique_ptr<Record[]> m_records;
+
+    /// Mask used to map a position in the queue to an index in @c m_records.
+    const size_t m_mask;
+
+    /// The position at which the next record will be enqueued.
+    std::atomic<size_t> m_enqueuePosition;
+
+    /// The position from which the next record will be dequeued.  Only modified with @c m_consumerMutex held.
+    std::atomic<size_t> m_dequeuePosition;
+
+    /// The number of records that have been written out.  Used to implement @c flush().
+    std::atomic<size_t> m_writtenCount;
+
+    /// Serializes consumption of the queue between the writer thread and @c emitAtExit().
+    std::mutex m_consumerMutex;
+
+    /// Buffer used to accumulate formatted lines.  Only accessed with @c m_consumerMutex held.
+    std::string m_batch;
+
+    /// The number of records in @c m_batch.  Only accessed with @c m_consumerMutex held.
+    size_t m_batchCount;
+
+    /// Object to format log strings correctly.  Only accessed with @c m_consumerMutex held.
+    LogStringFormatter m_logFormatter;
+
+    /// Buffer used to render queued @c LogEntryRecord instances.  Only accessed with @c m_consumerMutex held.
+    std::string m_renderBuffer;
+
+    /// Mutex used with the condition variables below.
+    std::mutex m_waitMutex;
+
+    /// Condition variable used to wake the writer thread.
+    std::condition_variable m_writerCondition;
+
+    /// Condition variable used to notify producers waiting for free slots and callers of @c flush().
+    std::condition_variable m_drainedCondition;
+
+    /// Whether the writer thread is (about to be) waiting on @c m_writerCondition.
+    std::atomic<bool> m_writerWaiting;
+
+    /// The number of threads waiting in @c emit() or @c flush() for the writer to make progress.
+    std::atomic<int> m_waiterCount;
+
+    /// Whether the writer thread has been asked to stop.
+    std::atomic<bool> m_stopping;
+
+    /// Mutex to serialize writing to cout.
+    std::shared_ptr<std::mutex> m_coutMutex;
+
+    /// The writer thread.
+    std::thread m_writerThread;
+};
+
+/**
+ * Return the singleton instance of @c AsyncLogger.
+ *
+ * @return The singleton instance of @c AsyncLogger.
+ */
+std::shared_ptr<Logger> getAsyncLogger();
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
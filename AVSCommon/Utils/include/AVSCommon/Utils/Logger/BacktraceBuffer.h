@@ -0,0 +1,190 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BACKTRACEBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BACKTRACEBUFFER_H_
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+class LogEntry;
+class Logger;
+
+/**
+ * Holds the most recent entries of a module that were below the level forwarded to its sink, so that they can be
+ * emitted after all when the module logs an error.  This gives the detail that led up to a failure without paying
+ * for writing that detail out all the time.
+ *
+ * Entries are kept in a ring of a fixed number of slots.  The text of an entry is copied into the string of its slot,
+ * which keeps its capacity, so that adding entries stops allocating once the slots have grown.  An entry captured with
+ * @c LogEntry::CaptureMode::BINARY is kept as its record, with the strings it points to copied into it, and is only
+ * rendered if the buffer is flushed.  When an entry at or above the flush level is emitted, the buffered entries that
+ * are not older than the maximum age are taken out of the buffer and emitted to the sink first, with their original
+ * levels and times, through @c Logger::emitUnfiltered() so that a sink filtering by level does not drop them.  They
+ * are taken out by swapping the slots with those of a second ring, so that the strings of both keep their capacity,
+ * and emitted after the buffer is unlocked, so other threads may keep adding entries.
+ */
+class BacktraceBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param level The lowest severity level of entries to buffer.
+     * @param flushLevel The lowest severity level of entries that flush the buffer.
+     * @param capacity The number of entries to keep.
+     * @param maxAge How old entries may be and still be emitted when the buffer is flushed.
+     */
+    BacktraceBuffer(Level level, Level flushLevel, size_t capacity, std::chrono::milliseconds maxAge);
+
+    /**
+     * Return whether entries of a specified severity should be buffered.
+     *
+     * @param level The Level to check.
+     * @return Whether entries of the specified Level should be buffered.
+     */
+    inline bool shouldBuffer(Level level) const;
+
+    /**
+     * Return whether entries of a specified severity should flush the buffer.
+     *
+     * @param level The Level to check.
+     * @return Whether entries of the specified Level should flush the buffer.
+     */
+    inline bool shouldFlush(Level level) const;
+
+    /**
+     * Get the lowest severity level of entries to buffer.
+     *
+     * @return The lowest severity level of entries to buffer.
+     */
+    inline Level getLevel() const;
+
+    /**
+     * Add an entry to the buffer, replacing the oldest entry if the buffer is full.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the thread that logged the entry.
+     * @param text The text of the entry.
+     */
+    void add(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text);
+
+    /**
+     * Add an entry to the buffer, replacing the oldest entry if the buffer is full.  An entry captured in binary form
+     * is kept as its record, and rendered when the buffer is flushed.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the thread that logged the entry.
+     * @param entry The entry.
+     */
+    void add(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const LogEntry& entry);
+
+    /**
+     * Emit the buffered entries to a sink, oldest first, and empty the buffer.
+     *
+     * @param time The time of the entry that triggered the flush.  Entries older than the maximum age at this time
+     * are dropped.
+     * @param sink The @c Logger to emit the entries to.
+     */
+    void flush(std::chrono::system_clock::time_point time, Logger* sink);
+
+private:
+    /// A buffered entry.
+    struct Entry {
+        /// The severity level of the entry.
+        Level level;
+
+        /// The time that the entry was logged.
+        std::chrono::system_clock::time_point time;
+
+        /// The moniker of the thread that logged the entry.
+        std::string threadMoniker;
+
+        /// The text of the entry, or its record if @c isRecord is @c true.
+        std::string text;
+
+        /// Whether @c text holds the bytes of a @c LogEntryRecord rather than rendered text.
+        bool isRecord;
+    };
+
+    /**
+     * Take the next slot of the ring for a new entry.  @c m_mutex must be held.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the thread that logged the entry.
+     * @return The slot, with everything but the text of the entry filled in.
+     */
+    Entry& claimSlotLocked(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker);
+
+    /// The lowest severity level of entries to buffer.
+    const Level m_level;
+
+    /// The lowest severity level of entries that flush the buffer.
+    const Level m_flushLevel;
+
+    /// How old entries may be and still be emitted when the buffer is flushed.
+    const std::chrono::milliseconds m_maxAge;
+
+    /// Serializes access to @c m_entries, @c m_next and @c m_count.
+    std::mutex m_mutex;
+
+    /// The slots of the ring.
+    std::vector<Entry> m_entries;
+
+    /// The index of the slot that the next entry is written to.
+    size_t m_next;
+
+    /// The number of entries in the ring.
+    size_t m_count;
+
+    /// Serializes access to @c m_flushed and @c m_flushedText.  Only tried, so that a flush never waits for another.
+    std::mutex m_flushMutex;
+
+    /// The slots that entries are swapped into by @c flush(), as many as @c m_entries.
+    std::vector<Entry> m_flushed;
+
+    /// The text that records are rendered to by @c flush().
+    std::string m_flushedText;
+};
+
+bool BacktraceBuffer::shouldBuffer(Level level) const {
+    return level >= m_level;
+}
+
+bool BacktraceBuffer::shouldFlush(Level level) const {
+    return level >= m_flushLevel;
+}
+
+Level BacktraceBuffer::getLevel() const {
+    return m_level;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BACKTRACEBUFFER_H_
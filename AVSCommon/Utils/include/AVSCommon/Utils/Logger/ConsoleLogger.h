@@ -16,6 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 
+#include <condition_variable>
+#include <string>
+#include <thread>
+
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Logger/LogStringFormatter.h"
@@ -28,6 +32,17 @@ namespace logger {
 /**
  * A very simple (e.g. not asynchronous) @c Logger that logs to console.
  *
+ * By default each line is written as it is emitted.  With a non-zero @c "batchSize", lines are instead collected in a
+ * staging buffer and written to standard output with one @c writev() per batch, rather than with one system call per
+ * line.  The batch is written when it reaches @c "batchSize" bytes, when @c "flushIntervalMs" has passed since its
+ * first line was staged, and right away for entries at @c Level::ERROR and above.  Whatever is staged is also written
+ * out at exit, but lines staged when the process crashes are lost, so batching is off unless configured:
+ *
+ *     "consoleLogger" : {
+ *         "batchSize" : 16384,
+ *         "flushIntervalMs" : 100
+ *     }
+ *
  * Inheriting @c std::ios_base::Init ensures that the standard iostreams objects are properly initialized before @c
  * ConsoleLogger uses them.
  */
@@ -45,15 +60,85 @@ public:
     void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
         override;
 
+    void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const char* line,
+        size_t length) override;
+
+    bool usesFormattedLines() const override;
+
+    void emitAtExit(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text) override;
+
+    /// Destructor.
+    ~ConsoleLogger();
+
 private:
     /**
      * Constructor.
      */
     ConsoleLogger();
 
-    /// Mutex to serialize writing to cout.
+    /**
+     * Stage a formatted line, and write out the batch if the line or the size of the batch calls for it.
+     *
+     * @param level The severity Level of the line.
+     * @param line The formatted line, without a trailing newline.
+     * @param length The number of characters in @c line.
+     */
+    void stage(Level level, const char* line, size_t length);
+
+    /**
+     * Write out the staged lines, followed by a line that has not been staged.  @c m_coutMutex must be held when
+     * calling this method.
+     *
+     * @param line A line to write after the staged lines, without a trailing newline, or @c nullptr.
+     * @param length The number of characters in @c line.
+     */
+    void writeLocked(const char* line, size_t length);
+
+    /// Main loop of the thread that writes out batches that have been staged for @c m_flushInterval.
+    void flushLoop();
+
+    /**
+     * Stop the flush thread and write out the staged lines.  Subsequent lines are written as they are emitted.  Safe
+     * to call more than once.
+     */
+    void shutdown();
+
+    /// Function registered with @c std::atexit() to call @c shutdown() on the singleton instance.
+    static void shutdownAtExit();
+
+    /// Mutex to serialize writing to cout.  Also guards the members below.
     std::shared_ptr<std::mutex> m_coutMutex;
 
+    /// The size of the staged lines at which they are written out.  Zero if lines are not staged.
+    size_t m_batchSize;
+
+    /// How long lines may be staged before they are written out.
+    std::chrono::milliseconds m_flushInterval;
+
+    /// The staged lines, each followed by a newline.
+    std::string m_staged;
+
+    /// When the first of the staged lines was staged.
+    std::chrono::steady_clock::time_point m_batchStart;
+
+    /// Whether the flush thread is stopping, or has stopped.
+    bool m_stopping;
+
+    /// Notified when the first line of a batch is staged, and when the flush thread should stop.
+    std::condition_variable m_flushCondition;
+
+    /// Thread that writes out batches that have been staged for @c m_flushInterval.
+    std::thread m_flushThread;
+
     /// Object to format log strings correctly.
     LogStringFormatter m_logFormatter;
 };
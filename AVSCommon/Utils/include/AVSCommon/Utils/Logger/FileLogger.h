@@ -0,0 +1,278 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FILELOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FILELOGGER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger that appends to a rotating set of memory mapped segment files.
+ *
+ * Each segment is preallocated to its full size with @c posix_fallocate(), or by writing zeros where that is not
+ * supported, and mapped into memory, so writing a log line is a @c memcpy() into the mapping rather than a
+ * @c write() system call.  A segment that cannot be preallocated, for example because the disk is full, is not used.
+ * Lines are formatted by the emitting thread before the segment lock is taken, so the lock is only held for the copy.
+ * When a line does not fit in the current segment, or the segment is older than the configured maximum age, a new
+ * segment is started.  Completed segments are truncated to the length of their contents, and the oldest are deleted
+ * once there are more than the configured number of them.  If the process exits abnormally, the unwritten tail of the
+ * current segment is left filled with null characters.
+ *
+ * Segments are named @c <prefix>.<sequence>.log, where @c sequence is zero padded and increases with each segment,
+ * and numbering continues from the segments already in the directory.
+ *
+ * The settings are read from the @c "fileLogger" configuration object:
+ *
+ *     "fileLogger" : {
+ *         "logLevel" : "INFO",
+ *         "directory" : "/var/log/avs",
+ *         "prefix" : "avs",
+ *         "segmentSize" : 4194304,
+ *         "maxSegmentAgeSeconds" : 3600,
+ *         "maxSegmentCount" : 8,
+ *         "durability" : "PERIODIC",
+ *         "syncIntervalMs" : 1000
+ *     }
+ *
+ * @c "durability" is one of @c "NONE" (leave writeback to the kernel), @c "PERIODIC" (@c msync() the written part
+ * of the current segment every @c "syncIntervalMs" from a background thread) or @c "ON_ERROR" (@c msync() on the
+ * emitting thread after each @c ERROR or @c CRITICAL entry).  A @c "maxSegmentAgeSeconds" of zero disables
+ * rotation by age.
+ *
+ * If a segment cannot be created, entries are written to @c std::cerr until one can.  To use this sink, pass
+ * @c getFileLogger() to @c LoggerSinkManager::initialize(), or define @c ACSDK_LOG_SINK as @c File.
+ *
+ * Inheriting @c std::ios_base::Init ensures that the standard iostreams objects are properly initialized before @c
+ * FileLogger uses them.
+ */
+class FileLogger
+        : public Logger
+        , private std::ios_base::Init {
+public:
+    /// When the contents of segments are explicitly written back to storage.
+    enum class Durability {
+        /// Never.  Writeback is left to the kernel.
+        NONE,
+        /// Periodically, from a background thread.
+        PERIODIC,
+        /// After each @c ERROR or @c CRITICAL entry, by the thread that emitted it.
+        ON_ERROR
+    };
+
+    /**
+     * Return the one and only @c FileLogger instance.
+     *
+     * @return The one and only @c FileLogger instance.
+     */
+    static std::shared_ptr<Logger> instance();
+
+    /**
+     * Destructor.  Stops the background thread and completes the current segment.
+     */
+    ~FileLogger();
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const char* line,
+        size_t length) override;
+
+    bool usesFormattedLines() const override;
+
+    /**
+     * Write the contents of the current segment back to storage, blocking until it has been written.
+     *
+     * @return Whether the contents were written back.
+     */
+    bool sync();
+
+private:
+    /// A memory mapped segment file.
+    class Segment;
+
+    /**
+     * Constructor.
+     *
+     * @param configuration The @c "fileLogger" configuration object.
+     */
+    FileLogger(const configuration::ConfigurationNode& configuration);
+
+    /**
+     * Write a formatted line to the current segment, or to @c std::cerr if there is none.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was emitted.
+     * @param line The formatted line, without a trailing newline.  A newline is written after it, and it is truncated
+     * if it is longer than a segment.
+     * @param length The length of @c line.
+     */
+    void writeLine(Level level, std::chrono::system_clock::time_point time, const char* line, size_t length);
+
+    /**
+     * Copy a formatted line into the current segment, starting a new segment if needed.
+     *
+     * @param time The time that the entry was emitted.
+     * @param line The formatted line, without a trailing newline.  A newline is written after it.
+     * @param length The length of @c line, which must be shorter than a segment.
+     * @param[out] segment The segment the line was written to.
+     * @param[out] end The length of @c segment once the line was written to it.
+     * @return Whether the line was written.  @c false means no segment could be created.
+     */
+    bool append(
+        std::chrono::system_clock::time_point time,
+        const char* line,
+        size_t length,
+        std::shared_ptr<Segment>* segment,
+        size_t* end);
+
+    /**
+     * Replace the current segment with a new one.  @c m_mutex must be held when calling this method.
+     *
+     * @param time The time at which the new segment is started.
+     * @param[out] previous The segment that was replaced, to be released once @c m_mutex has been released.
+     */
+    void rotateLocked(std::chrono::system_clock::time_point time, std::shared_ptr<Segment>* previous);
+
+    /**
+     * Write a segment that is no longer being written to back to storage, unless @c m_durability is
+     * @c Durability::NONE.
+     *
+     * @param segment The segment.
+     */
+    void completeSegment(const std::shared_ptr<Segment>& segment);
+
+    /**
+     * Write a line to @c std::cerr, for use when there is no segment to write it to.
+     *
+     * @param line The formatted line, without a trailing newline.  A newline is written after it.
+     * @param length The length of @c line.
+     */
+    void writeToCerr(const char* line, size_t length);
+
+    /**
+     * Report a failure to manage segment files on @c std::cerr.  Logging it would recurse in to this sink.
+     *
+     * @param time The time of the failure.
+     * @param entry The entry describing the failure.
+     */
+    void reportError(std::chrono::system_clock::time_point time, const LogEntry& entry);
+
+    /**
+     * Find the segments left in the directory by previous runs.
+     */
+    void findExistingSegments();
+
+    /**
+     * Delete the oldest segments until no more than @c m_maxSegmentCount remain.  @c m_mutex must be held when
+     * calling this method.
+     */
+    void removeOldSegmentsLocked();
+
+    /**
+     * Get the path of a segment file.
+     *
+     * @param sequence The sequence number of the segment.
+     * @return The path of the segment file.
+     */
+    std::string segmentPath(uint64_t sequence) const;
+
+    /// Main loop of the thread that implements @c Durability::PERIODIC.
+    void syncLoop();
+
+    /// The directory that segments are written to.
+    std::string m_directory;
+
+    /// The prefix of segment file names.
+    std::string m_prefix;
+
+    /// The size of each segment, in bytes.
+    size_t m_segmentSize;
+
+    /// The age at which a segment is replaced even if it is not full.  Zero to disable.
+    std::chrono::seconds m_maxSegmentAge;
+
+    /// The number of segments to keep.
+    size_t m_maxSegmentCount;
+
+    /// When segments are written back to storage.
+    Durability m_durability;
+
+    /// How often segments are written back with @c Durability::PERIODIC.
+    std::chrono::milliseconds m_syncInterval;
+
+    /// Object to format log strings correctly.
+    LogStringFormatter m_logFormatter;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The segment being written to.  Null if none could be created.
+    std::shared_ptr<Segment> m_segment;
+
+    /// The sequence numbers of the segments in the directory, oldest first.
+    std::deque<uint64_t> m_sequences;
+
+    /// The sequence number of the next segment.
+    uint64_t m_nextSequence;
+
+    /// If creating a segment failed, the time before which another attempt is not made.
+    std::chrono::system_clock::time_point m_retryTime;
+
+    /// Whether the sync thread has been asked to stop.
+    bool m_stopping;
+
+    /// Condition variable used to wake the sync thread when stopping.
+    std::condition_variable m_stopCondition;
+
+    /// Mutex to serialize writing to cerr.
+    std::shared_ptr<std::mutex> m_coutMutex;
+
+    /// The thread that implements @c Durability::PERIODIC.
+    std::thread m_syncThread;
+};
+
+/**
+ * Return the singleton instance of @c FileLogger.
+ *
+ * @return The singleton instance of @c FileLogger.
+ */
+std::shared_ptr<Logger> getFileLogger();
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FILELOGGER_H_
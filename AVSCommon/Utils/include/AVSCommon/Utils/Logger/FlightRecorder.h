@@ -0,0 +1,253 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FLIGHTRECORDER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FLIGHTRECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Keeps the most recent log entries of each thread in a memory mapped file, so that they can be read after the
+ * process has crashed.
+ *
+ * The file holds a ring of fixed size slots for each thread.  A thread claims a ring the first time it records an
+ * entry, and releases it when it exits.  Recording an entry copies its text into the next slot of the thread's ring,
+ * without taking a lock or making a system call.  Entries captured with @c LogEntry::CaptureMode::BINARY are
+ * rendered first, because their records refer to strings in the memory of the process.  Each slot has a sequence
+ * number that is odd while the slot is being written, so that readers can tell complete entries from torn ones.
+ * Entries longer than a slot are truncated.
+ *
+ * Because the file is mapped shared, its contents survive the process dying for any reason.  The recorder also
+ * installs handlers for @c SIGSEGV, @c SIGBUS, @c SIGFPE, @c SIGILL and @c SIGABRT that note the signal in the file
+ * before passing it on to the previous handler.  The handlers run on an alternate signal stack, so that a stack
+ * overflow is noted too.  One is given to the thread that starts the recorder and to each thread when it first records
+ * an entry, unless the thread already has one.  Use the @c FlightRecorderDump tool, or @c read(), to decode the file.
+ * When the recorder starts, an existing file at its path is renamed with a @c .previous suffix rather than
+ * overwritten, so the entries of a crashed run are kept after it is restarted.
+ *
+ * The recorder is enabled by the presence of the @c "flightRecorder" configuration object:
+ *
+ *     "flightRecorder" : {
+ *         "path" : "/dev/shm/avsFlightRecorder",
+ *         "logLevel" : "DEBUG9",
+ *         "threadCount" : 16,
+ *         "slotCount" : 256,
+ *         "slotSize" : 256,
+ *         "crashHandler" : true
+ *     }
+ *
+ * Entries are recorded by @c Logger::log() and @c ModuleLogger::emit().  Without a @c "logLevel", the recorder keeps
+ * the entries that are logged at the levels of the modules and sinks, at the cost of copying each into its slot.
+ * With one, a @c ModuleLogger builds entries at or above the recorder's level even if they are below the level of its
+ * module and sink, and only forwards those at or above the latter to the sink.  That has a cost: at @c DEBUG9, every
+ * debug entry of every module is built and rendered, whatever the levels of the sinks.  Entries logged directly to a
+ * sink are only recorded if the sink's level accepts them.
+ */
+class FlightRecorder {
+public:
+    /// An entry read back from a flight recorder file.
+    struct Entry {
+        /// The severity level of the entry.
+        Level level;
+
+        /// The time that the entry was logged.
+        std::chrono::system_clock::time_point time;
+
+        /// The moniker of the thread that logged the entry.
+        std::string threadMoniker;
+
+        /// The operating system's identifier of the thread that logged the entry.
+        int32_t threadId;
+
+        /// The text of the entry.
+        std::string text;
+
+        /// Whether the entry was still being written when the file was read (or when the process died).
+        bool torn;
+    };
+
+    /// The contents of a flight recorder file.
+    struct Snapshot {
+        /// The identifier of the process that wrote the file.
+        int32_t pid;
+
+        /// The time that the recorder was started.
+        std::chrono::system_clock::time_point startTime;
+
+        /// The signal that crashed the process, or zero if it has not crashed.
+        int32_t crashSignal;
+
+        /// The time of the crash, if @c crashSignal is not zero.
+        std::chrono::system_clock::time_point crashTime;
+
+        /// The number of entries that were not recorded because there were more threads than rings.
+        uint64_t droppedCount;
+
+        /// The entries in the file, in the order they were logged.
+        std::vector<Entry> entries;
+    };
+
+    /**
+     * Return the one and only @c FlightRecorder instance.  It is never destroyed, so that it may be used by static
+     * destructors and signal handlers.
+     *
+     * @return The one and only @c FlightRecorder instance, or @c nullptr if the recorder is not enabled or its file
+     * could not be created.
+     */
+    static FlightRecorder* instance();
+
+    /**
+     * Get the lowest severity level to be recorded.
+     *
+     * @return The lowest severity level to be recorded, or @c Level::UNKNOWN if no level is configured, in which case
+     * every entry that is logged is recorded, at whatever levels the modules and sinks log at.
+     */
+    Level getLevel() const;
+
+    /**
+     * Return whether entries of a specified severity should be recorded.
+     *
+     * @param level The Level to check.
+     * @return Whether entries of the specified Level should be recorded.
+     */
+    inline bool shouldRecord(Level level) const;
+
+    /**
+     * Record an entry in the ring of the calling thread.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the calling thread.
+     * @param entry The entry to record.
+     */
+    void record(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogEntry& entry);
+
+    /**
+     * Record the text of an entry in the ring of the calling thread.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the calling thread.
+     * @param text The text of the entry.
+     */
+    void record(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text);
+
+    /**
+     * Read a flight recorder file.  The file may be read while it is being written to.
+     *
+     * @param path The path of the file.
+     * @param[out] snapshot The contents of the file.
+     * @param[out] error If the file could not be read, why.
+     * @return Whether the file was read.
+     */
+    static bool read(const std::string& path, Snapshot* snapshot, std::string* error);
+
+private:
+    /// The header of a ring of slots in the file, written to by one thread at a time.
+    struct Ring;
+
+    /// Per-thread reference to the ring claimed by a thread, which releases the ring when the thread exits.
+    class RingHandle;
+
+    /**
+     * Constructor.
+     *
+     * @param level The lowest severity level to be recorded, or @c Level::UNKNOWN to record every entry logged.
+     * @param data The mapping of the file.
+     */
+    FlightRecorder(Level level, char* data);
+
+    /**
+     * Create the recorder from the @c "flightRecorder" configuration object.
+     *
+     * @return The recorder, or @c nullptr if it is not enabled or its file could not be created.
+     */
+    static FlightRecorder* create();
+
+    /**
+     * Claim a ring for the calling thread.
+     *
+     * @param threadMoniker Moniker of the calling thread.
+     * @return The ring, or @c nullptr if every ring is in use.
+     */
+    Ring* claimRing(const char* threadMoniker);
+
+    /**
+     * Get the ring of the calling thread, claiming one if it does not have one yet.
+     *
+     * @param threadMoniker Moniker of the calling thread.
+     * @return The ring, or @c nullptr if every ring is in use.
+     */
+    Ring* getRing(const char* threadMoniker);
+
+    /**
+     * Copy an entry into the next slot of a ring.
+     *
+     * @param ring The ring.
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param text The text of the entry.
+     * @param length The length of @c text.  Truncated to the size of a slot.
+     */
+    void write(Ring* ring, Level level, std::chrono::system_clock::time_point time, const char* text, size_t length);
+
+    /**
+     * Install the crash signal handlers.
+     */
+    void installCrashHandler();
+
+    /**
+     * Handler for crash signals.  Notes the signal in the file and passes it on to the previous handler.
+     *
+     * @param signalNumber The signal.
+     */
+    static void onCrashSignal(int signalNumber);
+
+    /// The lowest severity level to be recorded, or @c Level::UNKNOWN to record every entry logged.
+    const Level m_level;
+
+    /// The mapping of the file.
+    char* const m_data;
+
+    /// The number of times a ring has been released.  Threads that found no free ring try again when this changes.
+    std::atomic<uint32_t> m_releaseCount;
+};
+
+bool FlightRecorder::shouldRecord(Level level) const {
+    return level >= m_level || Level::UNKNOWN == m_level;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_FLIGHTRECORDER_H_
@@ -0,0 +1,91 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_HEXDUMP_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_HEXDUMP_H_
+
+#include <cstddef>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// The number of bytes in each row of a hex dump if no other is given.
+constexpr size_t DEFAULT_HEX_DUMP_WIDTH = 16;
+
+/**
+ * Get the most characters that @c formatHexDump() may write.
+ *
+ * @param prefixLength The length of the prefix of each row.
+ * @param width The number of bytes in each row.
+ * @param size The number of bytes to dump.
+ * @return The most characters that dumping @c size bytes may take.
+ */
+size_t getMaxHexDumpSize(size_t prefixLength, size_t width, size_t size);
+
+/**
+ * Render bytes as a hex dump, with a row for each @c width bytes:
+ *
+ *     <prefix>00000010 : 48656c6c 6f2c2077 6f726c64 210a0000 : Hello, world!...
+ *
+ * Each row is the prefix, the offset of the row in hex, the bytes in hex in groups of four, and the bytes as
+ * characters, with those that are not printable shown as @c '.', and ends with a newline.  Bytes are rendered with
+ * lookup tables, a row at a time.
+ *
+ * @param prefix The prefix of each row.
+ * @param prefixLength The length of @c prefix.
+ * @param width The number of bytes in each row.  0 means @c DEFAULT_HEX_DUMP_WIDTH.
+ * @param data The bytes to dump.
+ * @param size The number of bytes in @c data.
+ * @param[out] out The buffer to write the dump to.  Must have room for @c getMaxHexDumpSize() characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatHexDump(
+    const char* prefix,
+    size_t prefixLength,
+    size_t width,
+    const unsigned char* data,
+    size_t size,
+    char* out);
+
+/**
+ * Append a hex dump of bytes, in the format of @c formatHexDump(), to a string.
+ *
+ * @param prefix The prefix of each row.
+ * @param width The number of bytes in each row.  0 means @c DEFAULT_HEX_DUMP_WIDTH.
+ * @param data The bytes to dump.
+ * @param size The number of bytes in @c data.
+ * @param[out] out The string to append the dump to.
+ */
+void appendHexDump(const char* prefix, size_t width, const unsigned char* data, size_t size, std::string* out);
+
+/**
+ * Render bytes as a run of hex digits, two for each byte.
+ *
+ * @param data The bytes to render.
+ * @param size The number of bytes in @c data.
+ * @param[out] out The buffer to write the digits to.  Must have room for @c 2 * @c size characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatHex(const unsigned char* data, size_t size, char* out);
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_HEXDUMP_H_
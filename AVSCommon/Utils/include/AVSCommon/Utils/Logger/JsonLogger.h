@@ -0,0 +1,119 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_JSONLOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_JSONLOGGER_H_
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+#include "AVSCommon/Utils/JSON/JSONGenerator.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger that writes each entry to standard output as a JSON object on a line of its own, for log collectors
+ * that would otherwise have to parse the @c source:event:key=value text format:
+ *
+ *     {"timestamp":1760683620457,"level":"ERROR","thread":"12","source":"Foo","event":"barFailed",
+ *      "metadata":{"reason":"timedOut","attempt":3},"message":"..."}
+ *
+ * The timestamp is in milliseconds since the epoch.  @c "metadata" holds the values passed to @c LogEntry::d() and
+ * the like with their types, and is left out if there are none.  @c "message" holds the text passed to
+ * @c LogEntry::m(), if any.  To get at the values, @c instance() switches @c LogEntry to
+ * @c LogEntry::CaptureMode::BINARY, and entries are read from their @c LogEntryRecord rather than from their text.
+ * Entries that reach this logger only as text (e.g. from @c emitAtExit()) are written with a single @c "text" member
+ * in place of the source, event, metadata and message.
+ *
+ * Each thread reuses its own @c JsonGenerator, so that writing an entry does not allocate once its buffer has grown.
+ */
+class JsonLogger
+        : public Logger
+        , private std::ios_base::Init {
+public:
+    /**
+     * Return the one and only @c JsonLogger instance.
+     *
+     * @return The one and only @c JsonLogger instance.
+     */
+    static std::shared_ptr<Logger> instance();
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    void emitEntry(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogEntry& entry) override;
+
+private:
+    /**
+     * Constructor.
+     */
+    JsonLogger();
+
+    /**
+     * Get the generator of the calling thread, reset to an object holding the members common to all entries.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadMoniker Moniker of the thread that logged the entry.
+     * @return The generator of the calling thread.
+     */
+    static json::JsonGenerator& startObject(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker);
+
+    /**
+     * Add the source, event, metadata and message of an entry captured in binary form to a generator.
+     *
+     * @param generator The generator.
+     * @param data The bytes of the entry's record.
+     * @param size The number of bytes in @c data.
+     */
+    static void addRecord(json::JsonGenerator& generator, const char* data, size_t size);
+
+    /**
+     * Finish the object of an entry and write it out as a line.
+     *
+     * @param level The severity Level of the entry.
+     * @param generator The generator holding the object.
+     */
+    void write(Level level, json::JsonGenerator& generator);
+
+    /// Mutex to serialize writing to cout.
+    std::shared_ptr<std::mutex> m_coutMutex;
+};
+
+/**
+ * Return the singleton instance of @c JsonLogger.
+ *
+ * @return The singleton instance of @c JsonLogger.
+ */
+std::shared_ptr<Logger> getJsonLogger();
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_JSONLOGGER_H_
@@ -0,0 +1,139 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTEXT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTEXT_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Adds a @c key, @c value pair to the metadata of every @c LogEntry created on the calling thread while it is in
+ * scope, so that values such as a session or connection ID do not have to be passed to @c LogEntry::d() at each call
+ * site:
+ *
+ *     LogContext scope("device", macAddress);
+ *     ACSDK_INFO(LX("connected"));    // Logs "Source:connected:device=...".
+ *
+ * Scopes nest, and the pairs of all the scopes a thread is in are added, outermost first, ahead of the entry's own
+ * values.  Each thread keeps the text of its pairs with the values already escaped, so adding them to an entry is a
+ * single copy, and pushing and popping a scope reuse the thread's buffers rather than allocating once they have grown.
+ *
+ * Tasks run by @c timing::Timer and @c timing::WheelMultiTimer run in the context of the thread that started the
+ * timer or submitted the task.  Other code that hands work to another thread can do the same with @c bind().
+ */
+class LogContext {
+public:
+    /**
+     * Constructor.  Adds a pair to the context of the calling thread.
+     *
+     * @param key The key of the pair.
+     * @param value The value of the pair.
+     */
+    LogContext(const char* key, const char* value);
+
+    /**
+     * Constructor.  Adds a pair to the context of the calling thread.
+     *
+     * @param key The key of the pair.
+     * @param value The value of the pair.
+     */
+    LogContext(const char* key, const std::string& value);
+
+    /**
+     * Destructor.  Removes the pair from the context of the calling thread.  Scopes must end on the thread they
+     * started on, in the reverse order to which they started, as they do when they are local variables.
+     */
+    ~LogContext();
+
+    /**
+     * Deleted copy constructor.
+     */
+    LogContext(const LogContext&) = delete;
+
+    /**
+     * Deleted copy assignment operator.
+     */
+    LogContext& operator=(const LogContext&) = delete;
+
+    /**
+     * Wrap a task so that it runs in the context the calling thread is in now, whichever thread it runs on.
+     *
+     * @param task The task.
+     * @return The wrapped task, or @c task itself if the calling thread has no context.
+     */
+    static std::function<void()> bind(std::function<void()> task);
+
+    /**
+     * Get the text of the calling thread's context, to add to the metadata of an entry in text form: @c ",key=value"
+     * for each pair, with the values escaped.
+     *
+     * @return The text of the calling thread's context.  Empty if it has none.
+     */
+    static const std::string& getText();
+
+    /**
+     * Get the pairs of the calling thread's context, to add to an entry in binary form: each key and value, unescaped
+     * and followed by a null character.
+     *
+     * @return The pairs of the calling thread's context.  Empty if it has none.
+     */
+    static const std::string& getPairs();
+
+private:
+    /// A copy of a thread's context, for @c bind().
+    struct Snapshot {
+        /// The text of the context.
+        std::string text;
+
+        /// The pairs of the context.
+        std::string pairs;
+    };
+
+    /**
+     * Constructor.  Adds the pairs of a snapshot to the context of the calling thread.
+     *
+     * @param snapshot The snapshot.
+     */
+    explicit LogContext(const Snapshot& snapshot);
+
+    /**
+     * Add a pair to the context of the calling thread.
+     *
+     * @param key The key of the pair.
+     * @param value The value of the pair.
+     * @param length The length of @c value.
+     */
+    void push(const char* key, const char* value, size_t length);
+
+    /// The length of the text of the calling thread's context before this scope started.
+    size_t m_previousTextSize;
+
+    /// The length of the pairs of the calling thread's context before this scope started.
+    size_t m_previousPairsSize;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTEXT_H_
@@ -0,0 +1,193 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTROL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTROL_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Keeps the levels of each @c ModuleLogger in a memory mapped file, so that they can be changed from outside the
+ * process while it runs:
+ *
+ *     LogLevelControl set acsdkAudioPlayer DEBUG9
+ *
+ * The file has a slot for each module, holding the levels that the module's @c ModuleLogger reads when deciding
+ * whether to build and forward an entry.  @c Logger::shouldLog() reads its level straight from the slot, so checking
+ * the level is still a single atomic load, and a level written to the file takes effect on the next entry logged,
+ * without a thread polling the file or a system call on the logging path.
+ *
+ * A level set from outside the process overrides the levels of the module's configuration and of the sink, until it
+ * is cleared.  Changes the process makes to those levels are still written to the slot, so that clearing the
+ * override returns the module to them.  The flight recorder and backtrace levels are kept as they are.  Entries
+ * forwarded below the levels of the configuration and the sink are passed to @c Logger::emitUnfiltered(), so that
+ * when the sink is a @c MultiSinkLogger, it passes them to each of its sinks rather than dropping them.
+ *
+ * The file is enabled by the presence of the @c "logControl" configuration object:
+ *
+ *     "logControl" : {
+ *         "path" : "/dev/shm/avsLogControl",
+ *         "moduleCount" : 512
+ *     }
+ *
+ * The default path is @c "/dev/shm/avsLogControl." followed by the identifier of the process, so that processes
+ * do not share a file.  An existing file at a configured path is unlinked rather than overwritten, so that a process
+ * still mapping it is not affected, unless the process that created it is still running, in which case the file is
+ * left to it and log control is not enabled.  The file is unlinked when the process exits.  Use the
+ * @c LogLevelControl tool, or @c readModules() and @c setOverride(), to inspect and change the levels.
+ */
+class LogControl {
+public:
+    /// The longest name of a module that the file can hold.  Longer names are truncated.
+    static constexpr size_t MAX_MODULE_NAME_LENGTH = 43;
+
+    /// The levels of a module, shared with processes that change them.
+    struct Slot {
+        /// The name of the module, null terminated.
+        char name[MAX_MODULE_NAME_LENGTH + 1];
+
+        /// The lowest level of entries that the module's @c ModuleLogger builds.
+        std::atomic<Level> level;
+
+        /// The lowest level of entries that the module's @c ModuleLogger forwards to the sink.
+        std::atomic<Level> forwardLevel;
+
+        /// The level to forward entries at, from the module's configuration and the sink, if there is no override.
+        std::atomic<Level> configuredLevel;
+
+        /// The lowest level of entries wanted by the flight recorder or the backtrace buffer.
+        std::atomic<Level> recordLevel;
+
+        /// The level set from outside the process, or @c Level::UNKNOWN if there is none.
+        std::atomic<Level> overrideLevel;
+    };
+
+    /// The levels of a module read back from a log control file.
+    struct Module {
+        /// The name of the module.
+        std::string name;
+
+        /// The lowest level of entries that the module builds.
+        Level level;
+
+        /// The lowest level of entries that the module forwards to the sink.
+        Level forwardLevel;
+
+        /// The level to forward entries at if there is no override.
+        Level configuredLevel;
+
+        /// The level set from outside the process, or @c Level::UNKNOWN if there is none.
+        Level overrideLevel;
+    };
+
+    /**
+     * Return the one and only @c LogControl instance.  It is never destroyed, so that the slots of loggers that
+     * outlive it stay mapped.
+     *
+     * @return The one and only @c LogControl instance, or @c nullptr if it is not enabled or its file could not be
+     * created.
+     */
+    static LogControl* instance();
+
+    /**
+     * Get the slot of a module, claiming a free one if it does not have one yet.  Loggers of the same module share
+     * its slot.
+     *
+     * @param name The name of the module.
+     * @return The slot, or @c nullptr if every slot is in use.
+     */
+    Slot* claimSlot(const std::string& name);
+
+    /**
+     * Set the levels a module forwards and builds entries at, from the levels the process has chosen for it and
+     * the override in its slot.
+     *
+     * @param slot The slot of the module.
+     * @param configuredLevel The level to forward entries at if there is no override.
+     * @param recordLevel The lowest level of entries wanted by the flight recorder or the backtrace buffer.
+     */
+    static void update(Slot* slot, Level configuredLevel, Level recordLevel);
+
+    /**
+     * Read the modules of a log control file.  The file may be read while it is in use.
+     *
+     * @param path The path of the file.
+     * @param[out] pid The identifier of the process that created the file.
+     * @param[out] modules The modules in the file, in the order they claimed their slots.
+     * @param[out] error If the file could not be read, why.
+     * @return Whether the file was read.
+     */
+    static bool readModules(const std::string& path, int32_t* pid, std::vector<Module>* modules, std::string* error);
+
+    /**
+     * Override the level that a module forwards entries at, while it is in use.
+     *
+     * @param path The path of the file.
+     * @param name The name of the module.
+     * @param level The level to forward entries at, or @c Level::UNKNOWN to clear the override.
+     * @param[out] error If the level could not be set, why.
+     * @return Whether the level was set.
+     */
+    static bool setOverride(const std::string& path, const std::string& name, Level level, std::string* error);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param data The mapping of the file.
+     */
+    explicit LogControl(char* data);
+
+    /**
+     * Create the instance from the @c "logControl" configuration object.
+     *
+     * @return The instance, or @c nullptr if it is not enabled or its file could not be created.
+     */
+    static LogControl* create();
+
+    /**
+     * Set the levels a module forwards and builds entries at from the levels in its slot.
+     *
+     * @param slot The slot of the module.
+     */
+    static void apply(Slot* slot);
+
+    /// The mapping of the file.
+    char* const m_data;
+
+    /// Serializes claiming slots.
+    std::mutex m_mutex;
+
+    /// Whether running out of slots has been reported, so that it is reported once rather than for every module.
+    bool m_isFullReported;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGCONTROL_H_
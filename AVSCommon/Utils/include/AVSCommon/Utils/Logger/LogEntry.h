@@ -17,20 +17,103 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGENTRY_H_
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
+#include "AVSCommon/Utils/Logger/HexDump.h"
+#include "AVSCommon/Utils/Logger/LogEntryRecord.h"
 #include "AVSCommon/Utils/Logger/LogEntryStream.h"
+#include "AVSCommon/Utils/Logger/NumberFormatting.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace logger {
 
-/// LogEntry is used to compile the log entry text to log via Logger.
+/// Helpers used by @c LogEntry to decide how to format enum values.
+namespace enumFormatting {
+
+/// Returned by the fallback @c operator<< below, so that calls which resolve to it can be detected.
+struct NoStreamOperator {};
+
+/**
+ * Fallback @c operator<< for enums.  Never defined.  Overload resolution prefers it to the implicit conversion of an
+ * unscoped enum to an integer, but prefers an @c operator<< declared for the enum itself to it.
+ */
+template <typename EnumType, typename = typename std::enable_if<std::is_enum<EnumType>::value>::type>
+NoStreamOperator operator<<(std::ostream& stream, const EnumType& value);
+
+/**
+ * How a value of a type is formatted if it is an enum.
+ *
+ * @tparam Type The type of the value.
+ */
+template <typename Type, bool IsEnum = std::is_enum<Type>::value>
+struct EnumTraits {
+    /// Whether the value is formatted as an integer rather than with @c operator<<.
+    using FormatAsInteger = std::false_type;
+    /// The integer type the value is formatted as.
+    using IntegerType = Type;
+};
+
+/**
+ * How an enum value is formatted.  Enums with their own @c operator<< are formatted with it, and all others as
+ * their underlying integer value, which is what @c std::ostream does for an unscoped enum.
+ *
+ * @tparam Type The enum type.
+ */
+template <typename Type>
+struct EnumTraits<Type, true> {
+    /// Whether the value is formatted as an integer rather than with @c operator<<.
+    using FormatAsInteger = std::is_same<
+        decltype(operator<<(std::declval<std::ostream&>(), std::declval<const Type&>())),
+        NoStreamOperator>;
+    /// The integer type the value is formatted as.
+    using IntegerType = typename std::underlying_type<Type>::type;
+};
+
+}  // namespace enumFormatting
+
+/**
+ * LogEntry is used to compile the log entry text to log via Logger.
+ *
+ * By default the text is formatted as keys and values are added.  If the capture mode has been set to
+ * @c CaptureMode::BINARY, keys and values are instead captured in a @c LogEntryRecord and only formatted when a
+ * sink asks for the text, which sinks that defer their output (e.g. @c AsyncLogger) do on another thread.
+ */
 class LogEntry {
 public:
+    /// The ways in which a @c LogEntry may capture its contents.
+    enum class CaptureMode {
+        /// Format keys and values into text as they are added.
+        TEXT,
+        /**
+         * Capture keys and values in a @c LogEntryRecord and format them when the text is needed.  Keys and
+         * events passed as @c const @c char* are captured as pointers, which are valid until the entry has been
+         * delivered to its sinks.  Sinks that format the entry after that keep a copy of the record that holds
+         * copies of those strings (see @c LogEntryRecord::copyDetached()).
+         */
+        BINARY
+    };
+
+    /**
+     * Set the capture mode used by @c LogEntry instances created after this call.
+     *
+     * @param mode The capture mode to use.
+     */
+    static void setCaptureMode(CaptureMode mode);
+
+    /**
+     * Get the capture mode used by newly created @c LogEntry instances.
+     *
+     * @return The capture mode used by newly created @c LogEntry instances.
+     */
+    static CaptureMode getCaptureMode();
+
     /**
      * Constructor.
      *
@@ -47,6 +130,9 @@ public:
      */
     LogEntry(const std::string& source, const std::string& event);
 
+    /// Destructor.
+    ~LogEntry();
+
     /**
      * Add a @c key, @c value pair to the metadata of this log entry.
      *
@@ -140,7 +226,7 @@ public:
      * @param value The value to add to this LogEntry, obfuscated if needed.
      * @return This instance to facilitate adding more information to this log entry.
      */
-    inline LogEntry& obfuscatePrivateData(const char* key, const std::string& value);
+    LogEntry& obfuscatePrivateData(const char* key, const std::string& value);
 
     /**
      * Add an arbitrary message to the end of the text of this LogEntry.  Once this has been called no other
@@ -160,6 +246,17 @@ public:
      */
     LogEntry& m(const std::string& message);
 
+    /**
+     * Add a @c key, @c value pair to the metadata of this log entry, ahead of its message if @c m() has already
+     * been called.  Used to annotate an entry that the caller has already built.
+     *
+     * @param key The key identifying the value to add to this LogEntry.
+     * @param value The value to add to this LogEntry.
+     * @return This instance to facilitate passing this instance on.
+     */
+    template <typename ValueType>
+    LogEntry& insertBeforeMessage(const char* key, const ValueType& value);
+
     /**
      * Add pointer (hence the name 'p') in the form of a @c key, address of the object pointed to by the shared_ptr @c
      * ptr to the metadata of this log entry.
@@ -181,6 +278,20 @@ public:
      */
     LogEntry& p(const char* key, void* ptr);
 
+    /**
+     * Add a range of bytes, such as a packet payload, to this log entry as a hex dump.  The metadata gets a @c key,
+     * @c size pair, and the dump follows the message, with each row on a line of its own that starts with @c key and
+     * is in the format of @c formatHexDump().  The bytes are copied, and the dump is only rendered when a sink asks
+     * for the text of the entry, so this costs little more than the copy if no sink does.
+     *
+     * @param key The key identifying the bytes.  Must outlive the entry, as a string literal does.
+     * @param data The bytes to add.
+     * @param size The number of bytes in @c data.
+     * @param width The number of bytes in each row of the dump.
+     * @return This instance to facilitate adding more information to this log entry.
+     */
+    LogEntry& dump(const char* key, const void* data, size_t size, size_t width = DEFAULT_HEX_DUMP_WIDTH);
+
     /**
      * Get the rendered text of this LogEntry.
      *
@@ -189,21 +300,238 @@ public:
      */
     const char* c_str() const;
 
+    /**
+     * Get whether this entry was captured in binary form.
+     *
+     * @return Whether this entry was captured in binary form, in which case @c record() holds its contents.
+     */
+    bool isBinary() const;
+
+    /**
+     * Get the binary capture of this entry.  Only meaningful if @c isBinary() returns @c true.
+     *
+     * @return The binary capture of this entry.
+     */
+    const LogEntryRecord& record() const;
+
 private:
+    /// Tag type for values formatted as signed integers.
+    using SignedTag = std::integral_constant<int, 0>;
+
+    /// Tag type for values formatted as unsigned integers.
+    using UnsignedTag = std::integral_constant<int, 1>;
+
+    /// Tag type for values formatted as doubles.
+    using DoubleTag = std::integral_constant<int, 2>;
+
+    /// Tag type for values formatted as floats.
+    using FloatTag = std::integral_constant<int, 3>;
+
+    /// Tag type for values formatted as pointers.
+    using PointerTag = std::integral_constant<int, 4>;
+
+    /// Tag type for values that are formatted with @c operator<<.
+    using StreamedTag = std::integral_constant<int, 5>;
+
+    /**
+     * Whether a type is a character type, which @c std::ostream formats as a character rather than as a number.
+     *
+     * @tparam Type The type to check.
+     */
+    template <typename Type>
+    using IsCharacter = std::integral_constant<
+        bool,
+        std::is_same<Type, char>::value || std::is_same<Type, signed char>::value ||
+            std::is_same<Type, unsigned char>::value || std::is_same<Type, wchar_t>::value ||
+            std::is_same<Type, char16_t>::value || std::is_same<Type, char32_t>::value>;
+
+    /**
+     * Whether a type is a pointer that @c std::ostream formats as an address.  Pointers to characters are formatted
+     * as strings, and pointers to functions as booleans.
+     *
+     * @tparam Type The type to check.
+     */
+    template <typename Type>
+    using IsAddress = std::integral_constant<
+        bool,
+        std::is_pointer<Type>::value && !std::is_function<typename std::remove_pointer<Type>::type>::value &&
+            !IsCharacter<typename std::remove_cv<typename std::remove_pointer<Type>::type>::type>::value>;
+
+    /**
+     * Select the tag for formatting an integer of the given type.
+     *
+     * @tparam Type The integer type.
+     */
+    template <typename Type>
+    using IntegerTag = typename std::conditional<std::is_signed<Type>::value, SignedTag, UnsignedTag>::type;
+
+    /**
+     * Select the tag for formatting a value of the given type that is not formatted as an integer.
+     *
+     * @tparam Type The type of the value.
+     */
+    template <typename Type>
+    using NonIntegerTag = typename std::conditional<
+        std::is_same<Type, double>::value,
+        DoubleTag,
+        typename std::conditional<
+            std::is_same<Type, float>::value,
+            FloatTag,
+            typename std::conditional<IsAddress<Type>::value, PointerTag, StreamedTag>::type>::type>::type;
+
+    /**
+     * Select the tag for how a value of the given type is formatted, or captured in binary mode.  Numbers, pointers
+     * and enums without their own @c operator<< are formatted by @c NumberFormatting, and anything else with
+     * @c operator<<.
+     *
+     * @tparam Type The type of the value.
+     */
+    template <typename Type>
+    using ValueTag = typename std::conditional<
+        std::is_integral<Type>::value && !IsCharacter<Type>::value,
+        IntegerTag<Type>,
+        typename std::conditional<
+            enumFormatting::EnumTraits<Type>::FormatAsInteger::value,
+            IntegerTag<typename enumFormatting::EnumTraits<Type>::IntegerType>,
+            NonIntegerTag<Type>>::type>::type;
+
+    /**
+     * Append a signed integer value to the text of this entry.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, SignedTag);
+
+    /**
+     * Append an unsigned integer value to the text of this entry.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, UnsignedTag);
+
+    /**
+     * Append a double value to the text of this entry.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, DoubleTag);
+
+    /**
+     * Append a float value to the text of this entry.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, FloatTag);
+
+    /**
+     * Append a pointer value to the text of this entry.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, PointerTag);
+
+    /**
+     * Append a value to the text of this entry with @c operator<<.
+     *
+     * @param value The value to append.
+     */
+    template <typename ValueType>
+    void appendValue(const ValueType& value, StreamedTag);
+
+    /**
+     * Capture a signed integer value.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, SignedTag);
+
+    /**
+     * Capture an unsigned integer value.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, UnsignedTag);
+
+    /**
+     * Capture a double value.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, DoubleTag);
+
+    /**
+     * Capture a float value.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, FloatTag);
+
+    /**
+     * Capture a pointer value.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, PointerTag);
+
+    /**
+     * Capture a value by formatting it with @c operator<<.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     */
+    template <typename ValueType>
+    void captureValue(const char* key, const ValueType& value, StreamedTag);
+
+    /**
+     * Capture a string value that will be escaped when it is rendered.
+     *
+     * @param key The key identifying the value.
+     * @param copyKey Whether @c key needs to be copied into the record.
+     * @param value The value to capture.
+     */
+    void captureString(const char* key, bool copyKey, const char* value);
+
+    /**
+     * Get the stream used to accumulate the text of this entry, constructing it if needed.
+     *
+     * @return The stream used to accumulate the text of this entry.
+     */
+    LogEntryStream& stream() const;
+
+    /// Add the pairs of the calling thread's @c LogContext to the metadata of this LogEntry.
+    void addContext();
+
     /// Add the appropriate prefix for a key,value pair that is about to be appended to the text of this LogEntry.
     void prefixKeyValuePair();
 
     /// Add the appropriate prefix for an arbitrary message that is about to be appended to the text of this LogEntry.
     void prefixMessage();
 
-    /// Return a list of labels we will obfuscate if sent to obfuscatePrivateData
-    static std::vector<std::string> getPrivateLabelDenyList() {
-        static std::vector<std::string> privateLabelDenyList = {"ssid"};
-        return privateLabelDenyList;
-    }
+    /**
+     * Remove the message from the text of this LogEntry, in @c CaptureMode::TEXT, so that metadata can be added
+     * before the message is added back.
+     *
+     * @return The message.  Only valid until the calling thread next calls this method.
+     */
+    const std::string& detachMessage();
 
     /**
-     * Append an escaped string to m_stream.
+     * Append an escaped string to the stream.
      * Our metadata and subsequent optional message is of the form:
      *     <key>=<value>[,<key>=<value>]:[<message>]
      * ...so we need to reserve ',', '=' and ':'.  We escape those vales with '\' so we escape '\' as well.
@@ -218,17 +546,128 @@ private:
     /// Flag indicating (if true) that some metadata has already been appended to this LogEntry.
     bool m_hasMetadata;
 
-    /// A stream with which to accumulate the text for this LogEntry.
-    LogEntryStream m_stream;
+    /// Whether this entry is captured in @c m_record rather than formatted into text as it is built.
+    const bool m_isBinary;
+
+    /// Whether @c m_streamStorage holds a constructed @c LogEntryStream.
+    mutable bool m_hasStream;
+
+    /// Whether the hex dumps of this LogEntry have been added to its text, in @c CaptureMode::TEXT.
+    mutable bool m_hasRenderedDumps;
+
+    /// Where the message section starts in the text of this LogEntry, or zero if it has no message.
+    size_t m_messageOffset;
+
+    /**
+     * Storage for the stream with which to accumulate the text for this LogEntry.  The stream is constructed
+     * up front in @c CaptureMode::TEXT, and only if @c c_str() is called in @c CaptureMode::BINARY.
+     */
+    mutable typename std::aligned_storage<sizeof(LogEntryStream), alignof(LogEntryStream)>::type m_streamStorage;
+
+    /**
+     * The binary capture of this LogEntry.  In @c CaptureMode::TEXT, only holds the bytes added with @c dump(), if
+     * any, until they are rendered.
+     */
+    LogEntryRecord m_record;
 };
 
 template <typename ValueType>
 LogEntry& LogEntry::d(const char* key, const ValueType& value) {
+    if (m_isBinary) {
+        captureValue(key, value, ValueTag<ValueType>());
+        return *this;
+    }
     prefixKeyValuePair();
-    m_stream << key << KEY_VALUE_SEPARATOR << value;
+    stream() << key << KEY_VALUE_SEPARATOR;
+    appendValue(value, ValueTag<ValueType>());
     return *this;
 }
 
+template <typename ValueType>
+LogEntry& LogEntry::insertBeforeMessage(const char* key, const ValueType& value) {
+    // Records render their metadata ahead of their message whatever order they were captured in.
+    if (m_isBinary || 0 == m_messageOffset) {
+        return d(key, value);
+    }
+    auto& message = detachMessage();
+    d(key, value);
+    return m(message);
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, SignedTag) {
+    auto& out = stream();
+    out.commit(formatInt64(static_cast<int64_t>(value), out.reserve(MAX_FORMATTED_NUMBER_SIZE)));
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, UnsignedTag) {
+    auto& out = stream();
+    out.commit(formatUint64(static_cast<uint64_t>(value), out.reserve(MAX_FORMATTED_NUMBER_SIZE)));
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, DoubleTag) {
+    auto& out = stream();
+    out.commit(formatDouble(value, out.reserve(MAX_FORMATTED_NUMBER_SIZE)));
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, FloatTag) {
+    auto& out = stream();
+    out.commit(formatFloat(value, out.reserve(MAX_FORMATTED_NUMBER_SIZE)));
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, PointerTag) {
+    auto& out = stream();
+    out.commit(formatPointer(static_cast<const void*>(value), out.reserve(MAX_FORMATTED_NUMBER_SIZE)));
+}
+
+template <typename ValueType>
+void LogEntry::appendValue(const ValueType& value, StreamedTag) {
+    stream() << value;
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, SignedTag) {
+    m_record.beginField(LogEntryRecord::FieldType::INT64, key, false);
+    m_record.appendInt64(static_cast<int64_t>(value));
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, UnsignedTag) {
+    m_record.beginField(LogEntryRecord::FieldType::UINT64, key, false);
+    m_record.appendUint64(static_cast<uint64_t>(value));
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, DoubleTag) {
+    m_record.beginField(LogEntryRecord::FieldType::DOUBLE, key, false);
+    m_record.appendDouble(value);
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, FloatTag) {
+    m_record.beginField(LogEntryRecord::FieldType::FLOAT, key, false);
+    m_record.appendFloat(value);
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, PointerTag) {
+    m_record.beginField(LogEntryRecord::FieldType::POINTER, key, false);
+    m_record.appendPointer(static_cast<const void*>(value));
+}
+
+template <typename ValueType>
+void LogEntry::captureValue(const char* key, const ValueType& value, StreamedTag) {
+    m_record.beginField(LogEntryRecord::FieldType::TEXT, key, false);
+    LogEntryStream text;
+    text << value;
+    auto textString = text.c_str();
+    m_record.appendText(textString, strlen(textString));
+}
+
 template <typename PtrType>
 LogEntry& LogEntry::p(const char* key, const std::shared_ptr<PtrType>& ptr) {
     return d(key, ptr.get());
@@ -248,36 +687,6 @@ LogEntry& LogEntry::sensitive(const char*, const ValueType&) {
 }
 #endif
 
-LogEntry& LogEntry::obfuscatePrivateData(const char* key, const std::string& value) {
-    // if value contains any  private label, obfuscate the section after the label
-    // since it can (but shouldn't) contain multiple,  obfuscate from the earliest one found onward
-    auto firstPosition = value.length();
-
-    for (auto privateLabel : getPrivateLabelDenyList()) {
-        auto it = std::search(
-            value.begin(),
-            value.end(),
-            privateLabel.begin(),
-            privateLabel.end(),
-            [](char valueChar, char denyListChar) { return std::tolower(valueChar) == std::tolower(denyListChar); });
-        if (it != value.end()) {
-            // capture the least value
-            auto thisPosition = std::distance(value.begin(), it) + privateLabel.length();
-            if (thisPosition < firstPosition) {
-                firstPosition = thisPosition;
-            }
-        }
-    }
-
-    if (firstPosition <= value.length()) {
-        // hash everything after the label itself
-        auto labelPart = value.substr(0, firstPosition);
-        auto obfuscatedPart = std::to_string(std::hash<std::string>{}(value.substr(firstPosition)));
-        return d(key, labelPart + obfuscatedPart);
-    }
-    return d(key, value);
-}
-
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
@@ -49,6 +49,38 @@ public:
 
     int_type overflow(int_type ch) override;
 
+    std::streamsize xsputn(const char_type* s, std::streamsize count) override;
+
+    /**
+     * Get space to write up to @c count characters directly to the end of the buffer.  The characters are only
+     * appended once @c commit() is called.
+     *
+     * @param count The number of characters that will be written.
+     * @return Where to write the characters.  Only valid until the buffer is next modified.
+     */
+    char* reserve(size_t count);
+
+    /**
+     * Append characters that have been written to the space returned by @c reserve().
+     *
+     * @param count The number of characters to append.  Must not exceed the count passed to @c reserve().
+     */
+    void commit(size_t count);
+
+    /**
+     * Get the number of characters in the buffer.
+     *
+     * @return The number of characters in the buffer.
+     */
+    size_t size() const;
+
+    /**
+     * Discard the characters past a given size.
+     *
+     * @param size The number of characters to keep.  Must not exceed @c size().
+     */
+    void truncate(size_t size);
+
     /**
      * Access the contents of the accumulated buffer as a string.
      * @return The contents of the accumulated buffer as a string. The pointer returned is only guaranteed to be
@@ -57,6 +89,13 @@ public:
     const char* c_str() const;
 
 private:
+    /**
+     * Grow the buffer so that at least @c count more characters can be appended.
+     *
+     * @param count The number of characters that need to fit.
+     */
+    void grow(size_t count);
+
     /// A small embedded buffer used unless the data to be buffered grows beyond its capacity.
     char m_smallBuffer[ACSDK_LOG_ENTRY_BUFFER_SMALL_BUFFER_SIZE];
 
@@ -0,0 +1,372 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGENTRYRECORD_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGENTRYRECORD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * The size of @c LogEntryRecord::m_smallBuffer.  Like @c LogEntryBuffer, instances of @c LogEntryRecord are expected
+ * to be allocated on the stack, so this is sized for typical entries rather than the largest ones.
+ *
+ * #ifndef used here to allow overriding this value from the compiler command line.
+ */
+#ifndef ACSDK_LOG_ENTRY_RECORD_SMALL_BUFFER_SIZE
+#define ACSDK_LOG_ENTRY_RECORD_SMALL_BUFFER_SIZE 192
+#endif
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A compact binary capture of the contents of a @c LogEntry.
+ *
+ * Rather than formatting keys and values into text as they are added, a @c LogEntryRecord appends the raw typed
+ * values to a contiguous buffer.  The buffer can be copied as a block (e.g. into the queue of an asynchronous sink)
+ * and rendered into the usual @c source:event:key=value,...:message text later, by whichever sink consumes it.
+ *
+ * Strings passed as @c const @c char* keys and events are stored as pointers, so that capturing the usual string
+ * literals does not copy them.  A record may therefore only be rendered while they are valid, which is the case
+ * until the entry has been delivered to its sinks.  A sink that renders a record later must keep a copy made with
+ * @c copyDetached(), which holds copies of those strings instead.  Keys and events passed as @c std::string, the
+ * source, and all string values are always copied into the record.
+ */
+class LogEntryRecord {
+public:
+    /// The types of field that may appear in a record.
+    enum class FieldType : uint8_t {
+        /// A signed integer value.
+        INT64,
+        /// An unsigned integer value.
+        UINT64,
+        /// A double precision floating point value.
+        DOUBLE,
+        /// A single precision floating point value.
+        FLOAT,
+        /// A pointer value, rendered as an address.
+        POINTER,
+        /// A string value that is escaped when rendered.
+        STRING,
+        /// A value that was already rendered to text and is not escaped when rendered.
+        TEXT,
+        /// The free-form message at the end of the entry.  Has no key.
+        MESSAGE,
+        /// A copy of a range of bytes, rendered as its size in the metadata and as a hex dump after the message.
+        BYTES
+    };
+
+    /// A field read back from a record.
+    struct Field {
+        /// The type of this field.
+        FieldType type;
+
+        /// The key of this field.  Not null terminated.  Empty for @c FieldType::MESSAGE.
+        const char* key;
+
+        /// The length of @c key.
+        size_t keyLength;
+
+        /// The value of an @c INT64 field.
+        int64_t int64Value;
+
+        /// The value of a @c UINT64 field.
+        uint64_t uint64Value;
+
+        /// The value of a @c DOUBLE field.
+        double doubleValue;
+
+        /// The value of a @c FLOAT field.
+        float floatValue;
+
+        /// The value of a @c POINTER field.
+        const void* pointerValue;
+
+        /// The value of a @c STRING, @c TEXT, @c MESSAGE or @c BYTES field.  Not null terminated.
+        const char* text;
+
+        /// The length of @c text.
+        size_t textLength;
+
+        /// The number of bytes in each row of the hex dump of a @c BYTES field.
+        size_t rowWidth;
+    };
+
+    /**
+     * Class used to read back the contents of a record from its serialized bytes.
+     */
+    class Reader {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param data The bytes of a record, as returned by @c LogEntryRecord::data().
+         * @param size The number of bytes in @c data.
+         */
+        Reader(const char* data, size_t size);
+
+        /**
+         * Get the source of the entry.
+         *
+         * @param[out] length The length of the returned string.
+         * @return The source of the entry.  Not null terminated.
+         */
+        const char* source(size_t* length) const;
+
+        /**
+         * Get the event of the entry.
+         *
+         * @param[out] length The length of the returned string.
+         * @return The event of the entry.  Not null terminated.
+         */
+        const char* event(size_t* length) const;
+
+        /**
+         * Read the next field of the entry.
+         *
+         * @param[out] field The field that was read.
+         * @return Whether a field was read.  @c false once all fields have been read.
+         */
+        bool next(Field* field);
+
+    private:
+        /**
+         * Read a string reference from the current position.
+         *
+         * @param[out] length The length of the string.
+         * @return The string.  Not null terminated.
+         */
+        const char* readString(size_t* length);
+
+        /**
+         * Read a value from the current position.
+         *
+         * @tparam Type The type of the value to read.
+         * @return The value.
+         */
+        template <typename Type>
+        Type read();
+
+        /// The current read position.
+        const char* m_position;
+
+        /// The end of the record.
+        const char* m_end;
+
+        /// The source of the entry.
+        const char* m_source;
+
+        /// The length of @c m_source.
+        size_t m_sourceLength;
+
+        /// The event of the entry.
+        const char* m_event;
+
+        /// The length of @c m_event.
+        size_t m_eventLength;
+    };
+
+    /// Construct an empty record.
+    LogEntryRecord();
+
+    /// Deleted copy constructor.  The contents of a record are copied with @c data() and @c size().
+    LogEntryRecord(const LogEntryRecord&) = delete;
+
+    /// Deleted assignment operator.
+    LogEntryRecord& operator=(const LogEntryRecord&) = delete;
+
+    /**
+     * Start the record with the source and event of the entry.  Must be called once, before adding any fields.
+     *
+     * @param source The name of the source of the entry.  Copied into the record.
+     * @param event The name of the event.  Stored as a pointer.  May be null.
+     */
+    void start(const std::string& source, const char* event);
+
+    /**
+     * Start the record with the source and event of the entry.  Must be called once, before adding any fields.
+     *
+     * @param source The name of the source of the entry.  Copied into the record.
+     * @param event The name of the event.  Copied into the record.
+     */
+    void start(const std::string& source, const std::string& event);
+
+    /**
+     * Begin a field.  Must be followed by exactly one call to the @c append method matching @c type.
+     *
+     * @param type The type of the field.
+     * @param key The key of the field.
+     * @param copyKey Whether to copy @c key into the record rather than storing a pointer to it.
+     */
+    void beginField(FieldType type, const char* key, bool copyKey);
+
+    /**
+     * Append the value of an @c INT64 field.
+     *
+     * @param value The value to append.
+     */
+    void appendInt64(int64_t value);
+
+    /**
+     * Append the value of a @c UINT64 field.
+     *
+     * @param value The value to append.
+     */
+    void appendUint64(uint64_t value);
+
+    /**
+     * Append the value of a @c DOUBLE field.
+     *
+     * @param value The value to append.
+     */
+    void appendDouble(double value);
+
+    /**
+     * Append the value of a @c FLOAT field.
+     *
+     * @param value The value to append.
+     */
+    void appendFloat(float value);
+
+    /**
+     * Append the value of a @c POINTER field.
+     *
+     * @param value The value to append.
+     */
+    void appendPointer(const void* value);
+
+    /**
+     * Append the value of a @c STRING or @c TEXT field.
+     *
+     * @param value The string to copy into the record.
+     * @param length The length of @c value.
+     */
+    void appendText(const char* value, size_t length);
+
+    /**
+     * Add a @c MESSAGE field.
+     *
+     * @param message The message to copy into the record.
+     * @param length The length of @c message.
+     */
+    void addMessage(const char* message, size_t length);
+
+    /**
+     * Append the value of a @c BYTES field, after @c beginField().
+     *
+     * @param data The bytes to copy into the record.
+     * @param size The number of bytes in @c data.
+     * @param rowWidth The number of bytes in each row of the hex dump.
+     */
+    void appendBytes(const void* data, size_t size, size_t rowWidth);
+
+    /**
+     * Get the serialized bytes of this record.
+     *
+     * @return The serialized bytes of this record.  Only valid while the record is not modified.
+     */
+    const char* data() const;
+
+    /**
+     * Get the number of serialized bytes in this record.
+     *
+     * @return The number of serialized bytes in this record.
+     */
+    size_t size() const;
+
+    /**
+     * Append a copy of a serialized record to a string, with any keys and events stored as pointers copied into it,
+     * so that the copy can be rendered after they are gone.
+     *
+     * @param data The bytes of the record.
+     * @param size The number of bytes in @c data.
+     * @param[out] out The string to append the copy to.
+     */
+    static void copyDetached(const char* data, size_t size, std::string* out);
+
+    /**
+     * Render a serialized record in the @c source:event:key=value,...:message format used by @c LogEntry.
+     *
+     * @param data The bytes of the record.
+     * @param size The number of bytes in @c data.
+     * @param[out] out The string to append the rendered text to.
+     */
+    static void render(const char* data, size_t size, std::string* out);
+
+    /**
+     * Render a serialized record in the @c source:event:key=value,...:message format used by @c LogEntry.
+     *
+     * @param data The bytes of the record.
+     * @param size The number of bytes in @c data.
+     * @param stream The stream to write the rendered text to.
+     */
+    static void render(const char* data, size_t size, std::ostream& stream);
+
+    /**
+     * Render only the hex dumps of the @c BYTES fields of a serialized record, each row on a line of its own that
+     * starts with the key of the field.  Each line is preceded, rather than followed, by a newline.
+     *
+     * @param data The bytes of the record.
+     * @param size The number of bytes in @c data.
+     * @param stream The stream to write the rendered text to.
+     */
+    static void renderDumps(const char* data, size_t size, std::ostream& stream);
+
+private:
+    /**
+     * Append bytes to the record.
+     *
+     * @param bytes The bytes to append.
+     * @param count The number of bytes to append.
+     */
+    void append(const void* bytes, size_t count);
+
+    /**
+     * Append a string reference to the record.
+     *
+     * @param value The string.
+     * @param copy Whether to copy the string into the record rather than storing a pointer to it.
+     */
+    void appendString(const char* value, bool copy);
+
+    /// A small embedded buffer used unless the record grows beyond its capacity.
+    char m_smallBuffer[ACSDK_LOG_ENTRY_RECORD_SMALL_BUFFER_SIZE];
+
+    /// Pointer to the start of whatever memory the record has accumulated in.
+    char* m_base;
+
+    /// The number of bytes in the record.
+    size_t m_size;
+
+    /// The capacity of the memory at @c m_base.
+    size_t m_capacity;
+
+    /// A resizable buffer used if and when the record has grown beyond @c m_smallBuffer.
+    std::unique_ptr<std::vector<char>> m_largeBuffer;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGENTRYRECORD_H_
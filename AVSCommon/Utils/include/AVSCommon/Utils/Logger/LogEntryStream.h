@@ -41,6 +41,14 @@ public:
      * for the lifetime of this LogEntryStream, and only as long as no further modifications are made to it.
      */
     const char* c_str() const;
+
+    /// Values such as numbers are formatted directly into the underlying buffer with these.
+    using LogEntryBuffer::commit;
+    using LogEntryBuffer::reserve;
+
+    /// The message of an entry is moved with these when metadata is inserted ahead of it.
+    using LogEntryBuffer::size;
+    using LogEntryBuffer::truncate;
 };
 
 }  // namespace logger
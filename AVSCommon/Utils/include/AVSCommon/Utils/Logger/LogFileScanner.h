@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGFILESCANNER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGFILESCANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/LogParser.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// The entries to select from a log file.  Empty lists select everything.
+struct LogFilter {
+    /// A key, and optionally the value it must have.
+    struct KeyFilter {
+        /// The key.
+        std::string key;
+
+        /// Whether the key must have @c value, rather than just be present.
+        bool hasValue;
+
+        /// The value the key must have, without escapes.
+        std::string value;
+    };
+
+    /**
+     * Constructor.
+     */
+    LogFilter();
+
+    /**
+     * Check whether a line is selected.
+     *
+     * @param line The line.
+     * @return Whether @c line is selected.
+     */
+    bool matches(const ParsedLogLine& line) const;
+
+    /// Entries from any of these sources are selected.
+    std::vector<std::string> sources;
+
+    /// Entries with any of these events are selected.
+    std::vector<std::string> events;
+
+    /// Entries with all of these keys are selected.
+    std::vector<KeyFilter> keys;
+
+    /// Entries at or after this time, in milliseconds since the epoch, are selected.
+    int64_t from;
+
+    /// Entries before this time, in milliseconds since the epoch, are selected.
+    int64_t to;
+};
+
+/**
+ * Searches a log file written by @c ConsoleLogger or @c FileLogger for the entries selected by a @c LogFilter.
+ *
+ * The file is mapped rather than read, and split in to blocks of about a megabyte that start at entries.  Blocks are
+ * searched by a pool of threads, and the entries found are returned in file order, as spans in to the mapping.  An
+ * entry is a line along with any following lines that do not start with a date and time, e.g. from a message with
+ * newlines in it.
+ *
+ * To speed up repeated searches, a sidecar index can be written next to the file, as @c "<path>.idx".  For each block
+ * it records the range of times of the entries and a Bloom filter of their sources, events and keys, so that blocks
+ * that cannot hold a selected entry are skipped without being read.  An index only applies to the file as it was
+ * when the index was written.
+ */
+class LogFileScanner {
+public:
+    /**
+     * Map a log file.
+     *
+     * @param path The path of the file.
+     * @param[out] error Why the file could not be mapped, if it could not.
+     * @return The scanner of the file, or @c nullptr if it could not be mapped.
+     */
+    static std::unique_ptr<LogFileScanner> open(const std::string& path, std::string* error);
+
+    /**
+     * Destructor.  Unmaps the file.
+     */
+    ~LogFileScanner();
+
+    /**
+     * Load the sidecar index of the file.
+     *
+     * @param[out] error Why the index could not be loaded, if it could not.
+     * @return Whether the index was loaded.  Fails if there is none, or if the file has changed since it was written.
+     */
+    bool loadIndex(std::string* error);
+
+    /**
+     * Build the index of the file and write it to the sidecar file.  The index is also used by later searches.
+     *
+     * @param threadCount The number of threads to build the index with.
+     * @param[out] error Why the index could not be written, if it could not.
+     * @return Whether the index was written.
+     */
+    bool writeIndex(size_t threadCount, std::string* error);
+
+    /**
+     * Find the entries selected by a filter.
+     *
+     * @param filter The filter.
+     * @param threadCount The number of threads to search with.
+     * @param[out] matches The selected entries, in file order and without their final newline.  They refer in to
+     * the mapping of the file, so are only valid for the life of this scanner.
+     * @return The number of blocks that were skipped using the index.
+     */
+    size_t scan(const LogFilter& filter, size_t threadCount, std::vector<LogSpan>* matches) const;
+
+    /**
+     * Get the number of blocks the file is split in to.
+     *
+     * @return The number of blocks the file is split in to.
+     */
+    size_t getBlockCount() const;
+
+private:
+    /// Number of 64 bit words in the Bloom filter of a block.
+    static const size_t BLOOM_WORDS = 8;
+
+    /// A block of the file, and what the index knows of it.
+    struct Block {
+        /// Offset of the block in the file.
+        uint64_t offset;
+
+        /// Size of the block.
+        uint64_t size;
+
+        /// The time of the earliest entry in the block.
+        int64_t minTime;
+
+        /// The time of the latest entry in the block.
+        int64_t maxTime;
+
+        /// Bloom filter of the sources, events and keys of the entries in the block.
+        uint64_t bloom[BLOOM_WORDS];
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param path The path of the file.
+     * @param data The mapping of the file.
+     * @param size The size of the file.
+     * @param modifiedTime The modification time of the file, in nanoseconds since the epoch.
+     */
+    LogFileScanner(const std::string& path, const char* data, size_t size, int64_t modifiedTime);
+
+    /**
+     * Split the file in to blocks that start at entries.
+     */
+    void splitBlocks();
+
+    /**
+     * Fill in the time range and Bloom filter of a block.
+     *
+     * @param block The block.
+     */
+    void summarize(Block* block) const;
+
+    /**
+     * Check whether the index shows that a block cannot hold an entry selected by a filter.
+     *
+     * @param block The block.
+     * @param filter The filter.
+     * @return Whether the block can be skipped.
+     */
+    bool canSkip(const Block& block, const LogFilter& filter) const;
+
+    /**
+     * Run a function for each block of the file on a pool of threads.
+     *
+     * @param threadCount The number of threads.
+     * @param function The function, called with the index of a block.
+     */
+    template <typename Function>
+    void forEachBlock(size_t threadCount, Function function) const;
+
+    /// The path of the file.
+    const std::string m_path;
+
+    /// The mapping of the file.
+    const char* const m_data;
+
+    /// The size of the file.
+    const size_t m_size;
+
+    /// The modification time of the file, in nanoseconds since the epoch.
+    const int64_t m_modifiedTime;
+
+    /// The blocks of the file.
+    std::vector<Block> m_blocks;
+
+    /// Whether the time ranges and Bloom filters of @c m_blocks are filled in.
+    bool m_hasIndex;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGFILESCANNER_H_
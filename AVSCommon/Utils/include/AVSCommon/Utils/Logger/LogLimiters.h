@@ -0,0 +1,279 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGLIMITERS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGLIMITERS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+class Logger;
+class LogLimiterSummarizer;
+
+/*
+ * Limiters used by the ACSDK_<LEVEL>_EVERY_N, ACSDK_<LEVEL>_RATE and ACSDK_<LEVEL>_SAMPLED macros to thin out
+ * entries logged from a single call site.  Each call site has its own static instance, which has a constexpr
+ * constructor so that it is initialized without a guard.  Each limiter counts the entries it suppresses, and hands
+ * the count over with the next entry it lets through so that it can be logged with it.
+ */
+
+/**
+ * Base of the limiters, which keeps the count of the entries a call site has suppressed.
+ *
+ * So that the count is not lost when a call site stops logging, a limiter that suppresses an entry is registered
+ * with a background thread.  Once the count has not changed for a second, the thread takes it and logs it in an
+ * entry of its own, and it does the same at exit.  The thread logs to the @c Logger of the call site, which must
+ * outlive it.  The @c Logger of a module is a function local static constructed before the call site first logs,
+ * so an @c atexit() handler registered with each call site stops the thread before that @c Logger is destroyed.
+ */
+class LogLimiter {
+public:
+    /// Constructor.
+    constexpr LogLimiter() :
+            m_suppressed{0},
+            m_isRegistered{false},
+            m_logger{nullptr},
+            m_level{Level::UNKNOWN},
+            m_file{nullptr},
+            m_line{0},
+            m_lastSuppressed{0} {
+    }
+
+    /**
+     * Called after the limiter has suppressed an entry, so that the count is logged even if no other entry is.
+     *
+     * @param logger The @c Logger that the call site logs to.
+     * @param level The level of the entries of the call site.
+     * @param file The source file of the call site.
+     * @param line The line of the call site.
+     */
+    inline void onSuppressed(Logger& logger, Level level, const char* file, int line);
+
+protected:
+    /**
+     * Count an entry as suppressed.
+     *
+     * @return @c false, so that a suppressed entry can be counted and reported in one statement.
+     */
+    inline bool suppress();
+
+    /**
+     * Take the number of entries suppressed since one was last let through or summarized.
+     *
+     * @return The number of entries suppressed.
+     */
+    inline uint64_t takeSuppressed();
+
+private:
+    friend class LogLimiterSummarizer;
+
+    /**
+     * Register this limiter with the background thread, if it has not already been.
+     *
+     * @param logger The @c Logger that the call site logs to.
+     * @param level The level of the entries of the call site.
+     * @param file The source file of the call site.
+     * @param line The line of the call site.
+     */
+    void registerForSummary(Logger& logger, Level level, const char* file, int line);
+
+    /// The number of entries suppressed since one was last let through or summarized.
+    std::atomic<uint64_t> m_suppressed;
+
+    /// Whether this limiter has been registered with the background thread.
+    std::atomic<bool> m_isRegistered;
+
+    /// The @c Logger that the call site logs to.  Set when the limiter is registered.
+    Logger* m_logger;
+
+    /// The level of the entries of the call site.  Set when the limiter is registered.
+    Level m_level;
+
+    /// The source file of the call site.  Set when the limiter is registered.
+    const char* m_file;
+
+    /// The line of the call site.  Set when the limiter is registered.
+    int m_line;
+
+    /// The value of @c m_suppressed when the background thread last looked.  Only accessed by that thread.
+    uint64_t m_lastSuppressed;
+};
+
+/**
+ * Lets through the first of every @c n entries.
+ */
+class LogEveryNLimiter : public LogLimiter {
+public:
+    /// Constructor.
+    constexpr LogEveryNLimiter() : m_count{0} {
+    }
+
+    /**
+     * Count an entry and decide whether to log it.
+     *
+     * @param n Let through one of every @c n entries.  Zero or one lets through every entry.
+     * @param[out] suppressed If the entry is let through, the number of entries suppressed since the last one was.
+     * @return Whether to log the entry.
+     */
+    inline bool allow(uint64_t n, uint64_t* suppressed);
+
+private:
+    /// The number of entries counted.
+    std::atomic<uint64_t> m_count;
+};
+
+/**
+ * Lets through at most a number of entries per second.  Entries beyond that are suppressed until the second is up.
+ * Seconds are counted from the first entry after the previous second was up, rather than on the clock.  Threads
+ * that log concurrently as a second ends may let through a few more entries than the limit.
+ */
+class LogRateLimiter : public LogLimiter {
+public:
+    /// Constructor.
+    constexpr LogRateLimiter() : m_windowStart{0}, m_count{0} {
+    }
+
+    /**
+     * Count an entry and decide whether to log it.
+     *
+     * @param perSecond The number of entries to let through per second.
+     * @param[out] suppressed If the entry is let through, the number of entries suppressed since the last one was.
+     * @return Whether to log the entry.
+     */
+    inline bool allow(uint64_t perSecond, uint64_t* suppressed);
+
+private:
+    /// When the current second started, in milliseconds of a monotonic clock.
+    std::atomic<int64_t> m_windowStart;
+
+    /// The number of entries counted in the current second, including those past the limit.
+    std::atomic<uint64_t> m_count;
+};
+
+/**
+ * Lets through each entry with a given probability.
+ */
+class LogSampler : public LogLimiter {
+public:
+    /// Constructor.
+    constexpr LogSampler() {
+    }
+
+    /**
+     * Count an entry and decide whether to log it.
+     *
+     * @param probability The probability with which to let the entry through, from 0 to 1.
+     * @param[out] suppressed If the entry is let through, the number of entries suppressed since the last one was.
+     * @return Whether to log the entry.
+     */
+    inline bool allow(double probability, uint64_t* suppressed);
+
+private:
+    /**
+     * Get the next value of a per-thread xorshift generator.  Not suitable for anything but sampling.
+     *
+     * @return A pseudo-random 32 bit value.
+     */
+    static inline uint32_t nextRandom();
+};
+
+void LogLimiter::onSuppressed(Logger& logger, Level level, const char* file, int line) {
+    if (!m_isRegistered.load(std::memory_order_relaxed)) {
+        registerForSummary(logger, level, file, line);
+    }
+}
+
+bool LogLimiter::suppress() {
+    m_suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+uint64_t LogLimiter::takeSuppressed() {
+    // Only written when there is something to take, so that entries let through by a quiet limiter do not contend.
+    if (0 == m_suppressed.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    return m_suppressed.exchange(0, std::memory_order_relaxed);
+}
+
+bool LogEveryNLimiter::allow(uint64_t n, uint64_t* suppressed) {
+    auto count = m_count.fetch_add(1, std::memory_order_relaxed);
+    if (n > 1 && count % n != 0) {
+        return suppress();
+    }
+    *suppressed = takeSuppressed();
+    return true;
+}
+
+bool LogRateLimiter::allow(uint64_t perSecond, uint64_t* suppressed) {
+#ifdef CLOCK_MONOTONIC_COARSE
+    // A few milliseconds of resolution is plenty for one second windows, and much cheaper to read on Linux.
+    struct timespec coarse;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &coarse);
+    int64_t now = static_cast<int64_t>(coarse.tv_sec) * 1000 + coarse.tv_nsec / 1000000;
+#else
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+#endif
+    auto windowStart = m_windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= 1000 && m_windowStart.compare_exchange_strong(windowStart, now)) {
+        m_count.store(0, std::memory_order_relaxed);
+    }
+    if (m_count.fetch_add(1, std::memory_order_relaxed) >= perSecond) {
+        return suppress();
+    }
+    *suppressed = takeSuppressed();
+    return true;
+}
+
+bool LogSampler::allow(double probability, uint64_t* suppressed) {
+    // Compared against a 32 bit random value, so that the threshold of a constant probability is a constant.
+    if (probability < 1.0 && nextRandom() >= static_cast<uint64_t>(probability * 4294967296.0)) {
+        return suppress();
+    }
+    *suppressed = takeSuppressed();
+    return true;
+}
+
+uint32_t LogSampler::nextRandom() {
+    static thread_local uint64_t state = 0;
+    if (0 == state) {
+        // Seed each thread differently, from the address of its state and the time it first samples.
+        state = reinterpret_cast<uintptr_t>(&state) ^
+                static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+                0x9e3779b97f4a7c15ULL;
+    }
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return static_cast<uint32_t>((state * 0x2545f4914f6cdd1dULL) >> 32);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGLIMITERS_H_
@@ -0,0 +1,158 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGPARSER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGPARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/*
+ * Parsing of the lines written by @c LogStringFormatter, for tools that read log files:
+ *
+ *     YYYY-MM-DD HH:MM:SS.mmm [moniker] L source:event:key=value,key=value:message
+ *
+ * Parsing does not copy anything.  The parts of a line are returned as @c LogSpan references in to the line.  Values
+ * are returned as they appear in the line, with the backslash escapes added by @c LogEntry.  Use @c unescapeLogValue()
+ * to remove them.
+ */
+
+/// A run of characters in a buffer owned by someone else, such as a mapped log file.  Not null terminated.
+struct LogSpan {
+    /**
+     * Compare with a string.
+     *
+     * @param text The string.
+     * @return Whether this span holds the same characters as @c text.
+     */
+    inline bool operator==(const std::string& text) const;
+
+    /// The first character.
+    const char* data;
+
+    /// The number of characters.
+    size_t size;
+};
+
+/// The parts of a log line.
+struct ParsedLogLine {
+    /// The time of the line, in milliseconds since the epoch (UTC).
+    int64_t time;
+
+    /// The moniker of the thread that logged the line, without padding.
+    LogSpan threadMoniker;
+
+    /// The severity level of the line.
+    Level level;
+
+    /// The source of the entry.
+    LogSpan source;
+
+    /// The event of the entry.
+    LogSpan event;
+
+    /// The @c key=value pairs of the entry, still escaped.  Empty if there are none.
+    LogSpan metadata;
+
+    /// The message of the entry.  Empty if there is none.
+    LogSpan message;
+};
+
+/**
+ * Check whether a line starts with the date and time of a log line.  Lines that do not are continuations of the
+ * previous line, e.g. from a message with newlines in it.
+ *
+ * @param line The line.
+ * @param length The length of @c line, which may extend past its end.
+ * @return Whether @c line starts with a date and time.
+ */
+bool isLogLineStart(const char* line, size_t length);
+
+/**
+ * Parse a log line.
+ *
+ * @param line The line, without its newline.
+ * @param length The length of @c line.
+ * @param[out] out The parts of the line, which refer in to @c line.
+ * @return Whether @c line is a log line.
+ */
+bool parseLogLine(const char* line, size_t length, ParsedLogLine* out);
+
+/**
+ * Parse a date and time in the format used in log lines, "YYYY-MM-DD HH:MM:SS", optionally followed by ".mmm".
+ *
+ * @param text The date and time.
+ * @param length The length of @c text.
+ * @param[out] milliseconds The date and time, in milliseconds since the epoch (UTC).
+ * @return Whether @c text is a date and time.
+ */
+bool parseLogTime(const char* text, size_t length, int64_t* milliseconds);
+
+/**
+ * Remove the backslash escapes from a metadata value.
+ *
+ * @param value The value, as it appears in a log line.
+ * @param[out] out The value without escapes.
+ */
+void unescapeLogValue(const LogSpan& value, std::string* out);
+
+/**
+ * Splits the metadata of a log line in to @c key=value pairs, honouring the escapes in values.
+ */
+class LogMetadataTokenizer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param metadata The metadata of a log line, as returned in @c ParsedLogLine::metadata.
+     */
+    explicit LogMetadataTokenizer(const LogSpan& metadata);
+
+    /**
+     * Get the next pair.
+     *
+     * @param[out] key The key of the pair.
+     * @param[out] value The value of the pair, still escaped.
+     * @return Whether there was another pair.
+     */
+    bool next(LogSpan* key, LogSpan* value);
+
+private:
+    /// The next character to read.
+    const char* m_position;
+
+    /// The end of the metadata.
+    const char* m_end;
+};
+
+bool LogSpan::operator==(const std::string& text) const {
+    return size == text.size() && 0 == memcmp(data, text.data(), size);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGPARSER_H_
@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGSTRINGFORMATTER_H_
 
 #include <chrono>
+#include <string>
 
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Timing/SafeCTimeAccess.h"
@@ -28,6 +29,9 @@ namespace logger {
 
 /**
  * A class used to format log strings.
+ *
+ * The "YYYY-MM-DD HH:MM:SS" part of the timestamp is rendered at most once per second per thread and cached in
+ * thread-local storage, so formatting a burst of lines only patches in the milliseconds.
  */
 class LogStringFormatter {
 public:
@@ -48,6 +52,23 @@ public:
         const char* threadMoniker,
         const char* text);
 
+    /**
+     * Formats a log message with other metadata regarding the log message, appending the result to a
+     * caller-supplied buffer.  Reusing the buffer across calls avoids allocating a new string for each line.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     * @param[out] out The buffer to append the formatted line to.
+     */
+    void format(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        std::string* out);
+
 private:
     std::shared_ptr<timing::SafeCTimeAccess> m_safeCTimeAccess;
 };
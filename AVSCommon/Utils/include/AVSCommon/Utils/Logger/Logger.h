@@ -26,6 +26,7 @@
 
 #include "AVSCommon/Utils/Logger/Level.h"
 #include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/LogLimiters.h"
 #include "AVSCommon/Utils/Logger/LogLevelObserverInterface.h"
 #include "AVSCommon/Utils/Logger/SinkObserverInterface.h"
 
@@ -166,6 +167,13 @@ public:
      */
     virtual void setLevel(Level level);
 
+    /**
+     * Get the lowest severity level to be output by this logger.
+     *
+     * @return The lowest severity level to be output by this logger.
+     */
+    inline Level getLevel() const;
+
     /**
      * Return true of logs of a specified severity should be emitted by this Logger.
      *
@@ -175,7 +183,7 @@ public:
     inline bool shouldLog(Level level) const;
 
     /**
-     * Send a log entry to this Logger.
+     * Send a log entry to this Logger.  The entry is also recorded by the @c FlightRecorder, if it is enabled.
      *
      * @param level The severity Level to associate with this log entry.
      * @param entry Object used to build the text of this log entry.
@@ -211,6 +219,87 @@ public:
         const char* threadMoniker,
         const char* text) = 0;
 
+    /**
+     * Emit a log entry that has not yet been rendered as text.  Sinks that can defer rendering of entries captured
+     * with @c LogEntry::CaptureMode::BINARY (e.g. to another thread) should override this.  The default
+     * implementation renders the entry and calls @c emit().
+     * NOTE: This method must be thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param entry The entry to log.  Only valid for the duration of this call.
+     */
+    virtual void emitEntry(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogEntry& entry);
+
+    /**
+     * Emit a log entry that has already been formatted by @c LogStringFormatter.  Used to format an entry once when
+     * it is sent to more than one sink.  Sinks that write lines in the format of @c LogStringFormatter should
+     * override this to write @c line as is.  The default implementation ignores @c line and calls @c emit().
+     * NOTE: This method must be thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     * @param line The formatted line, without a trailing newline.  Only valid for the duration of this call.
+     * @param length The number of characters in @c line.
+     */
+    virtual void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const char* line,
+        size_t length);
+
+    /**
+     * Emit a log entry that the caller has decided to log whatever the level of this logger, such as an entry that
+     * a @c ModuleLogger forwards only because its level is overridden with the @c LogControl file, or one flushed from
+     * a @c BacktraceBuffer.  Loggers that filter the entries they are given by level (such as @c MultiSinkLogger)
+     * should override this to skip that filter.  The default implementation calls @c emit().
+     * NOTE: This method must be thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     */
+    virtual void emitUnfiltered(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text);
+
+    /**
+     * Return whether this logger writes lines in the format of @c LogStringFormatter, and so makes use of the line
+     * passed to @c emitFormatted().  @c MultiSinkLogger formats an entry once for the sinks that do, and passes the
+     * entry itself to the others.  The default implementation returns @c false.
+     *
+     * @return Whether this logger makes use of the line passed to @c emitFormatted().
+     */
+    virtual bool usesFormattedLines() const;
+
+    /**
+     * Emit a log entry while the program is exiting.  Implementations that defer output (e.g. to another thread)
+     * should override this to write the entry out before returning.  The default implementation calls @c emit().
+     * NOTE: This method must be thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     */
+    virtual void emitAtExit(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text);
+
     /**
      * Add an observer to this object.
      *
@@ -228,6 +317,14 @@ public:
     void removeLogLevelObserver(LogLevelObserverInterface* observer);
 
 protected:
+    /**
+     * Constructor for loggers whose level is kept outside of the object, such as in a @c LogControl file.
+     *
+     * @param level The lowest severity level of logs to be emitted by this Logger.
+     * @param levelStorage Where to keep the level, or @c nullptr to keep it in this object.
+     */
+    Logger(Level level, std::atomic<Level>* levelStorage);
+
     /**
      * Initialize @c Logger parameters from the specified @c ConfigurationNode.
      *
@@ -235,8 +332,8 @@ protected:
      */
     void init(const configuration::ConfigurationNode configuration);
 
-    /// The lowest severity level of logs to be output by this Logger.
-    std::atomic<Level> m_level;
+    /// The lowest severity level of logs to be output by this Logger.  Refers to @c m_ownLevel or to shared storage.
+    std::atomic<Level>& m_level;
 
 private:
     /**
@@ -257,10 +354,17 @@ private:
 
     /// This mutex guards access to m_observers
     std::mutex m_observersMutex;
+
+    /// The level of this Logger, unless it is kept elsewhere.
+    std::atomic<Level> m_ownLevel;
 };
 
+Level Logger::getLevel() const {
+    return m_level;
+}
+
 bool Logger::shouldLog(Level level) const {
-    return level >= m_level;
+    return level >= m_level.load(std::memory_order_relaxed);
 }
 
 /**
@@ -357,6 +461,61 @@ inline Logger& ACSDK_GET_LOGGER_FUNCTION() {
         }                                                                                             \
     } while (false)
 
+/**
+ * Common implementation for sending entries to the log through a limiter that is kept for each call site.  The
+ * limiter is only consulted for entries at an enabled level, and the entry is only built if the limiter lets it
+ * through.  If entries from the call site were suppressed since one was last let through, their number is added to
+ * the metadata of the entry as a @c "suppressed" value.  If the call site stops logging, the number is logged in an
+ * entry of its own (see @c LogLimiter).
+ *
+ * @param level The log level to associate with the log line.
+ * @param limiterType The class of limiter to use.
+ * @param limit The argument passed to the @c allow() method of the limiter.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_LOG_LIMITED(level, limiterType, limit, entry)                                                 \
+    do {                                                                                                    \
+        auto& loggerInstance = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION();       \
+        static alexaClientSDK::avsCommon::utils::logger::limiterType limiter;                               \
+        uint64_t suppressedCount = 0;                                                                       \
+        if (loggerInstance.shouldLog(level)) {                                                              \
+            if (!limiter.allow(limit, &suppressedCount)) {                                                  \
+                limiter.onSuppressed(loggerInstance, level, __FILE__, __LINE__);                            \
+            } else if (suppressedCount > 0) {                                                               \
+                loggerInstance.log(level, (entry).insertBeforeMessage("suppressed", suppressedCount));      \
+            } else {                                                                                        \
+                loggerInstance.log(level, entry);                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    } while (false)
+
+/**
+ * Send the first of every @c n entries from this call site to the log.
+ *
+ * @param level The log level to associate with the log line.
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_LOG_EVERY_N(level, n, entry) ACSDK_LOG_LIMITED(level, LogEveryNLimiter, n, entry)
+
+/**
+ * Send at most @c perSecond entries per second from this call site to the log.
+ *
+ * @param level The log level to associate with the log line.
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_LOG_RATE(level, perSecond, entry) ACSDK_LOG_LIMITED(level, LogRateLimiter, perSecond, entry)
+
+/**
+ * Send each entry from this call site to the log with a given probability.
+ *
+ * @param level The log level to associate with the log line.
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_LOG_SAMPLED(level, probability, entry) ACSDK_LOG_LIMITED(level, LogSampler, probability, entry)
+
 #ifdef ACSDK_DEBUG_LOG_ENABLED
 
 /**
@@ -570,4 +729,167 @@ inline Logger& ACSDK_GET_LOGGER_FUNCTION() {
  */
 #define ACSDK_CRITICAL(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, entry)
 
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+
+/**
+ * Send the first of every @c n DEBUG0 severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_EVERY_N(n, entry) \
+    ACSDK_LOG_EVERY_N(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, n, entry)
+
+/**
+ * Send at most @c perSecond DEBUG0 severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_RATE(perSecond, entry) \
+    ACSDK_LOG_RATE(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, perSecond, entry)
+
+/**
+ * Send each DEBUG0 severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_SAMPLED(probability, entry) \
+    ACSDK_LOG_SAMPLED(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, probability, entry)
+
+#else  // ACSDK_DEBUG_LOG_ENABLED
+
+/**
+ * Send the first of every @c n DEBUG0 severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_EVERY_N(n, entry)
+
+/**
+ * Send at most @c perSecond DEBUG0 severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_RATE(perSecond, entry)
+
+/**
+ * Send each DEBUG0 severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_DEBUG_SAMPLED(probability, entry)
+
+#endif  // ACSDK_DEBUG_LOG_ENABLED
+
+/**
+ * Send the first of every @c n INFO severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_INFO_EVERY_N(n, entry) ACSDK_LOG_EVERY_N(alexaClientSDK::avsCommon::utils::logger::Level::INFO, n, entry)
+
+/**
+ * Send at most @c perSecond INFO severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_INFO_RATE(perSecond, entry) \
+    ACSDK_LOG_RATE(alexaClientSDK::avsCommon::utils::logger::Level::INFO, perSecond, entry)
+
+/**
+ * Send each INFO severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_INFO_SAMPLED(probability, entry) \
+    ACSDK_LOG_SAMPLED(alexaClientSDK::avsCommon::utils::logger::Level::INFO, probability, entry)
+
+/**
+ * Send the first of every @c n WARN severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_WARN_EVERY_N(n, entry) ACSDK_LOG_EVERY_N(alexaClientSDK::avsCommon::utils::logger::Level::WARN, n, entry)
+
+/**
+ * Send at most @c perSecond WARN severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_WARN_RATE(perSecond, entry) \
+    ACSDK_LOG_RATE(alexaClientSDK::avsCommon::utils::logger::Level::WARN, perSecond, entry)
+
+/**
+ * Send each WARN severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_WARN_SAMPLED(probability, entry) \
+    ACSDK_LOG_SAMPLED(alexaClientSDK::avsCommon::utils::logger::Level::WARN, probability, entry)
+
+/**
+ * Send the first of every @c n ERROR severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_ERROR_EVERY_N(n, entry) \
+    ACSDK_LOG_EVERY_N(alexaClientSDK::avsCommon::utils::logger::Level::ERROR, n, entry)
+
+/**
+ * Send at most @c perSecond ERROR severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_ERROR_RATE(perSecond, entry) \
+    ACSDK_LOG_RATE(alexaClientSDK::avsCommon::utils::logger::Level::ERROR, perSecond, entry)
+
+/**
+ * Send each ERROR severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_ERROR_SAMPLED(probability, entry) \
+    ACSDK_LOG_SAMPLED(alexaClientSDK::avsCommon::utils::logger::Level::ERROR, probability, entry)
+
+/**
+ * Send the first of every @c n CRITICAL severity log lines from this call site.
+ *
+ * @param n Log one of every @c n entries.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_CRITICAL_EVERY_N(n, entry) \
+    ACSDK_LOG_EVERY_N(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, n, entry)
+
+/**
+ * Send at most @c perSecond CRITICAL severity log lines per second from this call site.
+ *
+ * @param perSecond The number of entries to log per second.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_CRITICAL_RATE(perSecond, entry) \
+    ACSDK_LOG_RATE(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, perSecond, entry)
+
+/**
+ * Send each CRITICAL severity log line from this call site with a given probability.
+ *
+ * @param probability The probability of logging each entry, from 0 to 1.
+ * @param entry The builder of the text for the log entry.
+ */
+#define ACSDK_CRITICAL_SAMPLED(probability, entry) \
+    ACSDK_LOG_SAMPLED(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, probability, entry)
+
 #endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGGER_H_
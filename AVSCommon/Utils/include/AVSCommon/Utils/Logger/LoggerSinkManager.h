@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/MultiSinkLogger.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -29,6 +30,9 @@ namespace logger {
 
 /**
  * A manager to manage the sink logger and notify SinkObservers of any changes.
+ *
+ * Logs may be sent to several sinks at once with @c addSink().  The first call replaces the sink logger with a
+ * @c MultiSinkLogger that forwards to the previous sink and the added one, each at its own level.
  */
 class LoggerSinkManager {
 public:
@@ -72,21 +76,54 @@ public:
      */
     void initialize(const std::shared_ptr<Logger>& sink);
 
+    /**
+     * Send logs to an additional sink, as well as to the sinks already in use.  The sink only outputs entries at or
+     * above @c level, while entries are built whenever any sink would output them.  For example, the console may be
+     * limited to @c WARN while a file receives @c DEBUG3.
+     *
+     * @param sink The @c Logger to also forward logs to.
+     * @param level The lowest severity level to be output by @c sink.  Applied even if @c sink is already in use.
+     * @return Whether the sink was added.  @c false if it is null or already in use.
+     */
+    bool addSink(const std::shared_ptr<Logger>& sink, Level level);
+
+    /**
+     * Stop sending logs to a sink added with @c addSink(), or to the sink that was in use before it was first
+     * called.
+     *
+     * @param sink The @c Logger to stop forwarding logs to.
+     * @return Whether the sink was removed.
+     */
+    bool removeSink(const std::shared_ptr<Logger>& sink);
+
 private:
     /**
      * Constructor.
      */
     LoggerSinkManager();
 
+    /**
+     * Replace the sink logger and notify the SinkObservers.  @c m_sinkMutex must be held when calling this method.
+     *
+     * @param sink The new @c Logger to forward logs to.
+     */
+    void setSinkLocked(const std::shared_ptr<Logger>& sink);
+
     /// This mutex guards access to m_sinkObservers.
     std::mutex m_sinkObserverMutex;
 
     /// Vector of SinkObservers to be managed.
     std::vector<SinkObserverInterface*> m_sinkObservers;
 
+    /// This mutex serializes changes to m_sink and m_multiSink.
+    std::mutex m_sinkMutex;
+
     /// The @c Logger to forward logs to.
     std::shared_ptr<Logger> m_sink;
 
+    /// The @c MultiSinkLogger that is @c m_sink once @c addSink() has been called, otherwise @c nullptr.
+    std::shared_ptr<MultiSinkLogger> m_multiSink;
+
     /// The lowest level of entries to log.
     Level m_level;
 };
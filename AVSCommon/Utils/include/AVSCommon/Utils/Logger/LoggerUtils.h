@@ -140,7 +140,8 @@ void acsdkCritical(const LogEntry& entry);
 void logEntry(Level level, const LogEntry& entry);
 
 /**
- * Stream out an array of bytes as a hex dump.
+ * Stream out an array of bytes as a hex dump, in the format of @c formatHexDump().  The dump is rendered whether or
+ * not it is logged, so to log one, prefer @c LogEntry::dump(), which only renders it if the entry is emitted.
  *
  * @param stream The stream to render to.
  * @param prefix A prefix added to each row.
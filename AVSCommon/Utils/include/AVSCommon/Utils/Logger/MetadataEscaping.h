@@ -0,0 +1,73 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_METADATAESCAPING_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_METADATAESCAPING_H_
+
+#include <cstddef>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Implementations of @c escapeMetadata().
+enum class MetadataEscaper {
+    /// One character at a time.
+    SCALAR,
+    /// Scans 16 characters at a time, using SSE2 instructions.
+    SSE2,
+    /// Scans 32 characters at a time, using AVX2 instructions.
+    AVX2
+};
+
+/**
+ * Escape the characters of a string that are reserved in log entry metadata (@c '\\', @c ',', @c '=' and @c ':')
+ * by prefixing each with @c '\\'.  Blocks of characters are scanned at a time, and blocks that contain no reserved
+ * characters are copied as a whole.  Uses the fastest implementation supported by the CPU, which is selected the
+ * first time this is called.
+ *
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.  Must have room for @c 2 * @c length characters.
+ * @return The number of characters written to @c out.
+ */
+size_t escapeMetadata(const char* text, size_t length, char* out);
+
+/**
+ * Escape the characters of a string that are reserved in log entry metadata, using a specific implementation.
+ *
+ * @param escaper The implementation to use.  If it is not supported, @c MetadataEscaper::SCALAR is used instead.
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.  Must have room for @c 2 * @c length characters.
+ * @return The number of characters written to @c out.
+ */
+size_t escapeMetadata(MetadataEscaper escaper, const char* text, size_t length, char* out);
+
+/**
+ * Check whether an implementation of @c escapeMetadata() can be used on this build and CPU.
+ *
+ * @param escaper The implementation to check.
+ * @return Whether @c escaper can be used.
+ */
+bool isMetadataEscaperSupported(MetadataEscaper escaper);
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_METADATAESCAPING_H_
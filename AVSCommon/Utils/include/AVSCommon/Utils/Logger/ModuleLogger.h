@@ -16,6 +16,11 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_MODULELOGGER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_MODULELOGGER_H_
 
+#include <memory>
+
+#include "AVSCommon/Utils/Logger/BacktraceBuffer.h"
+#include "AVSCommon/Utils/Logger/FlightRecorder.h"
+#include "AVSCommon/Utils/Logger/LogControl.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 namespace alexaClientSDK {
@@ -25,6 +30,28 @@ namespace logger {
 
 /**
  * @c Logger implementation providing per module configuration. Forwards logs to another @c Logger.
+ *
+ * If the @c FlightRecorder is enabled with a level, the level of this @c Logger is lowered to it, so that entries
+ * below the levels of the module and the sink are built and recorded.  Only entries at or above the latter are
+ * forwarded to the sink.
+ *
+ * Likewise, if a @c "backtrace" object is configured for the module (or under @c "logger", for every module), the
+ * entries below the level forwarded to the sink are kept in a @c BacktraceBuffer instead of being dropped.  They are
+ * forwarded after all, just before an entry at or above the flush level is:
+ *
+ *     "backtrace" : {
+ *         "logLevel" : "DEBUG9",
+ *         "flushLevel" : "ERROR",
+ *         "entryCount" : 64,
+ *         "maxAgeMs" : 10000
+ *     }
+ *
+ * The buffered entries are passed to @c Logger::emitUnfiltered() of the sink, so that a sink which filters the entries
+ * it is given by level (such as @c MultiSinkLogger) does not drop them.
+ *
+ * If the @c LogControl file is enabled, the levels of the module are kept in its slot in the file, so that the level
+ * forwarded to the sink can be overridden from outside the process while it runs.  Entries forwarded only because of
+ * such an override are likewise passed to @c Logger::emitUnfiltered().
  */
 class ModuleLogger
         : public Logger
@@ -43,27 +70,148 @@ public:
 
     void emit(Level level, std::chrono::system_clock::time_point time, const char* threadId, const char* text) override;
 
+    void emitEntry(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadId,
+        const LogEntry& entry) override;
+
+    void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadId,
+        const char* text,
+        const char* line,
+        size_t length) override;
+
+    void emitAtExit(Level level, std::chrono::system_clock::time_point time, const char* threadId, const char* text)
+        override;
+
 private:
+    /**
+     * Constructor.
+     *
+     * @param configKey The name of the root configuration key of the module.
+     * @param controlSlot The slot of the module in the @c LogControl file, or @c nullptr if there is none.
+     */
+    ModuleLogger(const std::string& configKey, LogControl::Slot* controlSlot);
+
     void onLogLevelChanged(Level level) override;
 
     void onSinkChanged(const std::shared_ptr<Logger>& sink) override;
 
     /**
-     * Combine @c m_moduleLogLevel and @c m_sinkLogLevel to determine the appropriate value for m_logLevel.
+     * Combine @c m_moduleLogLevel and @c m_sinkLogLevel to determine the appropriate value for
+     * @c m_forwardLogLevel, and that and the level of the @c FlightRecorder to determine m_logLevel.
      */
     void updateLogLevel();
 
+    /**
+     * Create @c m_backtrace from the @c "backtrace" object of the module's configuration, or failing that of the
+     * @c "logger" configuration.
+     *
+     * @param configuration The configuration of the module.
+     */
+    void initBacktrace(const configuration::ConfigurationNode& configuration);
+
+    /**
+     * Flush the backtrace buffer to the sink, if backtraces are enabled and the level of an entry that is about to be
+     * forwarded calls for it.
+     *
+     * @param level The severity Level of the entry about to be forwarded.
+     * @param time The time that the entry was logged.
+     */
+    inline void flushBacktrace(Level level, std::chrono::system_clock::time_point time);
+
+    /**
+     * Add an entry that is not forwarded to the sink to the backtrace buffer, if backtraces are enabled and the
+     * buffer accepts the level of the entry.
+     *
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was logged.
+     * @param threadId Moniker of the thread that logged the entry.
+     * @param text The text of the entry.
+     */
+    inline void bufferBacktrace(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadId,
+        const char* text);
+
+    /**
+     * Return whether entries of a specified severity should be forwarded to the sink.
+     *
+     * @param level The Level to check.
+     * @return Whether entries of the specified Level should be forwarded to the sink.
+     */
+    inline bool shouldForward(Level level) const;
+
+    /**
+     * Return whether entries of a specified severity that are forwarded to the sink are below the level of the
+     * module's configuration or of the sink, and so are only forwarded because of an override from the
+     * @c LogControl file.
+     *
+     * @param level The Level to check.
+     * @return Whether entries of the specified Level should be passed to @c Logger::emitUnfiltered() of the sink.
+     */
+    inline bool isForwardedByOverride(Level level) const;
+
     /// Log level specified for this module logger.
     Level m_moduleLogLevel;
 
     /// Log level specified for the sink to forward logs to.
     Level m_sinkLogLevel;
 
+    /// The slot of the module in the @c LogControl file, or @c nullptr if there is none.
+    LogControl::Slot* m_controlSlot;
+
+    /// The level to forward entries at, unless it is kept in @c m_controlSlot.
+    std::atomic<Level> m_ownForwardLogLevel;
+
+    /**
+     * The lowest level of entries to forward to the sink, combining @c m_moduleLogLevel and @c m_sinkLogLevel, or the
+     * level set with the @c LogControl file.  Refers to @c m_ownForwardLogLevel or to @c m_controlSlot.
+     */
+    std::atomic<Level>& m_forwardLogLevel;
+
+    /// The level entries are forwarded at without an override, combining @c m_moduleLogLevel and @c m_sinkLogLevel.
+    std::atomic<Level> m_configuredForwardLogLevel;
+
+    /// The flight recorder, or @c nullptr if it is not enabled.
+    FlightRecorder* m_flightRecorder;
+
+    /// The buffer of entries that were not forwarded to the sink, or @c nullptr if backtraces are not enabled.
+    std::unique_ptr<BacktraceBuffer> m_backtrace;
+
 protected:
     /// The @c Logger to forward logs to.
     std::shared_ptr<Logger> m_sink;
 };
 
+bool ModuleLogger::shouldForward(Level level) const {
+    return level >= m_forwardLogLevel.load(std::memory_order_relaxed);
+}
+
+bool ModuleLogger::isForwardedByOverride(Level level) const {
+    return level < m_configuredForwardLogLevel.load(std::memory_order_relaxed);
+}
+
+void ModuleLogger::flushBacktrace(Level level, std::chrono::system_clock::time_point time) {
+    if (m_backtrace && m_backtrace->shouldFlush(level)) {
+        m_backtrace->flush(time, m_sink.get());
+    }
+}
+
+void ModuleLogger::bufferBacktrace(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadId,
+    const char* text) {
+    if (m_backtrace && m_backtrace->shouldBuffer(level)) {
+        m_backtrace->add(level, time, threadId, text);
+    }
+}
+
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
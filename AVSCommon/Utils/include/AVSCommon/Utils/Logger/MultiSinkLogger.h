@@ -0,0 +1,200 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_MULTISINKLOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_MULTISINKLOGGER_H_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger that forwards each entry to several sink loggers, each of which keeps its own level.
+ *
+ * The level of a @c MultiSinkLogger is the lowest level of its sinks, and follows changes to their levels, so that
+ * a @c ModuleLogger forwarding to it still rejects entries that no sink would accept before they are built.  When
+ * more than one sink accepts an entry, it is rendered and formatted by @c LogStringFormatter once, and the same
+ * line is passed to @c Logger::emitFormatted() of each of them that @c Logger::usesFormattedLines().  Other sinks,
+ * such as @c JsonLogger, get the entry itself.  When only one sink accepts an entry, it is forwarded to that sink as
+ * is, so that a sink such as @c AsyncLogger may still defer formatting it.
+ *
+ * @c setLevel() sets a gate in front of the sinks rather than the level of each sink.  While the gate is above the
+ * lowest level of the sinks, it is the level of the @c MultiSinkLogger, and entries below it reach no sink.
+ *
+ * Entries passed to @c emitUnfiltered() are forwarded to every sink, whatever the gate and the levels of the sinks,
+ * unless the gate or the sink is set to @c Level::NONE.  A @c ModuleLogger passes it the entries that it forwards
+ * below the level of the sink, so that an override from the @c LogControl file and a flushed @c BacktraceBuffer are
+ * not dropped here.
+ *
+ * Sinks may be added and removed while entries are being emitted.  Usually this is managed through
+ * @c LoggerSinkManager::addSink() and @c LoggerSinkManager::removeSink().
+ */
+class MultiSinkLogger
+        : public Logger
+        , private LogLevelObserverInterface {
+public:
+    /**
+     * Create a @c MultiSinkLogger.
+     *
+     * @return A new @c MultiSinkLogger, without any sinks.
+     */
+    static std::shared_ptr<MultiSinkLogger> create();
+
+    /**
+     * Destructor.  Stops observing the levels of the sinks.
+     */
+    ~MultiSinkLogger();
+
+    /**
+     * Add a sink.  Entries are forwarded to it if they are at or above its level.
+     *
+     * @param sink The sink to add.
+     * @return Whether the sink was added.  @c false if it is null, already added, or this @c MultiSinkLogger.
+     */
+    bool addSink(const std::shared_ptr<Logger>& sink);
+
+    /**
+     * Remove a sink.
+     *
+     * @param sink The sink to remove.
+     * @return Whether the sink was removed.  @c false if it had not been added.
+     */
+    bool removeSink(const std::shared_ptr<Logger>& sink);
+
+    /**
+     * Get the sinks entries are forwarded to.
+     *
+     * @return The sinks, in the order they were added.
+     */
+    std::vector<std::shared_ptr<Logger>> getSinks() const;
+
+    /**
+     * Set the gate in front of the sinks.  The level of each sink is left as it is.
+     *
+     * @param level The lowest severity level to be passed to any sink.
+     */
+    void setLevel(Level level) override;
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    void emitEntry(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogEntry& entry) override;
+
+    void emitFormatted(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const char* line,
+        size_t length) override;
+
+    void emitAtExit(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text) override;
+
+    void emitUnfiltered(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text) override;
+
+private:
+    /// The sinks of a @c MultiSinkLogger.  Replaced rather than modified, so that it can be read without a lock.
+    using Sinks = std::vector<std::shared_ptr<Logger>>;
+
+    /**
+     * Constructor.
+     */
+    MultiSinkLogger();
+
+    void onLogLevelChanged(Level level) override;
+
+    /**
+     * Set the level of this @c MultiSinkLogger to the lowest level of its sinks, or to the gate if that is higher.
+     */
+    void updateLevel();
+
+    /**
+     * As @c updateLevel(), with @c m_levelMutex already held.
+     */
+    void updateLevelLocked();
+
+    /**
+     * Find the sink that accepts an entry, if only one does.
+     *
+     * @param sinks The sinks.
+     * @param level The severity Level of the entry.
+     * @param[out] count The number of sinks that accept the entry, counting no further than two.
+     * @return The sink that accepts the entry if @c count is one, otherwise @c nullptr.
+     */
+    static Logger* findOnlySink(const Sinks& sinks, Level level, int* count);
+
+    /**
+     * Pass an entry to each sink that accepts it.  The entry is formatted once for the sinks that use formatted lines.
+     *
+     * @param sinks The sinks.
+     * @param filter Whether to pass the entry only to the sinks whose level it is at or above, rather than to every
+     * sink that is not set to @c Level::NONE.
+     * @param level The severity Level of the entry.
+     * @param time The time that the entry was emitted.
+     * @param threadMoniker Moniker of the thread that emitted the entry.
+     * @param text The text of the entry.
+     * @param entry The entry, passed to sinks that do not use formatted lines, or @c nullptr to pass them @c text.
+     */
+    void emitToSinks(
+        const Sinks& sinks,
+        bool filter,
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text,
+        const LogEntry* entry);
+
+    /// The current sinks.  Accessed with @c std::atomic_load() and @c std::atomic_store().
+    std::shared_ptr<const Sinks> m_sinks;
+
+    /// Serializes changes to @c m_sinks.
+    mutable std::mutex m_sinksMutex;
+
+    /// Serializes updates of the level from the levels of the sinks and from @c m_gateLevel.
+    std::mutex m_levelMutex;
+
+    /// The level set by @c setLevel(), below which entries reach no sink.  Guarded by @c m_levelMutex.
+    Level m_gateLevel;
+
+    /// Object to format log strings correctly.
+    LogStringFormatter m_logFormatter;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_MULTISINKLOGGER_H_
@@ -0,0 +1,88 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_NUMBERFORMATTING_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_NUMBERFORMATTING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/*
+ * Locale independent formatting of numbers for log entries.  These write directly to a caller supplied buffer and
+ * do not null terminate what they write.
+ */
+
+/// Big enough for the text of any value written by the functions below.
+constexpr size_t MAX_FORMATTED_NUMBER_SIZE = 32;
+
+/**
+ * Format a signed integer in decimal.
+ *
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.  Must have room for @c MAX_FORMATTED_NUMBER_SIZE characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatInt64(int64_t value, char* out);
+
+/**
+ * Format an unsigned integer in decimal.
+ *
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.  Must have room for @c MAX_FORMATTED_NUMBER_SIZE characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatUint64(uint64_t value, char* out);
+
+/**
+ * Format a double with the fewest significant digits that read back as the same value.  Values whose decimal
+ * exponent is from -4 to 16 are written in fixed notation (e.g. @c 0.001, @c 2.5, @c 1500), and other values in
+ * the scientific notation of @c printf("%g") (e.g. @c 1e-05, @c 6.02214076e+23).  NaN and infinity are written as
+ * @c nan and @c inf.
+ *
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.  Must have room for @c MAX_FORMATTED_NUMBER_SIZE characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatDouble(double value, char* out);
+
+/**
+ * Format a float as @c formatDouble() does, with the fewest significant digits that read back as the same float.
+ *
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.  Must have room for @c MAX_FORMATTED_NUMBER_SIZE characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatFloat(float value, char* out);
+
+/**
+ * Format a pointer as @c std::ostream does: in hexadecimal with a @c 0x prefix, or @c 0 if it is null.
+ *
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.  Must have room for @c MAX_FORMATTED_NUMBER_SIZE characters.
+ * @return The number of characters written to @c out.
+ */
+size_t formatPointer(const void* value, char* out);
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_NUMBERFORMATTING_H_
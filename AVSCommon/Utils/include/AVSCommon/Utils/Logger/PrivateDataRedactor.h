@@ -0,0 +1,119 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_PRIVATEDATAREDACTOR_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_PRIVATEDATAREDACTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Obfuscates the private part of values passed to @c LogEntry::obfuscatePrivateData().  A value is private from the
+ * end of the first label from a deny list that it contains, ignoring case, onward.  That part is replaced with a
+ * keyed hash of it, so that values can be told apart and correlated across runs without being revealed.
+ *
+ * The deny list is compiled once in to an Aho-Corasick automaton over case-folded bytes, so that a value is scanned
+ * once however many labels there are.  The hash is SipHash-2-4, which is stable for a given key.
+ *
+ * Labels are added to the built in deny list, and the hash key is set, with the @c "logger" configuration object.
+ * The key is 32 hex digits.  Without one, a built in key is used, which keeps hashes stable but lets anyone with the
+ * source compute them:
+ *
+ *     "logger" : {
+ *         "privateLabels" : ["ssid", "bssid"],
+ *         "privateDataHashKey" : "000102030405060708090a0b0c0d0e0f"
+ *     }
+ */
+class PrivateDataRedactor {
+public:
+    /**
+     * Return the one and only @c PrivateDataRedactor instance, built from the configuration the first time it is
+     * called.
+     *
+     * @return The one and only @c PrivateDataRedactor instance.
+     */
+    static const PrivateDataRedactor& instance();
+
+    /**
+     * Constructor.
+     *
+     * @param labels The labels that private data follows.  Empty labels are ignored.
+     * @param key0 The first half of the hash key.
+     * @param key1 The second half of the hash key.
+     */
+    PrivateDataRedactor(const std::vector<std::string>& labels, uint64_t key0, uint64_t key1);
+
+    /**
+     * Find the end of the first label in a value.  Where labels overlap, this is the one that ends first.
+     *
+     * @param data The value.
+     * @param length The length of @c data.
+     * @return The position just past the end of the first label, or @c std::string::npos if there is none.
+     */
+    size_t findLabelEnd(const char* data, size_t length) const;
+
+    /**
+     * Compute the keyed hash of some data.
+     *
+     * @param data The data.
+     * @param length The length of @c data.
+     * @return The hash of @c data.
+     */
+    uint64_t hash(const char* data, size_t length) const;
+
+    /**
+     * Obfuscate a value, if it contains a label.
+     *
+     * @param value The value.
+     * @param[out] out If @c value contains a label, @c value up to the end of the label, followed by the hash of the
+     * rest of @c value in hex.
+     * @return Whether @c value contains a label.
+     */
+    bool redact(const std::string& value, std::string* out) const;
+
+private:
+    /// Each byte's class: the index of its case-folded form among the bytes that appear in labels, or 0 if none.
+    uint8_t m_classes[256];
+
+    /// The number of byte classes.
+    size_t m_classCount;
+
+    /**
+     * The transitions of the automaton, indexed by the offset of a state's transitions plus byte class.  Each is the
+     * offset of the next state's transitions, with its top bit set if reaching that state means a label has just
+     * ended.
+     */
+    std::vector<uint32_t> m_transitions;
+
+    /// The first half of the hash key.
+    const uint64_t m_key0;
+
+    /// The second half of the hash key.
+    const uint64_t m_key1;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_PRIVATEDATAREDACTOR_H_
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_THREADMONIKER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_THREADMONIKER_H_
 
+#include <cstddef>
 #include <iomanip>
 #include <string>
 #include <sstream>
@@ -31,9 +32,19 @@ namespace logger {
  *
  * The name ThreadMoniker is used instead of ThreadId to avoid confusion with platform specific thread identifiers
  * or the @c std::thread::id values rendered as a string.
+ *
+ * Monikers are kept in a fixed size array so that @c getThisThreadMonikerCString() can be used on the logging hot
+ * path without copying or allocating.  Monikers longer than @c MAX_MONIKER_LENGTH are truncated.
+ *
+ * If built with @c ACSDK_SET_OS_THREAD_NAMES defined, monikers passed to @c setThisThreadMoniker() are also set as
+ * the operating system's name for the thread (truncated to 15 characters on Linux), so that tools such as @c perf and
+ * @c top @c -H show the same names as the logs.
  */
 class ThreadMoniker {
 public:
+    /// The maximum length of a moniker, not including the null terminator.
+    static constexpr size_t MAX_MONIKER_LENGTH = 31;
+
     /**
      * Get the moniker for @c std::this_thread.
      *
@@ -41,6 +52,13 @@ public:
      */
     static inline std::string getThisThreadMoniker();
 
+    /**
+     * Get the moniker for @c std::this_thread without copying it.
+     *
+     * @return The moniker for @c std::this_thread.  Valid for the lifetime of @c std::this_thread.
+     */
+    static inline const char* getThisThreadMonikerCString();
+
     /**
      * Generate a unique moniker.
      *
@@ -81,13 +99,17 @@ private:
     static const ThreadMoniker& getMonikerObjectFromMap(const std::string& moniker = std::string());
 
     /// The current thread's moniker.
-    std::string m_moniker;
+    char m_moniker[MAX_MONIKER_LENGTH + 1];
 };
 
 std::string ThreadMoniker::getThisThreadMoniker() {
     return getMonikerObject().m_moniker;
 }
 
+const char* ThreadMoniker::getThisThreadMonikerCString() {
+    return getMonikerObject().m_moniker;
+}
+
 void ThreadMoniker::setThisThreadMoniker(const std::string& moniker) {
     getMonikerObject(moniker);
 }
@@ -18,7 +18,6 @@
 
 #include <ctime>
 #include <memory>
-#include <mutex>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -26,8 +25,12 @@ namespace utils {
 namespace timing {
 
 /**
- * This class allows access safe access to the multithreaded-unsafe time functions.  It is a singleton because there
- * needs to be a single lock that protects the time functions.  That single lock is contained within this class.
+ * This class allows safe access to the multithreaded-unsafe time functions.
+ *
+ * UTC conversions are done with integer arithmetic on the proleptic Gregorian calendar, and local time conversions
+ * use the reentrant @c localtime_r (@c localtime_s on Windows), so no lock is needed and threads converting times
+ * concurrently do not contend with each other.  It remains a singleton so that existing users that hold on to the
+ * instance keep working.
  */
 class SafeCTimeAccess {
 public:
@@ -40,7 +43,7 @@ public:
     static std::shared_ptr<SafeCTimeAccess> instance();
 
     /**
-     * Function to safely call std::gmtime.  std::gmtime uses a static internal data structure that is not thread-safe.
+     * Thread-safe equivalent of std::gmtime, which uses a static internal data structure that is not thread-safe.
      *
      * @param time The time since epoch to convert.
      * @param[out] time The output in calendar time, expressed in UTC time.
@@ -49,8 +52,7 @@ public:
     bool getGmtime(const std::time_t& time, std::tm* calendarTime);
 
     /**
-     * Function to safely call std::localtime.  std::localtime uses a static internal data structure that is not
-     * thread-safe.
+     * Thread-safe equivalent of std::localtime, which uses a static internal data structure that is not thread-safe.
      *
      * @param time The time since epoch to convert.
      * @param[out] time The output in calendar time, expressed in UTC time.
@@ -59,23 +61,11 @@ public:
     bool getLocaltime(const std::time_t& time, std::tm* calendarTime);
 
 private:
-    SafeCTimeAccess() = default;
-
     /**
-     * Helper function to eliminate duplicate code, because getGmtime and getLocaltime are almost identical.
-     *
-     * @param timeAccessFunction One of two funtions (std::gmtime and std::localtime) that need to be safely accessed.
-     * @param time The time since epoch to convert.
-     * @param[out] time The output in calendar time, expressed in UTC time.
-     * @return true if successful, false otherwise.
+     * Constructor.  Initializes the time zone information used by @c getLocaltime(), since the reentrant local
+     * time functions are not required to do so.
      */
-    bool safeAccess(
-        std::tm* (*timeAccessFunction)(const std::time_t* time),
-        const std::time_t& time,
-        std::tm* calendarTime);
-
-    /// Mutex used to protect access to the ctime functions.
-    std::mutex m_timeLock;
+    SafeCTimeAccess();
 };
 
 }  // namespace timing
@@ -0,0 +1,87 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STEADYTIMERSERVICE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STEADYTIMERSERVICE_H_
+
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerService on @c std::chrono::steady_clock, which waits for its wakeups on a condition variable.
+ *
+ * Its wheel is driven by a small, fixed number of service threads, which also make the calls of the timers, so the
+ * number of threads stays the same however many timers are active.  One thread at a time waits for the next wakeup;
+ * the others make the calls that have fallen due.
+ */
+class SteadyTimerService : public TimerService {
+public:
+    /**
+     * Get the service shared by the @c WheelTimerDelegate instances that are not given one, creating it and starting
+     * its threads on first use.  It is never destroyed, so that timers may be used from static destructors.
+     *
+     * @return The service.
+     */
+    static std::shared_ptr<SteadyTimerService> instance();
+
+    /// @name TimerService Functions
+    /// @{
+    std::chrono::nanoseconds now() const override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param threadCount The number of service threads to start.
+     */
+    explicit SteadyTimerService(size_t threadCount);
+
+    /// @name TimerService Functions
+    /// @{
+    void onWakeupChangedLocked() override;
+    /// @}
+
+    /// The loop of each service thread.
+    void serviceLoop();
+
+    /// Notifies the thread waiting for the next wakeup that an earlier one was scheduled.
+    std::condition_variable m_wheelCondition;
+
+    /// Notifies the other threads that there are calls to make, or that no thread is waiting for the next wakeup.
+    std::condition_variable m_workCondition;
+
+    /// Whether a thread is waiting for the next wakeup.
+    bool m_hasLeader;
+
+    /// The service threads.
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STEADYTIMERSERVICE_H_
@@ -18,13 +18,17 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 
 #include "AVSCommon/Utils/Error/FinallyGuard.h"
 #include "AVSCommon/AVS/Initialization/SDKPrimitivesProvider.h"
+#include "AVSCommon/Utils/Functional/InlineTask.h"
+#include "AVSCommon/Utils/Logger/LogContext.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Timing/TimerDelegate.h"
 
@@ -35,6 +39,10 @@ namespace timing {
 
 /**
  * A @c Timer is used to schedule a callable type to run in the future.
+ *
+ * The task is kept in an @c InlineTask owned by the @c Timer, and the @c TimerDelegate is given a small function that
+ * calls it, so starting a timer with a task that fits in an @c InlineTask does not allocate, unless the starting
+ * thread is in a @c LogContext.
  */
 class Timer {
 public:
@@ -170,10 +178,32 @@ public:
     auto start(const std::chrono::duration<Rep, Period>& delay, Task task, Args&&... args)
         -> std::future<decltype(task(args...))>;
 
+    /**
+     * Submits a callable type to be executed once, after the specified duration, and then passes its return value to
+     * a completion callable, on the same thread.  Unlike the overload of @c start() returning a @c std::future, this
+     * does not allocate a shared state, so it suits callers that do not block waiting for the result.  A @c Timer
+     * instance manages only one running @c Timer at a time; calling @c startThen() on an already-running @c Timer
+     * will fail.
+     *
+     * @tparam Rep A type for measuring 'ticks' in a generic @c std::chrono::duration.
+     * @tparam Period A type for representing the number of ticks per second in a generic @c std::chrono::duration.
+     * @tparam Task The type of task to execute.
+     * @tparam Completion The type of the completion callable.
+     *
+     * @param delay The non-negative time to wait before calling @c task.  Negative values will cause this
+     *    function to return false.
+     * @param task A callable type representing a task.
+     * @param completion A callable type called with the return value of @c task, or with no arguments if @c task
+     *     returns @c void.  It is not called if @c stop() is called before @c task is called.
+     * @returns @c true if the timer started, else @c false.
+     */
+    template <typename Rep, typename Period, typename Task, typename Completion>
+    bool startThen(const std::chrono::duration<Rep, Period>& delay, Task task, Completion completion);
+
     /**
      * Stops the @c Timer (if running).  This will not interrupt an active call to the task, but will prevent any
      * subequent calls to the task.  If @c stop() is called while the task is executing, this function will block until
-     * the task completes.
+     * the task completes.  The task, and anything it captured, is then released.
      *
      * @note In the special case that @c stop() is called from inside the task function, @c stop() will still prevent
      *     any subsequent calls to the task, but will *not* block as described above.
@@ -190,6 +220,37 @@ public:
     bool isActive() const;
 
 private:
+    /**
+     * A task followed by a completion callable, for @c startThen().
+     *
+     * @tparam Task The type of task to execute.
+     * @tparam Completion The type of the completion callable.
+     */
+    template <typename Task, typename Completion>
+    struct Continuation {
+        /// Call the task, and then the completion callable with its return value.
+        void operator()() {
+            call(std::is_void<decltype(task())>());
+        }
+
+        /// Call the task, and then the completion callable with its return value.
+        void call(std::false_type) {
+            completion(task());
+        }
+
+        /// Call the task, and then the completion callable with no arguments.
+        void call(std::true_type) {
+            task();
+            completion();
+        }
+
+        /// The task.
+        Task task;
+
+        /// The completion callable.
+        Completion completion;
+    };
+
     /**
      * Atomically activates this @c Timer (by setting @c m_running).
      *
@@ -217,12 +278,29 @@ private:
         std::chrono::duration<Rep, Period> period,
         PeriodType periodType,
         size_t maxCount,
-        std::function<void()> task);
+        functional::InlineTask task);
+
+    /**
+     * Call @c m_task, from the @c TimerDelegate.  The task is taken out of @c m_task while it runs, so that it may
+     * restart the timer with a new task, and is put back afterwards unless the timer was restarted.
+     *
+     * @param generation The value of @c m_taskGeneration when the timer was started.
+     */
+    void runTask(uint64_t generation);
 
     /// The mutex to protect the @c TimerDelegate.
     mutable std::mutex m_mutex;
 
-    /// The @c TimerDelegateInterface which contains timer related logic.
+    /// The mutex to protect @c m_task and @c m_taskGeneration.
+    std::mutex m_taskMutex;
+
+    /// The task, between calls.  Released by @c stop().
+    functional::InlineTask m_task;
+
+    /// Incremented each time the timer is started, so that a call of a previous task does not put it back.
+    uint64_t m_taskGeneration{0};
+
+    /// The @c TimerDelegateInterface which contains timer related logic.  Declared after @c m_task, which it calls.
     std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> m_timer;
 
     /// The thread to execute tasks on.
@@ -252,15 +330,10 @@ bool Timer::start(
         return false;
     }
 
-    // Remove arguments from the task's type by binding the arguments to the task.
-    using BoundTaskType = decltype(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
-    auto boundTask = std::make_shared<BoundTaskType>(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
-
-    // Remove the return type from the task by wrapping it in a lambda with no return value.
-    auto translatedTask = [boundTask]() { boundTask->operator()(); };
-
-    // Kick off the new timer thread.
-    callTask<Rep, Period>(delay, period, periodType, maxCount, translatedTask);
+    // Remove arguments from the task's type by binding the arguments to the task.  The InlineTask discards the return
+    // value.
+    callTask<Rep, Period>(
+        delay, period, periodType, maxCount, std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
 
     return true;
 }
@@ -294,16 +367,38 @@ auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Ar
      * will then return a future of the correct type.
      */
     using PackagedTaskType = std::packaged_task<decltype(boundTask())()>;
-    auto packagedTask = std::make_shared<PackagedTaskType>(boundTask);
-
-    // Remove the return type from the task by wrapping it in a lambda with no return value.
-    auto translatedTask = [packagedTask]() { packagedTask->operator()(); };
+    PackagedTaskType packagedTask(std::move(boundTask));
+    auto future = packagedTask.get_future();
 
     // Kick off the new timer thread.
     static const size_t once = 1;
-    callTask<Rep, Period>(delay, delay, PeriodType::ABSOLUTE, once, translatedTask);
+    callTask<Rep, Period>(delay, delay, PeriodType::ABSOLUTE, once, std::move(packagedTask));
+
+    return future;
+}
+
+template <typename Rep, typename Period, typename Task, typename Completion>
+bool Timer::startThen(const std::chrono::duration<Rep, Period>& delay, Task task, Completion completion) {
+    if (delay < std::chrono::duration<Rep, Period>::zero()) {
+        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startThenFailed").d("reason", "negativeDelay"));
+        return false;
+    }
+
+    // Don't start if already running.
+    if (!activate()) {
+        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startThenFailed").d("reason", "timerAlreadyActive"));
+        return false;
+    }
+
+    static const size_t once = 1;
+    callTask<Rep, Period>(
+        delay,
+        delay,
+        PeriodType::ABSOLUTE,
+        once,
+        Continuation<Task, Completion>{std::move(task), std::move(completion)});
 
-    return packagedTask->get_future();
+    return true;
 }
 
 template <typename Rep, typename Period>
@@ -312,7 +407,7 @@ void Timer::callTask(
     std::chrono::duration<Rep, Period> period,
     PeriodType periodType,
     size_t maxCount,
-    std::function<void()> task) {
+    functional::InlineTask task) {
     if (!m_timer) {
         logger::acsdkError(logger::LogEntry(Timer::getTag(), "callTaskFailed").d("reason", "nullTimerDelegate"));
         return;
@@ -329,12 +424,39 @@ void Timer::callTask(
             break;
     }
 
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(m_taskMutex);
+        m_task = std::move(task);
+        generation = ++m_taskGeneration;
+    }
+
+    // Run the task in the log context of the thread that started the timer.  The function given to the delegate is
+    // small enough for std::function to keep without allocating.
     m_timer->start(
         std::chrono::duration_cast<std::chrono::nanoseconds>(delay),
         std::chrono::duration_cast<std::chrono::nanoseconds>(period),
         delegatePeriodType,
         maxCount,
-        task);
+        logger::LogContext::bind([this, generation]() { runTask(generation); }));
+}
+
+inline void Timer::runTask(uint64_t generation) {
+    functional::InlineTask task;
+    {
+        std::lock_guard<std::mutex> lock(m_taskMutex);
+        if (generation != m_taskGeneration) {
+            return;
+        }
+        task = std::move(m_task);
+    }
+
+    task();
+
+    std::lock_guard<std::mutex> lock(m_taskMutex);
+    if (generation == m_taskGeneration && !m_task) {
+        m_task = std::move(task);
+    }
 }
 
 }  // namespace timing
@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERFDTIMERSERVICE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERFDTIMERSERVICE_H_
+
+#include <condition_variable>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerService on @c CLOCK_BOOTTIME, which keeps counting while the system is suspended, so that it supports
+ * low power mode.
+ *
+ * Like @c SteadyTimerService, the service has a small, fixed number of service threads, one of which at a time waits
+ * for the next wakeup while the others make the calls that have fallen due, so a call that blocks does not hold up
+ * the other timers.  The waiting thread waits in @c epoll_wait() on one @c timerfd, armed at the next wakeup of the
+ * service, and on one @c eventfd, written when an earlier wakeup is scheduled.  However many timers are active, the
+ * process has one kernel timer armed, and with a slack set on the timers, deadlines that fall close together share a
+ * wakeup.
+ */
+class TimerFdTimerService : public TimerService {
+public:
+    /**
+     * Get the service, creating it and starting its thread on first use.  It is never destroyed, so that timers may
+     * be used from static destructors.
+     *
+     * @return The service, or @c nullptr if the kernel objects it needs could not be created.
+     */
+    static std::shared_ptr<TimerFdTimerService> instance();
+
+    /// @name TimerService Functions
+    /// @{
+    std::chrono::nanoseconds now() const override;
+    bool supportsLowPowerMode() const override;
+    /// @}
+
+private:
+    /// Constructor.
+    TimerFdTimerService();
+
+    /**
+     * Create the file descriptors of the service and start its threads.
+     *
+     * @param threadCount The number of service threads to start.
+     * @param[out] error Set to a description of the failure, if there is one.
+     * @return Whether the file descriptors were created.
+     */
+    bool init(size_t threadCount, std::string* error);
+
+    /// @name TimerService Functions
+    /// @{
+    void onWakeupChangedLocked() override;
+    /// @}
+
+    /**
+     * Arm the @c timerfd at a time, or disarm it.  @c m_mutex must be held.
+     *
+     * @param time The time on the clock of the service, or @c NEVER to disarm the @c timerfd.
+     */
+    void armLocked(std::chrono::nanoseconds time);
+
+    /// The loop of each service thread.
+    void serviceLoop();
+
+    /// Wait in @c epoll_wait() for the @c timerfd or the @c eventfd, and reset whichever is ready.
+    void waitForWakeup();
+
+    /// The @c epoll file descriptor that the service thread waits on.
+    int m_epollFd;
+
+    /// The @c timerfd armed at @c m_plannedWakeup.
+    int m_timerFd;
+
+    /// The @c eventfd written when a wakeup earlier than @c m_plannedWakeup is scheduled.
+    int m_eventFd;
+
+    /// Notifies the other threads that there are calls to make, or that no thread is waiting for the next wakeup.
+    std::condition_variable m_workCondition;
+
+    /// Whether a thread is waiting for the next wakeup.
+    bool m_hasLeader;
+
+    /// The service threads.
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERFDTIMERSERVICE_H_
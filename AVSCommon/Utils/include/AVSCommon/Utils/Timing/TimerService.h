@@ -0,0 +1,251 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateInterface.h>
+
+#include "AVSCommon/Utils/Functional/InlineTask.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * Keeps the timers of @c WheelTimerDelegate instances and makes their calls, with the semantics of @c TimerDelegate.
+ *
+ * The deadlines of the timers are kept in a @c TimerWheel, as times on the clock of the service.  Each timer may
+ * also have a slack, by which its calls may be late: the service wakes up at the earliest time a call can be put off
+ * to, and makes every call that is due by then, so that timers whose deadlines fall within their slack of each other
+ * share a single wakeup.  The calls that fall due at a wakeup are made in the order of their deadlines, and calls
+ * with the same deadline in the order they were scheduled.
+ *
+ * The subclasses provide the clock, and the threads that wait for the wakeups and make the calls.
+ */
+class TimerService {
+public:
+    /// The way the period of a timer is measured.
+    using PeriodType = sdkInterfaces::timing::TimerDelegateInterface::PeriodType;
+
+    /// A timer kept by the service.
+    struct Entry;
+
+    /**
+     * Destructor.
+     */
+    virtual ~TimerService();
+
+    /**
+     * Create a timer, which is inactive until it is started.
+     *
+     * @return The timer.
+     */
+    std::shared_ptr<Entry> createTimer();
+
+    /**
+     * Start a timer, as @c TimerDelegateInterface::start().
+     *
+     * @param timer The timer.
+     * @param delay The non-negative time to wait before making the first call.
+     * @param period The non-negative time to wait between calls.
+     * @param periodType How @c period is measured.
+     * @param maxCount The number of calls to make, or zero to make calls until the timer is stopped.
+     * @param task The task to call.
+     */
+    void start(
+        const std::shared_ptr<Entry>& timer,
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        functional::InlineTask task);
+
+    /**
+     * Stop a timer, as @c TimerDelegateInterface::stop().  Waits for a call in progress to complete, unless it is
+     * called from the task.
+     *
+     * @param timer The timer.
+     */
+    void stop(const std::shared_ptr<Entry>& timer);
+
+    /**
+     * Activate a timer, as @c TimerDelegateInterface::activate().
+     *
+     * @param timer The timer.
+     * @return @c false if the timer was already active.
+     */
+    bool activate(const std::shared_ptr<Entry>& timer);
+
+    /**
+     * Return whether a timer is active, as @c TimerDelegateInterface::isActive().
+     *
+     * @param timer The timer.
+     * @return Whether the timer is active.
+     */
+    bool isActive(const std::shared_ptr<Entry>& timer) const;
+
+    /**
+     * Set how late the calls of a timer may be made, from the next time it is started.
+     *
+     * @param timer The timer.
+     * @param slack The non-negative slack.
+     */
+    void setSlack(const std::shared_ptr<Entry>& timer, std::chrono::nanoseconds slack);
+
+    /**
+     * Get the time on the clock of the service.
+     *
+     * @return The time since the epoch of the clock.
+     */
+    virtual std::chrono::nanoseconds now() const = 0;
+
+    /**
+     * Return whether the clock of the service keeps counting, and its timers keep their deadlines, while the system
+     * is suspended.
+     *
+     * @return Whether the service supports low power mode.
+     */
+    virtual bool supportsLowPowerMode() const;
+
+protected:
+    /// The value of @c m_plannedWakeup and of @c getNextWakeupLocked() when there is no wakeup.
+    static const std::chrono::nanoseconds NEVER;
+
+    /**
+     * Constructor.
+     */
+    TimerService();
+
+    /**
+     * Called with @c m_mutex held when a timer is scheduled to wake up before @c m_plannedWakeup, so that the
+     * subclass can wake up sooner.
+     */
+    virtual void onWakeupChangedLocked() = 0;
+
+    /**
+     * Get the time the service should next wake up at, which may be earlier than the next call is due if the
+     * @c TimerWheel needs to cascade first.  @c m_mutex must be held.
+     *
+     * @return The time, or @c NEVER if no timer is scheduled.
+     */
+    std::chrono::nanoseconds getNextWakeupLocked() const;
+
+    /**
+     * Make the timers that are due by a time ready to be called.  @c m_mutex must be held.
+     *
+     * @param time The time on the clock of the service.
+     */
+    void collectDueLocked(std::chrono::nanoseconds time);
+
+    /**
+     * Return whether there are timers ready to be called.  @c m_mutex must be held.
+     *
+     * @return Whether there are timers ready to be called.
+     */
+    bool hasReadyLocked() const;
+
+    /**
+     * Make the call of the first timer that is ready, with @c m_mutex released while the task runs.
+     *
+     * @param lock The lock holding @c m_mutex.
+     * @return @c false if no timer was ready.
+     */
+    bool runReadyLocked(std::unique_lock<std::mutex>& lock);
+
+    /// Serializes access to the timers, and to the members of the subclasses that wait for wakeups.
+    std::mutex m_mutex;
+
+    /**
+     * The time the subclass will next wake up at, or @c NEVER if it will not unless @c onWakeupChangedLocked() is
+     * called.  Set by the subclass.
+     */
+    std::chrono::nanoseconds m_plannedWakeup;
+
+private:
+    /// A node of a timer in one of the wheels.
+    struct TimerNode : public TimerWheel::Node {
+        /// The timer.
+        Entry* timer;
+    };
+
+    /**
+     * Schedule the next call of a timer at its @c deadline, replacing any that was scheduled before.  The mutex of
+     * the timer must be held.
+     *
+     * @param timer The timer.
+     */
+    void schedule(Entry* timer);
+
+    /**
+     * Cancel the next call of a timer, if one is scheduled.  The mutex of the timer must be held.
+     *
+     * @param timer The timer.
+     */
+    void cancel(Entry* timer);
+
+    /**
+     * Remove a timer from the wheels.  @c m_mutex must be held.
+     *
+     * @param timer The timer.
+     */
+    void unlinkLocked(Entry* timer);
+
+    /**
+     * Make a call of a timer, unless it was stopped or restarted since it fell due, and schedule the next.
+     *
+     * @param timer The timer.
+     * @param generation The generation the call was scheduled in.
+     */
+    void call(const std::shared_ptr<Entry>& timer, uint64_t generation);
+
+    /**
+     * Convert a time to the tick of the wheels that it falls in.
+     *
+     * @param time The time.
+     * @return The first tick at or after @c time.
+     */
+    static uint64_t toTick(std::chrono::nanoseconds time);
+
+    /// The timers by the time their next call is due.
+    TimerWheel m_dueWheel;
+
+    /// The timers by the latest time their next call may be made, their deadline plus their slack.
+    TimerWheel m_wakeupWheel;
+
+    /// The timers that have fallen due, with the generation they were scheduled in, from @c m_readyHead on.
+    std::vector<std::pair<std::shared_ptr<Entry>, uint64_t>> m_ready;
+
+    /// The index of the first entry of @c m_ready that has not been taken.
+    size_t m_readyHead;
+
+    /// The number of times a timer has been scheduled, which orders the calls of timers with the same deadline.
+    uint64_t m_sequence;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
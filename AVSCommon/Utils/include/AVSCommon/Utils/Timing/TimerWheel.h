@@ -0,0 +1,254 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A hierarchical timing wheel, which keeps any number of pending deadlines with O(1) insertion and removal.
+ *
+ * Time is divided in to ticks of a fixed resolution.  The first level of the wheel has a slot for each of the next
+ * 256 ticks, and each of the three levels above it has 64 slots, each spanning a whole turn of the level below.  A
+ * deadline goes in to the lowest level whose span reaches it, and the slots of the upper levels are cascaded down a
+ * level each time the level below them completes a turn, so every deadline is handled a constant number of times
+ * however far away it is.  Deadlines beyond the span of the top level (about 18 hours at a resolution of one
+ * millisecond) are parked in its furthest slot and placed again when it cascades.
+ *
+ * The nodes of the wheel are intrusive, so inserting and removing a deadline never allocates.  The class is not
+ * thread safe; its users keep it behind their own lock.
+ */
+class TimerWheel {
+public:
+    /// The clock that deadlines are measured with.
+    using Clock = std::chrono::steady_clock;
+
+    /// A tick that no deadline is ever at, returned by @c getNextTick() when the wheel is empty.
+    static constexpr uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+    /// A deadline in the wheel.  Embed or derive from it; it must stay put while it is in the wheel.
+    struct Node {
+        /// Constructor.
+        Node();
+
+        /**
+         * Return whether the node is in a wheel.
+         *
+         * @return Whether the node is in a wheel.
+         */
+        bool isLinked() const;
+
+        /// The previous node in the same slot, or @c nullptr if this is the first.
+        Node* prev;
+
+        /// The next node in the same slot, or @c nullptr if this is the last.
+        Node* next;
+
+        /// The tick the node is due at.
+        uint64_t tick;
+
+        /// The index of the slot the node is in, or @c NOT_LINKED.
+        int32_t slot;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param resolution The length of a tick.  Deadlines are rounded up to a whole tick.
+     * @param start The time of tick zero.
+     */
+    explicit TimerWheel(
+        std::chrono::nanoseconds resolution = std::chrono::milliseconds(1),
+        Clock::time_point start = Clock::now());
+
+    /**
+     * Get the first tick at or after a time, which is the tick a deadline at that time is due at.
+     *
+     * @param time The time.
+     * @return The tick.
+     */
+    uint64_t toTick(Clock::time_point time) const;
+
+    /**
+     * Get the last tick at or before a time, which is the latest tick that has passed by then.
+     *
+     * @param time The time.
+     * @return The tick.
+     */
+    uint64_t toElapsedTick(Clock::time_point time) const;
+
+    /**
+     * Get the time of a tick.
+     *
+     * @param tick The tick.
+     * @return The time the tick starts.
+     */
+    Clock::time_point toTimePoint(uint64_t tick) const;
+
+    /**
+     * Add a node to the wheel.  A tick that has already been advanced past is due at the next call to @c advance().
+     *
+     * @param node The node, which must not be in a wheel.
+     * @param tick The tick the node is due at.
+     */
+    void insert(Node* node, uint64_t tick);
+
+    /**
+     * Remove a node from the wheel.
+     *
+     * @param node The node, which must be in this wheel.
+     */
+    void remove(Node* node);
+
+    /**
+     * Get the number of nodes in the wheel.
+     *
+     * @return The number of nodes in the wheel.
+     */
+    size_t size() const;
+
+    /**
+     * Get the tick by which @c advance() should next be called: the earliest tick a node is due at, or earlier if
+     * the wheel cannot tell without cascading a slot of an upper level first.
+     *
+     * @return The tick, or @c NO_TICK if the wheel is empty.
+     */
+    uint64_t getNextTick() const;
+
+    /**
+     * Advance the wheel up to and including a tick, removing each node due by then and passing it to a function.
+     *
+     * @tparam Expire The type of @c expire, callable as @c void(Node*).
+     * @param tick The tick to advance to.
+     * @param expire The function to pass each due node to, after it has been removed.  It must not insert in to or
+     * remove from this wheel.
+     */
+    template <typename Expire>
+    void advance(uint64_t tick, Expire expire);
+
+private:
+    /**
+     * Add a node to the slot its tick belongs in, relative to @c m_next.
+     *
+     * @param node The node.
+     */
+    void place(Node* node);
+
+    /**
+     * Cascade the slots of the upper levels that are due now that @c m_next has reached the start of a turn of the
+     * first level.
+     */
+    void cascade();
+
+    /**
+     * Take all of the nodes out of a slot.
+     *
+     * @param slot The index of the slot.
+     * @return The first of the nodes, linked through @c Node::next, or @c nullptr if the slot was empty.
+     */
+    Node* takeSlot(int32_t slot);
+
+    /**
+     * Skip @c m_next ahead to the next tick that has something to do, but not past a limit.
+     *
+     * @param limit The tick after the last tick to skip to.
+     */
+    void skipIdleTicks(uint64_t limit);
+
+    /// The number of bits of a tick that index the first level.
+    static constexpr int FIRST_LEVEL_BITS = 8;
+
+    /// The number of bits of a tick that index each upper level.
+    static constexpr int UPPER_LEVEL_BITS = 6;
+
+    /// The number of levels.
+    static constexpr int LEVEL_COUNT = 4;
+
+    /// The number of slots in the first level.
+    static constexpr int FIRST_LEVEL_SIZE = 1 << FIRST_LEVEL_BITS;
+
+    /// The number of slots in each upper level.
+    static constexpr int UPPER_LEVEL_SIZE = 1 << UPPER_LEVEL_BITS;
+
+    /// The number of slots in all levels.
+    static constexpr int SLOT_COUNT = FIRST_LEVEL_SIZE + (LEVEL_COUNT - 1) * UPPER_LEVEL_SIZE;
+
+    /// The number of 64 bit words in the bitmap of the first level.
+    static constexpr int FIRST_LEVEL_WORDS = FIRST_LEVEL_SIZE / 64;
+
+    /// The value of @c Node::slot for nodes that are not in a wheel.
+    static constexpr int32_t NOT_LINKED = -1;
+
+    /// The length of a tick.
+    const std::chrono::nanoseconds m_resolution;
+
+    /// The time of tick zero.
+    const Clock::time_point m_start;
+
+    /// The next tick to process.  Every tick before it has been advanced past.
+    uint64_t m_next;
+
+    /// The number of nodes in the wheel.
+    size_t m_size;
+
+    /// The first node of each slot.
+    Node* m_slots[SLOT_COUNT];
+
+    /// A bit for each slot of the first level, set if the slot is not empty.
+    uint64_t m_firstLevelBitmap[FIRST_LEVEL_WORDS];
+
+    /// A bit for each slot of each upper level, set if the slot is not empty.  Index 0 is unused.
+    uint64_t m_upperLevelBitmaps[LEVEL_COUNT];
+};
+
+template <typename Expire>
+void TimerWheel::advance(uint64_t tick, Expire expire) {
+    while (m_next <= tick) {
+        if (0 == m_size) {
+            m_next = tick + 1;
+            return;
+        }
+        auto index = static_cast<int32_t>(m_next & (FIRST_LEVEL_SIZE - 1));
+        if (0 == index) {
+            cascade();
+        }
+        auto node = takeSlot(index);
+        while (node) {
+            auto next = node->next;
+            node->prev = nullptr;
+            node->next = nullptr;
+            expire(node);
+            node = next;
+        }
+        m_next++;
+        skipIdleTicks(tick + 1);
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
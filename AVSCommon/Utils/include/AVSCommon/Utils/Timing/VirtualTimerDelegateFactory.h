@@ -0,0 +1,80 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERDELEGATEFACTORY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERDELEGATEFACTORY_H_
+
+#include <chrono>
+#include <memory>
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateFactoryInterface.h>
+
+#include "AVSCommon/Utils/Timing/VirtualTimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateFactoryInterface for tests, whose timers run on the virtual clock of a @c VirtualTimerService.
+ * A test passes it to the constructor of each @c Timer under test, and moves time on with @c advance() or
+ * @c runUntilIdle(), which make the calls of the timers on the calling thread:
+ *
+ *     auto factory = std::make_shared<VirtualTimerDelegateFactory>();
+ *     Timer timer(factory);
+ *     timer.start(std::chrono::minutes(10), [] { ... });
+ *     factory->advance(std::chrono::minutes(10));    // Calls the task, and returns at once.
+ */
+class VirtualTimerDelegateFactory : public avsCommon::sdkInterfaces::timing::TimerDelegateFactoryInterface {
+public:
+    /// Constructor.
+    VirtualTimerDelegateFactory();
+
+    /// @name TimerDelegateFactoryInterface Functions
+    /// @{
+    bool supportsLowPowerMode() override;
+    std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> getTimerDelegate() override;
+    /// @}
+
+    /**
+     * Get the time on the virtual clock.
+     *
+     * @return The time since the clock started.
+     */
+    std::chrono::nanoseconds now() const;
+
+    /**
+     * Move the virtual clock forward, as @c VirtualTimerService::advance().
+     *
+     * @param duration The non-negative time to move the clock by.
+     */
+    void advance(std::chrono::nanoseconds duration);
+
+    /**
+     * Move the virtual clock forward until no timer is active, as @c VirtualTimerService::runUntilIdle().
+     */
+    void runUntilIdle();
+
+private:
+    /// The service keeping the timers.
+    std::shared_ptr<VirtualTimerService> m_service;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERDELEGATEFACTORY_H_
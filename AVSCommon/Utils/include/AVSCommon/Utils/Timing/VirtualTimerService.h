@@ -0,0 +1,83 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERSERVICE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERSERVICE_H_
+
+#include <atomic>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerService on a virtual clock, for tests.  The clock starts at zero and only moves when @c advance() or
+ * @c runUntilIdle() is called, and the calls of the timers that fall due are made on the thread calling them, in the
+ * order of their deadlines, so a test of code waiting out long delays runs in no time and the same way on every run.
+ * As with the other services, deadlines are rounded up to a whole millisecond.
+ *
+ * @c advance() and @c runUntilIdle() must be called from one thread at a time.
+ */
+class VirtualTimerService : public TimerService {
+public:
+    /// Constructor.
+    VirtualTimerService();
+
+    /// @name TimerService Functions
+    /// @{
+    std::chrono::nanoseconds now() const override;
+    /// @}
+
+    /**
+     * Move the clock forward, making the calls that fall due on the way, each at the time it falls due.  Calls that
+     * are scheduled by the tasks are also made, if they fall due by the end.
+     *
+     * @param duration The non-negative time to move the clock by.
+     */
+    void advance(std::chrono::nanoseconds duration);
+
+    /**
+     * Move the clock forward until no timer is active, making the calls that fall due on the way.  This does not
+     * return while a timer repeats forever.
+     */
+    void runUntilIdle();
+
+private:
+    /// @name TimerService Functions
+    /// @{
+    void onWakeupChangedLocked() override;
+    /// @}
+
+    /**
+     * Make the calls that fall due up to a time, moving the clock to each wakeup on the way.
+     *
+     * @param lock The lock holding @c m_mutex.
+     * @param time The time to stop at, or @c NEVER to stop once no call is scheduled.
+     */
+    void runUntilLocked(std::unique_lock<std::mutex>& lock, std::chrono::nanoseconds time);
+
+    /// The time on the virtual clock, in nanoseconds.  Written with @c m_mutex held.
+    std::atomic<std::chrono::nanoseconds::rep> m_now;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_VIRTUALTIMERSERVICE_H_
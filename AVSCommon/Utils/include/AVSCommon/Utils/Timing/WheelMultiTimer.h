@@ -0,0 +1,203 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELMULTITIMER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELMULTITIMER_H_
+
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Functional/InlineTask.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c WheelMultiTimer schedules multiple callable types to run in the future, like @c MultiTimer, but keeps them in
+ * a @c TimerWheel instead of a pair of ordered maps, so that submitting and cancelling a task are O(1) and do not
+ * allocate once the pool of task slots has grown to the number of pending tasks, for tasks small enough to be kept
+ * inside an @c InlineTask.  It suits callers that submit many tasks and cancel most of them before they fire, such as
+ * retry and timeout paths.
+ *
+ * A token holds the index of the slot of its task and the generation of the slot, which is incremented each time
+ * the slot is released, so cancelling a task that has already run or been cancelled is a harmless no-op.  Deadlines
+ * are rounded up to a whole millisecond, and tasks due in the same millisecond may run in any order.
+ *
+ * The tasks run one at a time on a thread that is started when a task is submitted, and that exits once no task has
+ * been pending for a while.  Each runs in the @c LogContext of the thread that submitted it.  Submitting from a
+ * thread that is in a context allocates, to keep a copy of the context with the task.
+ *
+ * @note The executed function should not block since this may cause delays to trigger other tasks in the queue.  A
+ * @c WheelMultiTimer must not be destroyed by one of its own tasks.
+ */
+class WheelMultiTimer {
+public:
+    /// Alias for the token used to identify a task. This can be used to cancel a task execution.
+    using Token = uint64_t;
+
+    /**
+     * Factory method that creates a shared pointer to a WheelMultiTimer.
+     * @return A new instance of WheelMultiTimer.
+     */
+    static std::shared_ptr<WheelMultiTimer> createMultiTimer();
+
+    /**
+     * Constructor.
+     */
+    WheelMultiTimer();
+
+    /**
+     * Destructor.  Pending tasks are dropped without being called.
+     */
+    ~WheelMultiTimer();
+
+    /**
+     * Submits a task to be executed after a given delay.
+     *
+     * This function take longer than the delay due to scheduling or resource contention.
+     *
+     * @param delay The non-negative time to wait before calling the given task.
+     * @param task The task to be executed.
+     * @return A unique token that can be used to cancel this task.
+     */
+    Token submitTask(const std::chrono::milliseconds& delay, functional::InlineTask task);
+
+    /**
+     * Removes a task from the queue.
+     *
+     * @param token The token used to identify the task to be canceled.
+     */
+    void cancelTask(Token token);
+
+private:
+    /// A pooled task.
+    struct Slot : public TimerWheel::Node {
+        /// The index of the slot in the pool.
+        uint32_t index;
+
+        /// The generation of the slot, which is incremented each time it is released.
+        uint32_t generation;
+
+        /// Whether the task has fallen due and is in the list of tasks to run.
+        bool isDue;
+
+        /// The next free slot, if this one is free.
+        uint32_t nextFree;
+
+        /// The task, if the slot is in use.
+        functional::InlineTask task;
+    };
+
+    /**
+     * The loop of the timer thread, which waits for the tasks to fall due and runs them.  Returns once no task has
+     * been pending for a while, or when the timer is being destroyed.
+     */
+    void timerLoop();
+
+    /**
+     * Take a slot from the pool, growing the pool if none is free.  @c m_waitMutex must be held.
+     *
+     * @return The slot.
+     */
+    Slot* allocateSlotLocked();
+
+    /**
+     * Return a slot to the pool, invalidating its tokens.  @c m_waitMutex must be held.
+     *
+     * @param slot The slot.
+     */
+    void releaseSlotLocked(Slot* slot);
+
+    /**
+     * Get the slot of a task that is still pending.  @c m_waitMutex must be held.
+     *
+     * @param token The token of the task.
+     * @return The slot, or @c nullptr if the task has run or been cancelled.
+     */
+    Slot* findSlotLocked(Token token);
+
+    /**
+     * Get the slot at an index.
+     *
+     * @param index The index.
+     * @return The slot.
+     */
+    Slot* getSlot(uint32_t index);
+
+    /**
+     * Add a slot to the end of the list of tasks that have fallen due.  @c m_waitMutex must be held.
+     *
+     * @param slot The slot.
+     */
+    void pushDueLocked(Slot* slot);
+
+    /**
+     * Remove a slot from the list of tasks that have fallen due.  @c m_waitMutex must be held.
+     *
+     * @param slot The slot.
+     */
+    void removeDueLocked(Slot* slot);
+
+    /// The condition variable used to wait for the next task.
+    std::condition_variable m_waitCondition;
+
+    /// The mutex for @c m_waitCondition.
+    std::mutex m_waitMutex;
+
+    /// The deadlines of the pending tasks.
+    TimerWheel m_wheel;
+
+    /// The pool of slots, in chunks that never move, so that the wheel may point in to them.
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+
+    /// The number of slots in the pool.
+    uint32_t m_slotCount;
+
+    /// The first free slot, or @c NO_SLOT.
+    uint32_t m_firstFree;
+
+    /// The first task that has fallen due but has not run, or @c nullptr.
+    TimerWheel::Node* m_firstDue;
+
+    /// The last task that has fallen due but has not run, or @c nullptr.
+    TimerWheel::Node* m_lastDue;
+
+    /// The tick the timer thread wakes at, if it is waiting for a deadline.
+    uint64_t m_wakeTick;
+
+    /// Flag indicating whether the timer thread is running.
+    bool m_isRunning;
+
+    /// Flag indicating whether object is being destructed.
+    bool m_isBeingDestroyed;
+
+    /// The thread used to trigger tasks.
+    std::thread m_timerThread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELMULTITIMER_H_
@@ -0,0 +1,90 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATE_H_
+
+#include <memory>
+
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateInterface.h>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateInterface that keeps its deadline in the @c TimerWheel of a @c TimerService shared with other
+ * timers, instead of on a thread of its own.  The threads of the service make the @c task calls, so the number of
+ * threads stays the same however many timers are active.
+ *
+ * The calls of one timer never overlap, and the semantics of @c start(), @c stop(), @c activate() and @c isActive()
+ * are those of @c TimerDelegate.  As with @c MultiTimer, the tasks should not block: a task that blocks holds up the
+ * tasks of other timers that fall due while every service thread is busy.
+ */
+class WheelTimerDelegate : public sdkInterfaces::timing::TimerDelegateInterface {
+public:
+    /// @name TimerDelegateInterface Functions
+    /// @{
+    void start(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task) override;
+    void stop() override;
+    bool activate() override;
+    bool isActive() const override;
+    /// @}
+
+    /// Constructor, for a timer kept by the shared @c SteadyTimerService.
+    WheelTimerDelegate();
+
+    /**
+     * Constructor.
+     *
+     * @param service The service to keep the timer.
+     * @param slack How late the calls of the timer may be made, so that they can share a wakeup with other timers.
+     */
+    WheelTimerDelegate(
+        std::shared_ptr<TimerService> service,
+        std::chrono::nanoseconds slack = std::chrono::nanoseconds::zero());
+
+    /// Destructor, which stops the timer.
+    ~WheelTimerDelegate() override;
+
+    /**
+     * Set how late the calls of the timer may be made, from the next time it is started.
+     *
+     * @param slack The non-negative slack.
+     */
+    void setSlack(std::chrono::nanoseconds slack);
+
+private:
+    /// The service keeping the timer.
+    std::shared_ptr<TimerService> m_service;
+
+    /// The timer, which the service keeps alive while it makes a call.
+    std::shared_ptr<TimerService::Entry> m_timer;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATE_H_
@@ -0,0 +1,68 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATEFACTORY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATEFACTORY_H_
+
+#include <chrono>
+#include <memory>
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateFactoryInterface.h>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateFactoryInterface that creates @c WheelTimerDelegate instances, so that the timers created with it
+ * share one timing wheel and a few service threads instead of each having a thread of its own.
+ *
+ * Given the @c TimerFdTimerService, the timers keep their deadlines while the system is suspended, and a slack lets
+ * timers that fall due close together share a wakeup.
+ */
+class WheelTimerDelegateFactory : public avsCommon::sdkInterfaces::timing::TimerDelegateFactoryInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param service The service to keep the timers, or @c nullptr for the shared @c SteadyTimerService.
+     * @param slack How late the calls of the timers may be made.
+     */
+    WheelTimerDelegateFactory(
+        std::shared_ptr<TimerService> service = nullptr,
+        std::chrono::nanoseconds slack = std::chrono::nanoseconds::zero());
+
+    /// @name TimerDelegateFactoryInterface Functions
+    /// @{
+    bool supportsLowPowerMode() override;
+    std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> getTimerDelegate() override;
+    /// @}
+
+private:
+    /// The service to keep the timers.
+    std::shared_ptr<TimerService> m_service;
+
+    /// How late the calls of the timers may be made.
+    std::chrono::nanoseconds m_slack;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_WHEELTIMERDELEGATEFACTORY_H_
@@ -124,6 +124,20 @@ std::string JsonGenerator::toString(bool finalizeJson) {
     return m_buffer.GetString();
 }
 
+const char* JsonGenerator::toCString(size_t* length, bool finalizeJson) {
+    if (finalizeJson) {
+        finalize();
+    }
+    *length = m_buffer.GetSize();
+    return m_buffer.GetString();
+}
+
+void JsonGenerator::reset() {
+    m_buffer.Clear();
+    m_writer.Reset(m_buffer);
+    m_writer.StartObject();
+}
+
 bool JsonGenerator::checkWriter() {
     if (m_writer.IsComplete()) {
         ACSDK_ERROR(LX("addMemberFailed").d("reason", "finalizedGenerator"));
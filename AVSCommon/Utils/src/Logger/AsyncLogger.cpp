@@ -0,0 +1,385 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "AVSCommon/Utils/CoutMutex.h"
+#include "AVSCommon/Utils/Logger/AsyncLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Configuration key for AsyncLogger settings.
+static const std::string CONFIG_KEY_ASYNC_LOGGER = "asyncLogger";
+
+/// Configuration key for the number of entries the queue can hold.
+static const std::string CONFIG_KEY_QUEUE_SIZE = "queueSize";
+
+/// Configuration key for whether to capture entries in binary form and format them on the writer thread.
+static const std::string CONFIG_KEY_DEFER_FORMATTING = "deferFormatting";
+
+/// Default number of entries the queue can hold.
+static const uint32_t DEFAULT_QUEUE_SIZE = 1024;
+
+/// Size of the accumulated batch of lines at which the writer thread writes the batch out.
+static const size_t MAX_BATCH_SIZE = 16 * 1024;
+
+/// How long a thread waiting for the queue to drain sleeps before checking again.
+static const auto DRAIN_WAIT_TIMEOUT = std::chrono::milliseconds(10);
+
+/**
+ * Round a queue size up to a power of two (so that positions can be mapped to slots with a mask).
+ *
+ * @param size The requested size.
+ * @return The smallest power of two that is not less than @c size (and not less than 2).
+ */
+static size_t roundUpToPowerOfTwo(size_t size) {
+    size_t result = 2;
+    while (result < size) {
+        result <<= 1;
+    }
+    return result;
+}
+
+std::shared_ptr<Logger> AsyncLogger::instance() {
+    static std::shared_ptr<Logger> singleAsyncLogger = [] {
+        auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_ASYNC_LOGGER];
+        uint32_t queueSize = DEFAULT_QUEUE_SIZE;
+        configuration.getUint32(CONFIG_KEY_QUEUE_SIZE, &queueSize, DEFAULT_QUEUE_SIZE);
+        bool deferFormatting = false;
+        configuration.getBool(CONFIG_KEY_DEFER_FORMATTING, &deferFormatting, false);
+        if (deferFormatting) {
+            LogEntry::setCaptureMode(LogEntry::CaptureMode::BINARY);
+        }
+        return std::shared_ptr<AsyncLogger>(new AsyncLogger(queueSize));
+    }();
+    /*
+     * Registered after singleAsyncLogger has been constructed so that the handler runs before singleAsyncLogger is
+     * destroyed.  Entries emitted by other threads or by static destructors after this point are written synchronously.
+     */
+    static const bool registeredAtExit = (0 == std::atexit(shutdownAtExit));
+    (void)registeredAtExit;
+    return singleAsyncLogger;
+}
+
+void AsyncLogger::shutdownAtExit() {
+    static_cast<AsyncLogger*>(instance().get())->shutdown();
+}
+
+AsyncLogger::AsyncLogger(size_t queueSize) :
+        Logger(Level::UNKNOWN),
+        m_mask{roundUpToPowerOfTwo(queueSize) - 1},
+        m_enqueuePosition{0},
+        m_dequeuePosition{0},
+        m_writtenCount{0},
+        m_batchCount{0},
+        m_writerWaiting{false},
+        m_waiterCount{0},
+        m_stopping{false},
+        m_coutMutex{getCoutMutex()} {
+    m_records.reset(new Record[m_mask + 1]);
+    for (size_t ix = 0; ix <= m_mask; ix++) {
+        m_records[ix].sequence.store(ix, std::memory_order_relaxed);
+    }
+    m_batch.reserve(MAX_BATCH_SIZE);
+#ifdef DEBUG
+    setLevel(Level::DEBUG9);
+#else
+    setLevel(Level::INFO);
+#endif  // DEBUG
+    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_ASYNC_LOGGER]);
+    m_writerThread = std::thread(&AsyncLogger::writerLoop, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    shutdown();
+}
+
+void AsyncLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (!text) {
+        text = "";
+    }
+    if (!enqueue(level, time, threadMoniker, text, strlen(text), Content::TEXT)) {
+        emitAtExit(level, time, threadMoniker, text);
+    }
+}
+
+void AsyncLogger::emitEntry(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& entry) {
+    if (!entry.isBinary()) {
+        emit(level, time, threadMoniker, entry.c_str());
+        return;
+    }
+    auto& record = entry.record();
+    if (!enqueue(level, time, threadMoniker, record.data(), record.size(), Content::RECORD)) {
+        emitAtExit(level, time, threadMoniker, entry.c_str());
+    }
+}
+
+void AsyncLogger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    const char* line,
+    size_t length) {
+    if (!enqueue(level, time, threadMoniker, line, length, Content::LINE)) {
+        emitAtExit(level, time, threadMoniker, text);
+    }
+}
+
+bool AsyncLogger::usesFormattedLines() const {
+    return true;
+}
+
+void AsyncLogger::emitAtExit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    {
+        // Write out anything already queued first so that entries stay in order.
+        std::lock_guard<std::mutex> lock(m_consumerMutex);
+        drainLocked();
+        m_logFormatter.format(level, time, threadMoniker, text, &m_batch);
+        m_batch.push_back('\n');
+        writeBatchLocked();
+    }
+    if (m_waiterCount > 0) {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        m_drainedCondition.notify_all();
+    }
+}
+
+void AsyncLogger::flush() {
+    auto target = m_enqueuePosition.load();
+    if (m_writtenCount >= target) {
+        return;
+    }
+    if (m_stopping) {
+        std::lock_guard<std::mutex> lock(m_consumerMutex);
+        drainLocked();
+        return;
+    }
+    m_waiterCount++;
+    wakeWriter();
+    {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        while (m_writtenCount < target && !m_stopping) {
+            m_drainedCondition.wait_for(lock, DRAIN_WAIT_TIMEOUT);
+        }
+    }
+    m_waiterCount--;
+}
+
+bool AsyncLogger::enqueue(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* data,
+    size_t size,
+    Content content) {
+    if (m_stopping) {
+        return false;
+    }
+    while (!tryEnqueue(level, time, threadMoniker, data, size, content)) {
+        if (m_stopping) {
+            return false;
+        }
+        // The queue is full.  Make sure the writer is awake and wait for it to make room.
+        m_waiterCount++;
+        wakeWriter();
+        {
+            std::unique_lock<std::mutex> lock(m_waitMutex);
+            m_drainedCondition.wait_for(lock, DRAIN_WAIT_TIMEOUT);
+        }
+        m_waiterCount--;
+    }
+
+    // Pairs with the fence in writerLoop() so that either the writer sees the new entry, or we see that it is waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_stopping) {
+        // The writer may already have exited, so write the entry out from this thread.
+        std::lock_guard<std::mutex> lock(m_consumerMutex);
+        drainLocked();
+    } else if (m_writerWaiting.load(std::memory_order_relaxed)) {
+        wakeWriter();
+    }
+    return true;
+}
+
+bool AsyncLogger::tryEnqueue(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* data,
+    size_t size,
+    Content content) {
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Record* record;
+    while (true) {
+        record = &m_records[position & m_mask];
+        auto sequence = record->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (0 == difference) {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->level = level;
+    record->time = time;
+    record->threadMoniker.assign(threadMoniker ? threadMoniker : "");
+    if (Content::RECORD == content) {
+        // Rendered once the entry is gone, so keys and events captured as pointers are copied with the record.
+        record->text.clear();
+        LogEntryRecord::copyDetached(data, size, &record->text);
+    } else {
+        record->text.assign(data, size);
+    }
+    record->content = content;
+    record->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::wakeWriter() {
+    {
+        // Taking the lock ensures the writer is either before its final check for entries or already waiting.
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+    }
+    m_writerCondition.notify_one();
+}
+
+void AsyncLogger::writerLoop() {
+    while (true) {
+        bool wroteEntries;
+        {
+            std::lock_guard<std::mutex> lock(m_consumerMutex);
+            wroteEntries = drainLocked();
+        }
+        if (wroteEntries) {
+            if (m_waiterCount > 0) {
+                std::lock_guard<std::mutex> lock(m_waitMutex);
+                m_drainedCondition.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        if (m_stopping) {
+            return;
+        }
+        m_writerWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+        if (m_records[position & m_mask].sequence.load(std::memory_order_acquire) != position + 1) {
+            m_writerCondition.wait(lock);
+        }
+        m_writerWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogger::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        if (m_stopping) {
+            return;
+        }
+        m_stopping = true;
+    }
+    m_writerCondition.notify_one();
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+    // Pick up anything enqueued while the writer was exiting.
+    {
+        std::lock_guard<std::mutex> lock(m_consumerMutex);
+        drainLocked();
+    }
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    m_drainedCondition.notify_all();
+}
+
+bool AsyncLogger::drainLocked() {
+    bool drained = false;
+    auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        auto& record = m_records[position & m_mask];
+        if (record.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+        if (Content::LINE == record.content) {
+            m_batch.append(record.text);
+        } else {
+            auto text = record.text.c_str();
+            if (Content::RECORD == record.content) {
+                m_renderBuffer.clear();
+                LogEntryRecord::render(record.text.data(), record.text.size(), &m_renderBuffer);
+                text = m_renderBuffer.c_str();
+            }
+            m_logFormatter.format(record.level, record.time, record.threadMoniker.c_str(), text, &m_batch);
+        }
+        m_batch.push_back('\n');
+        m_batchCount++;
+        record.sequence.store(position + m_mask + 1, std::memory_order_release);
+        position++;
+        m_dequeuePosition.store(position, std::memory_order_relaxed);
+        drained = true;
+        if (m_batch.size() >= MAX_BATCH_SIZE) {
+            writeBatchLocked();
+        }
+    }
+    writeBatchLocked();
+    return drained;
+}
+
+void AsyncLogger::writeBatchLocked() {
+    if (m_batch.empty()) {
+        return;
+    }
+    if (m_coutMutex) {
+        std::lock_guard<std::mutex> lock(*m_coutMutex);
+        std::cout.write(m_batch.data(), m_batch.size());
+        std::cout.flush();
+    }
+    m_batch.clear();
+    m_writtenCount += m_batchCount;
+    m_batchCount = 0;
+}
+
+std::shared_ptr<Logger> getAsyncLogger() {
+    return AsyncLogger::instance();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,120 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "AVSCommon/Utils/Logger/BacktraceBuffer.h"
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+BacktraceBuffer::BacktraceBuffer(Level level, Level flushLevel, size_t capacity, std::chrono::milliseconds maxAge) :
+        m_level{level},
+        m_flushLevel{flushLevel},
+        m_maxAge{maxAge},
+        m_entries(std::max(capacity, static_cast<size_t>(1))),
+        m_next{0},
+        m_count{0},
+        m_flushed(m_entries.size()) {
+}
+
+void BacktraceBuffer::add(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = claimSlotLocked(level, time, threadMoniker);
+    entry.text.assign(text);
+    entry.isRecord = false;
+}
+
+void BacktraceBuffer::add(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& logEntry) {
+    if (!logEntry.isBinary()) {
+        add(level, time, threadMoniker, logEntry.c_str());
+        return;
+    }
+    // Copied before taking the lock, then swapped with the string of the slot, so that the two trade capacity.
+    static thread_local std::string record;
+    record.clear();
+    auto& source = logEntry.record();
+    LogEntryRecord::copyDetached(source.data(), source.size(), &record);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = claimSlotLocked(level, time, threadMoniker);
+    entry.text.swap(record);
+    entry.isRecord = true;
+}
+
+void BacktraceBuffer::flush(std::chrono::system_clock::time_point time, Logger* sink) {
+    // Another flush in progress, on another thread or from a sink that logs an error, gets slots of its own.
+    std::unique_lock<std::mutex> flushLock(m_flushMutex, std::try_to_lock);
+    std::vector<Entry> ownEntries;
+    std::string ownText;
+    auto& entries = flushLock.owns_lock() ? m_flushed : ownEntries;
+    auto& text = flushLock.owns_lock() ? m_flushedText : ownText;
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entries.resize(m_entries.size());
+        auto oldest = time - m_maxAge;
+        auto index = (m_next + m_entries.size() - m_count) % m_entries.size();
+        for (; m_count > 0; --m_count) {
+            auto& entry = m_entries[index];
+            if (entry.time >= oldest) {
+                std::swap(entry, entries[count++]);
+            }
+            index = (index + 1) % m_entries.size();
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        auto& entry = entries[i];
+        if (entry.isRecord) {
+            text.clear();
+            LogEntryRecord::render(entry.text.data(), entry.text.size(), &text);
+            sink->emitUnfiltered(entry.level, entry.time, entry.threadMoniker.c_str(), text.c_str());
+        } else {
+            sink->emitUnfiltered(entry.level, entry.time, entry.threadMoniker.c_str(), entry.text.c_str());
+        }
+    }
+}
+
+BacktraceBuffer::Entry& BacktraceBuffer::claimSlotLocked(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker) {
+    auto& entry = m_entries[m_next];
+    entry.level = level;
+    entry.time = time;
+    entry.threadMoniker.assign(threadMoniker);
+    m_next = (m_next + 1) % m_entries.size();
+    if (m_count < m_entries.size()) {
+        ++m_count;
+    }
+    return entry;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,11 +13,16 @@
  * permissions and limitations under the License.
  */
 
+#include <cerrno>
 #include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <mutex>
 
+#include <sys/uio.h>
+#include <unistd.h>
+
 #include "AVSCommon/Utils/CoutMutex.h"
 #include "AVSCommon/Utils/Logger/ConsoleLogger.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
@@ -31,29 +36,206 @@ namespace logger {
 /// Configuration key for DefaultLogger settings
 static const std::string CONFIG_KEY_DEFAULT_LOGGER = "consoleLogger";
 
+/// Configuration key for the size of the staged lines at which they are written out, in bytes.
+static const std::string CONFIG_KEY_BATCH_SIZE = "batchSize";
+
+/// Configuration key for how long lines may be staged before they are written out, in milliseconds.
+static const std::string CONFIG_KEY_FLUSH_INTERVAL = "flushIntervalMs";
+
+/// Default size of the staged lines at which they are written out.  Zero, so that no lines are lost in a crash.
+static const uint32_t DEFAULT_BATCH_SIZE = 0;
+
+/// Default of how long lines may be staged before they are written out.
+static const std::chrono::milliseconds DEFAULT_FLUSH_INTERVAL = std::chrono::milliseconds(100);
+
+/// Lines at or above this level are written out right away, along with any lines staged before them.
+static const Level FLUSH_LEVEL = Level::ERROR;
+
+/// The newline written after each line.
+static const char NEWLINE = '\n';
+
 std::shared_ptr<Logger> ConsoleLogger::instance() {
     static std::shared_ptr<Logger> singleConsoleLogger = std::shared_ptr<ConsoleLogger>(new ConsoleLogger);
+    /*
+     * Registered after singleConsoleLogger has been constructed so that the handler runs before singleConsoleLogger
+     * is destroyed.  Entries emitted by static destructors after this point are written as they are emitted.
+     */
+    static const bool registeredAtExit = (0 == std::atexit(shutdownAtExit));
+    (void)registeredAtExit;
     return singleConsoleLogger;
 }
 
+void ConsoleLogger::shutdownAtExit() {
+    static_cast<ConsoleLogger*>(instance().get())->shutdown();
+}
+
 void ConsoleLogger::emit(
     Level level,
     std::chrono::system_clock::time_point time,
     const char* threadMoniker,
     const char* text) {
     if (m_coutMutex) {
+        // Reused by each thread so that formatting a line does not allocate once the buffer has grown.
+        static thread_local std::string line;
+        line.clear();
+        m_logFormatter.format(level, time, threadMoniker, text, &line);
+        stage(level, line.data(), line.size());
+    }
+}
+
+void ConsoleLogger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point /*time*/,
+    const char* /*threadMoniker*/,
+    const char* /*text*/,
+    const char* line,
+    size_t length) {
+    if (m_coutMutex) {
+        stage(level, line, length);
+    }
+}
+
+bool ConsoleLogger::usesFormattedLines() const {
+    return true;
+}
+
+void ConsoleLogger::emitAtExit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (m_coutMutex) {
+        std::string line;
+        m_logFormatter.format(level, time, threadMoniker, text, &line);
         std::lock_guard<std::mutex> lock(*m_coutMutex);
-        std::cout << m_logFormatter.format(level, time, threadMoniker, text) << std::endl;
+        writeLocked(line.data(), line.size());
     }
 }
 
-ConsoleLogger::ConsoleLogger() : Logger(Level::UNKNOWN), m_coutMutex{getCoutMutex()} {
+ConsoleLogger::ConsoleLogger() :
+        Logger(Level::UNKNOWN),
+        m_coutMutex{getCoutMutex()},
+        m_batchSize{0},
+        m_flushInterval{DEFAULT_FLUSH_INTERVAL},
+        m_stopping{false} {
 #ifdef DEBUG
     setLevel(Level::DEBUG9);
 #else
     setLevel(Level::INFO);
 #endif  // DEBUG
-    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_DEFAULT_LOGGER]);
+    auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_DEFAULT_LOGGER];
+    init(configuration);
+
+    uint32_t batchSize = DEFAULT_BATCH_SIZE;
+    configuration.getUint32(CONFIG_KEY_BATCH_SIZE, &batchSize, DEFAULT_BATCH_SIZE);
+    configuration.getDuration<std::chrono::milliseconds>(
+        CONFIG_KEY_FLUSH_INTERVAL, &m_flushInterval, DEFAULT_FLUSH_INTERVAL);
+    if (batchSize > 0) {
+        m_batchSize = batchSize;
+        m_staged.reserve(m_batchSize);
+        m_flushThread = std::thread(&ConsoleLogger::flushLoop, this);
+    }
+}
+
+ConsoleLogger::~ConsoleLogger() {
+    shutdown();
+}
+
+void ConsoleLogger::stage(Level level, const char* line, size_t length) {
+    std::lock_guard<std::mutex> lock(*m_coutMutex);
+    if (level >= FLUSH_LEVEL || 0 == m_batchSize) {
+        writeLocked(line, length);
+        return;
+    }
+    bool wasEmpty = m_staged.empty();
+    m_staged.append(line, length);
+    m_staged.push_back(NEWLINE);
+    if (m_staged.size() >= m_batchSize) {
+        writeLocked(nullptr, 0);
+    } else if (wasEmpty) {
+        m_batchStart = std::chrono::steady_clock::now();
+        m_flushCondition.notify_one();
+    }
+}
+
+void ConsoleLogger::writeLocked(const char* line, size_t length) {
+    // Anything written to cout by others must go out first, to stay in order with the lines written here.
+    std::cout.flush();
+    char newline = NEWLINE;
+    struct iovec buffers[3];
+    int count = 0;
+    if (!m_staged.empty()) {
+        buffers[count].iov_base = &m_staged[0];
+        buffers[count++].iov_len = m_staged.size();
+    }
+    if (line) {
+        buffers[count].iov_base = const_cast<char*>(line);
+        buffers[count++].iov_len = length;
+        buffers[count].iov_base = &newline;
+        buffers[count++].iov_len = 1;
+    }
+    auto next = buffers;
+    while (count > 0) {
+        auto written = writev(STDOUT_FILENO, next, count);
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            // Nowhere to report this, so drop the batch.
+            break;
+        }
+        // Skip what was written, in case only part of it was.
+        auto remaining = static_cast<size_t>(written);
+        while (count > 0 && remaining >= next->iov_len) {
+            remaining -= next->iov_len;
+            ++next;
+            --count;
+        }
+        if (count > 0) {
+            next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+            next->iov_len -= remaining;
+        }
+    }
+    m_staged.clear();
+}
+
+void ConsoleLogger::flushLoop() {
+    std::unique_lock<std::mutex> lock(*m_coutMutex);
+    while (!m_stopping) {
+        if (m_staged.empty()) {
+            m_flushCondition.wait(lock);
+            continue;
+        }
+        // Give the batch until the interval is up to fill.  It may be written out and another started meanwhile.
+        auto deadline = m_batchStart + m_flushInterval;
+        if (std::chrono::steady_clock::now() < deadline) {
+            m_flushCondition.wait_until(lock, deadline);
+        } else {
+            writeLocked(nullptr, 0);
+        }
+    }
+}
+
+void ConsoleLogger::shutdown() {
+    if (!m_coutMutex) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(*m_coutMutex);
+        if (m_stopping) {
+            return;
+        }
+        m_stopping = true;
+        m_batchSize = 0;
+    }
+    m_flushCondition.notify_one();
+    if (m_flushThread.joinable()) {
+        m_flushThread.join();
+    }
+    std::lock_guard<std::mutex> lock(*m_coutMutex);
+    if (!m_staged.empty()) {
+        writeLocked(nullptr, 0);
+    }
 }
 
 std::shared_ptr<Logger> getConsoleLogger() {
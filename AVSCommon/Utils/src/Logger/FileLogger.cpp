@@ -0,0 +1,571 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "AVSCommon/Utils/CoutMutex.h"
+#include "AVSCommon/Utils/Logger/FileLogger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("FileLogger");
+
+/// Configuration key for FileLogger settings.
+static const std::string CONFIG_KEY_FILE_LOGGER = "fileLogger";
+
+/// Configuration key for the directory that segments are written to.
+static const std::string CONFIG_KEY_DIRECTORY = "directory";
+
+/// Configuration key for the prefix of segment file names.
+static const std::string CONFIG_KEY_PREFIX = "prefix";
+
+/// Configuration key for the size of each segment, in bytes.
+static const std::string CONFIG_KEY_SEGMENT_SIZE = "segmentSize";
+
+/// Configuration key for the age at which a segment is replaced, in seconds.
+static const std::string CONFIG_KEY_MAX_SEGMENT_AGE = "maxSegmentAgeSeconds";
+
+/// Configuration key for the number of segments to keep.
+static const std::string CONFIG_KEY_MAX_SEGMENT_COUNT = "maxSegmentCount";
+
+/// Configuration key for when segments are written back to storage.
+static const std::string CONFIG_KEY_DURABILITY = "durability";
+
+/// Configuration key for how often segments are written back with @c Durability::PERIODIC, in milliseconds.
+static const std::string CONFIG_KEY_SYNC_INTERVAL = "syncIntervalMs";
+
+/// Default directory that segments are written to.
+static const std::string DEFAULT_DIRECTORY = ".";
+
+/// Default prefix of segment file names.
+static const std::string DEFAULT_PREFIX = "avs";
+
+/// Default size of each segment, in bytes.
+static const uint32_t DEFAULT_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+/// Smallest size of segment that is used, in bytes.
+static const uint32_t MIN_SEGMENT_SIZE = 4096;
+
+/// Default age at which a segment is replaced.  Zero disables rotation by age.
+static const std::chrono::seconds DEFAULT_MAX_SEGMENT_AGE = std::chrono::seconds(0);
+
+/// Default number of segments to keep.
+static const uint32_t DEFAULT_MAX_SEGMENT_COUNT = 8;
+
+/// Default durability, as it appears in the configuration.
+static const std::string DEFAULT_DURABILITY = "PERIODIC";
+
+/// Default interval at which segments are written back with @c Durability::PERIODIC.
+static const std::chrono::milliseconds DEFAULT_SYNC_INTERVAL = std::chrono::milliseconds(1000);
+
+/// How long to wait before trying again after failing to create a segment.
+static const std::chrono::seconds CREATE_RETRY_INTERVAL = std::chrono::seconds(1);
+
+/// Suffix of segment file names.
+static const std::string SEGMENT_SUFFIX = ".log";
+
+/// Number of digits that segment sequence numbers are zero padded to.
+static const int SEQUENCE_DIGITS = 8;
+
+/// Size of the block of zeros written at a time when @c posix_fallocate() cannot allocate a segment file.
+static const size_t ZERO_FILL_BLOCK_SIZE = 64 * 1024;
+
+/**
+ * Allocate every block of a newly created file up to @c capacity.  The file must not be sparse: storing to a page of
+ * a shared mapping whose block cannot be allocated, for example because the disk is full, raises @c SIGBUS.
+ *
+ * @param fd The file descriptor of the file, at offset zero.
+ * @param capacity The size to allocate.
+ * @param[out] failedCall The name of the system call that failed, if the blocks could not be allocated.
+ * @return Whether the blocks were allocated.  If not, @c errno says why.
+ */
+static bool allocateFile(int fd, size_t capacity, const char** failedCall) {
+    int result = posix_fallocate(fd, 0, capacity);
+    if (0 == result) {
+        return true;
+    }
+    // Not every file system supports it.  Writing the zeros ourselves allocates the blocks just as well.
+    static const char zeros[ZERO_FILL_BLOCK_SIZE] = {};
+    size_t written = 0;
+    while (written < capacity) {
+        auto count = write(fd, zeros, std::min(capacity - written, ZERO_FILL_BLOCK_SIZE));
+        if (count < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            *failedCall = "write";
+            return false;
+        }
+        written += count;
+    }
+    return true;
+}
+
+/// A memory mapped segment file, preallocated to its full size.
+class FileLogger::Segment {
+public:
+    /**
+     * Create and map a segment file, replacing any existing file at @c path.
+     *
+     * @param path The path of the file.
+     * @param capacity The size of the file.
+     * @param openedAt The time at which the segment is started.
+     * @param[out] failedCall The name of the system call that failed, if the segment could not be created.
+     * @return The segment, or @c nullptr if it could not be created, in which case @c errno says why.
+     */
+    static std::shared_ptr<Segment> create(
+        const std::string& path,
+        size_t capacity,
+        std::chrono::system_clock::time_point openedAt,
+        const char** failedCall);
+
+    /**
+     * Destructor.  Unmaps the file and truncates it to the length of its contents.
+     */
+    ~Segment();
+
+    /**
+     * Get whether some number of characters would fit in the segment.
+     *
+     * @param count The number of characters.
+     * @return Whether @c count characters would fit in the segment.
+     */
+    bool hasRoom(size_t count) const;
+
+    /**
+     * Append characters to the segment.  The caller must ensure that they fit.
+     *
+     * @param text The characters to append.
+     * @param count The number of characters to append.
+     * @return The length of the segment after appending the characters.
+     */
+    size_t write(const char* text, size_t count);
+
+    /**
+     * Get the length of the contents of the segment.
+     *
+     * @return The length of the contents of the segment.
+     */
+    size_t length() const;
+
+    /**
+     * Get the time at which the segment was started.
+     *
+     * @return The time at which the segment was started.
+     */
+    std::chrono::system_clock::time_point openedAt() const;
+
+    /**
+     * Write the first @c length characters of the segment back to storage, blocking until they have been written.
+     *
+     * @param length The number of characters to write back.
+     * @return Whether the characters were written back.
+     */
+    bool sync(size_t length) const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param fd The file descriptor of the segment file.
+     * @param data The mapping of the segment file.
+     * @param capacity The size of the segment file.
+     * @param openedAt The time at which the segment is started.
+     */
+    Segment(int fd, char* data, size_t capacity, std::chrono::system_clock::time_point openedAt);
+
+    /// The file descriptor of the segment file.
+    const int m_fd;
+
+    /// The mapping of the segment file.
+    char* const m_data;
+
+    /// The size of the segment file.
+    const size_t m_capacity;
+
+    /// The time at which the segment was started.
+    const std::chrono::system_clock::time_point m_openedAt;
+
+    /// The length of the contents of the segment.
+    size_t m_length;
+};
+
+std::shared_ptr<FileLogger::Segment> FileLogger::Segment::create(
+    const std::string& path,
+    size_t capacity,
+    std::chrono::system_clock::time_point openedAt,
+    const char** failedCall) {
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        *failedCall = "open";
+        return nullptr;
+    }
+    void* data = MAP_FAILED;
+    if (allocateFile(fd, capacity, failedCall)) {
+        *failedCall = "mmap";
+        data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (MAP_FAILED == data) {
+        auto error = errno;
+        close(fd);
+        unlink(path.c_str());
+        errno = error;
+        return nullptr;
+    }
+    return std::shared_ptr<Segment>(new Segment(fd, static_cast<char*>(data), capacity, openedAt));
+}
+
+FileLogger::Segment::Segment(int fd, char* data, size_t capacity, std::chrono::system_clock::time_point openedAt) :
+        m_fd{fd},
+        m_data{data},
+        m_capacity{capacity},
+        m_openedAt{openedAt},
+        m_length{0} {
+}
+
+FileLogger::Segment::~Segment() {
+    munmap(m_data, m_capacity);
+    // Drop the unwritten, preallocated tail so that readers of the completed segment do not see it.
+    if (ftruncate(m_fd, m_length) != 0) {
+        // Nothing more can be done.  Readers will see a tail of null characters.
+    }
+    close(m_fd);
+}
+
+bool FileLogger::Segment::hasRoom(size_t count) const {
+    return m_capacity - m_length >= count;
+}
+
+size_t FileLogger::Segment::write(const char* text, size_t count) {
+    memcpy(m_data + m_length, text, count);
+    m_length += count;
+    return m_length;
+}
+
+size_t FileLogger::Segment::length() const {
+    return m_length;
+}
+
+std::chrono::system_clock::time_point FileLogger::Segment::openedAt() const {
+    return m_openedAt;
+}
+
+bool FileLogger::Segment::sync(size_t length) const {
+    if (0 == length) {
+        return true;
+    }
+    return 0 == msync(m_data, length, MS_SYNC);
+}
+
+/**
+ * Parse a durability setting.
+ *
+ * @param text The setting, as it appears in the configuration.
+ * @param[out] durability The parsed setting.
+ * @return Whether @c text is a valid setting.
+ */
+static bool parseDurability(const std::string& text, FileLogger::Durability* durability) {
+    if ("NONE" == text) {
+        *durability = FileLogger::Durability::NONE;
+    } else if ("PERIODIC" == text) {
+        *durability = FileLogger::Durability::PERIODIC;
+    } else if ("ON_ERROR" == text) {
+        *durability = FileLogger::Durability::ON_ERROR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<Logger> FileLogger::instance() {
+    static std::shared_ptr<Logger> singleFileLogger = std::shared_ptr<FileLogger>(
+        new FileLogger(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_FILE_LOGGER]));
+    return singleFileLogger;
+}
+
+FileLogger::FileLogger(const configuration::ConfigurationNode& configuration) :
+        Logger(Level::UNKNOWN),
+        m_durability{Durability::PERIODIC},
+        m_nextSequence{0},
+        m_stopping{false},
+        m_coutMutex{getCoutMutex()} {
+#ifdef DEBUG
+    setLevel(Level::DEBUG9);
+#else
+    setLevel(Level::INFO);
+#endif  // DEBUG
+    init(configuration);
+
+    configuration.getString(CONFIG_KEY_DIRECTORY, &m_directory, DEFAULT_DIRECTORY);
+    configuration.getString(CONFIG_KEY_PREFIX, &m_prefix, DEFAULT_PREFIX);
+    uint32_t segmentSize = DEFAULT_SEGMENT_SIZE;
+    configuration.getUint32(CONFIG_KEY_SEGMENT_SIZE, &segmentSize, DEFAULT_SEGMENT_SIZE);
+    m_segmentSize = std::max(segmentSize, MIN_SEGMENT_SIZE);
+    configuration.getDuration<std::chrono::seconds>(
+        CONFIG_KEY_MAX_SEGMENT_AGE, &m_maxSegmentAge, DEFAULT_MAX_SEGMENT_AGE);
+    uint32_t maxSegmentCount = DEFAULT_MAX_SEGMENT_COUNT;
+    configuration.getUint32(CONFIG_KEY_MAX_SEGMENT_COUNT, &maxSegmentCount, DEFAULT_MAX_SEGMENT_COUNT);
+    m_maxSegmentCount = std::max(maxSegmentCount, static_cast<uint32_t>(1));
+    std::string durability;
+    configuration.getString(CONFIG_KEY_DURABILITY, &durability, DEFAULT_DURABILITY);
+    auto now = std::chrono::system_clock::now();
+    if (!parseDurability(durability, &m_durability)) {
+        reportError(now, LogEntry(TAG, "invalidDurability").d("durability", durability).m("using PERIODIC"));
+    }
+    configuration.getDuration<std::chrono::milliseconds>(
+        CONFIG_KEY_SYNC_INTERVAL, &m_syncInterval, DEFAULT_SYNC_INTERVAL);
+
+    findExistingSegments();
+    {
+        std::shared_ptr<Segment> previous;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        rotateLocked(now, &previous);
+    }
+    if (Durability::PERIODIC == m_durability) {
+        m_syncThread = std::thread(&FileLogger::syncLoop, this);
+    }
+}
+
+FileLogger::~FileLogger() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_stopCondition.notify_one();
+    if (m_syncThread.joinable()) {
+        m_syncThread.join();
+    }
+    std::shared_ptr<Segment> segment;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        segment = std::move(m_segment);
+    }
+    if (segment) {
+        completeSegment(segment);
+    }
+}
+
+void FileLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    // Reused by each thread so that formatting a line does not allocate once the buffer has grown.
+    static thread_local std::string line;
+    line.clear();
+    m_logFormatter.format(level, time, threadMoniker, text, &line);
+    writeLine(level, time, line.data(), line.size());
+}
+
+void FileLogger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* /*threadMoniker*/,
+    const char* /*text*/,
+    const char* line,
+    size_t length) {
+    writeLine(level, time, line, length);
+}
+
+bool FileLogger::usesFormattedLines() const {
+    return true;
+}
+
+void FileLogger::writeLine(Level level, std::chrono::system_clock::time_point time, const char* line, size_t length) {
+    // Leave room for the newline.
+    if (length >= m_segmentSize) {
+        length = m_segmentSize - 1;
+    }
+
+    std::shared_ptr<Segment> segment;
+    size_t end = 0;
+    if (!append(time, line, length, &segment, &end)) {
+        writeToCerr(line, length);
+        return;
+    }
+    if (Durability::ON_ERROR == m_durability && (Level::ERROR == level || Level::CRITICAL == level)) {
+        segment->sync(end);
+    }
+}
+
+bool FileLogger::sync() {
+    std::shared_ptr<Segment> segment;
+    size_t length = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_segment) {
+            return false;
+        }
+        segment = m_segment;
+        length = m_segment->length();
+    }
+    return segment->sync(length);
+}
+
+bool FileLogger::append(
+    std::chrono::system_clock::time_point time,
+    const char* line,
+    size_t length,
+    std::shared_ptr<Segment>* segment,
+    size_t* end) {
+    // Released after m_mutex, so that unmapping and truncating a completed segment does not hold up other threads.
+    std::shared_ptr<Segment> previous;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_segment || !m_segment->hasRoom(length + 1) ||
+            (m_maxSegmentAge.count() > 0 && time - m_segment->openedAt() >= m_maxSegmentAge)) {
+            if (!m_segment && time < m_retryTime) {
+                return false;
+            }
+            rotateLocked(time, &previous);
+            if (!m_segment) {
+                return false;
+            }
+        }
+        m_segment->write(line, length);
+        *end = m_segment->write("\n", 1);
+        *segment = m_segment;
+    }
+    if (previous) {
+        completeSegment(previous);
+    }
+    return true;
+}
+
+void FileLogger::rotateLocked(std::chrono::system_clock::time_point time, std::shared_ptr<Segment>* previous) {
+    *previous = std::move(m_segment);
+    auto path = segmentPath(m_nextSequence);
+    const char* failedCall = "";
+    m_segment = Segment::create(path, m_segmentSize, time, &failedCall);
+    if (!m_segment) {
+        m_retryTime = time + CREATE_RETRY_INTERVAL;
+        reportError(
+            time,
+            LogEntry(TAG, "createSegmentFailed").d("path", path).d("call", failedCall).d("reason", strerror(errno)));
+        return;
+    }
+    m_sequences.push_back(m_nextSequence);
+    m_nextSequence++;
+    removeOldSegmentsLocked();
+}
+
+void FileLogger::completeSegment(const std::shared_ptr<Segment>& segment) {
+    if (Durability::NONE != m_durability) {
+        segment->sync(segment->length());
+    }
+}
+
+void FileLogger::writeToCerr(const char* line, size_t length) {
+    if (m_coutMutex) {
+        std::lock_guard<std::mutex> lock(*m_coutMutex);
+        std::cerr.write(line, length);
+        std::cerr.put('\n');
+        std::cerr.flush();
+    }
+}
+
+void FileLogger::reportError(std::chrono::system_clock::time_point time, const LogEntry& entry) {
+    std::string line;
+    m_logFormatter.format(Level::ERROR, time, ThreadMoniker::getThisThreadMonikerCString(), entry.c_str(), &line);
+    writeToCerr(line.data(), line.size());
+}
+
+void FileLogger::findExistingSegments() {
+    auto directory = opendir(m_directory.c_str());
+    if (!directory) {
+        if (ENOENT == errno && 0 == mkdir(m_directory.c_str(), 0755)) {
+            return;
+        }
+        reportError(
+            std::chrono::system_clock::now(),
+            LogEntry(TAG, "openDirectoryFailed").d("directory", m_directory).d("reason", strerror(errno)));
+        return;
+    }
+    auto namePrefix = m_prefix + ".";
+    while (auto entry = readdir(directory)) {
+        std::string name = entry->d_name;
+        if (name.size() <= namePrefix.size() + SEGMENT_SUFFIX.size() ||
+            name.compare(0, namePrefix.size(), namePrefix) != 0 ||
+            name.compare(name.size() - SEGMENT_SUFFIX.size(), SEGMENT_SUFFIX.size(), SEGMENT_SUFFIX) != 0) {
+            continue;
+        }
+        auto digits = name.substr(namePrefix.size(), name.size() - namePrefix.size() - SEGMENT_SUFFIX.size());
+        if (digits.find_first_not_of("0123456789") != std::string::npos) {
+            continue;
+        }
+        m_sequences.push_back(strtoull(digits.c_str(), nullptr, 10));
+    }
+    closedir(directory);
+    std::sort(m_sequences.begin(), m_sequences.end());
+    if (!m_sequences.empty()) {
+        m_nextSequence = m_sequences.back() + 1;
+    }
+}
+
+void FileLogger::removeOldSegmentsLocked() {
+    while (m_sequences.size() > m_maxSegmentCount) {
+        unlink(segmentPath(m_sequences.front()).c_str());
+        m_sequences.pop_front();
+    }
+}
+
+std::string FileLogger::segmentPath(uint64_t sequence) const {
+    char number[32];
+    snprintf(number, sizeof(number), "%0*" PRIu64, SEQUENCE_DIGITS, sequence);
+    return m_directory + "/" + m_prefix + "." + number + SEGMENT_SUFFIX;
+}
+
+void FileLogger::syncLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping) {
+        m_stopCondition.wait_for(lock, m_syncInterval);
+        if (m_stopping || !m_segment) {
+            continue;
+        }
+        auto segment = m_segment;
+        auto length = m_segment->length();
+        lock.unlock();
+        segment->sync(length);
+        // Release the segment before re-taking the lock, in case this is the last reference to a completed one.
+        segment.reset();
+        lock.lock();
+    }
+}
+
+std::shared_ptr<Logger> getFileLogger() {
+    return FileLogger::instance();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,679 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+#include "AVSCommon/Utils/CoutMutex.h"
+#include "AVSCommon/Utils/Logger/FlightRecorder.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("FlightRecorder");
+
+/// Configuration key for FlightRecorder settings.
+static const std::string CONFIG_KEY_FLIGHT_RECORDER = "flightRecorder";
+
+/// Configuration key for whether the recorder is enabled.
+static const std::string CONFIG_KEY_ENABLED = "enabled";
+
+/// Configuration key for the path of the file.
+static const std::string CONFIG_KEY_PATH = "path";
+
+/// Configuration key for the lowest level of entries to record.
+static const std::string CONFIG_KEY_LOG_LEVEL = "logLevel";
+
+/// Configuration key for the number of rings, which is the number of threads that can record at once.
+static const std::string CONFIG_KEY_THREAD_COUNT = "threadCount";
+
+/// Configuration key for the number of slots in each ring.
+static const std::string CONFIG_KEY_SLOT_COUNT = "slotCount";
+
+/// Configuration key for the size of each slot, in bytes.
+static const std::string CONFIG_KEY_SLOT_SIZE = "slotSize";
+
+/// Configuration key for whether to install the crash signal handlers.
+static const std::string CONFIG_KEY_CRASH_HANDLER = "crashHandler";
+
+/// Default path of the file.
+static const std::string DEFAULT_PATH = "/dev/shm/avsFlightRecorder";
+
+/// Default lowest level of entries to record.  @c Level::UNKNOWN records the entries logged at the levels of the
+/// modules and sinks, without lowering them.
+static const Level DEFAULT_LEVEL = Level::UNKNOWN;
+
+/// Default number of rings.
+static const uint32_t DEFAULT_THREAD_COUNT = 16;
+
+/// Default number of slots in each ring.
+static const uint32_t DEFAULT_SLOT_COUNT = 256;
+
+/// Default size of each slot.
+static const uint32_t DEFAULT_SLOT_SIZE = 256;
+
+/// Smallest allowed size of each slot.
+static const uint32_t MIN_SLOT_SIZE = 64;
+
+/// Suffix added to the path of the file left by the previous run.
+static const std::string PREVIOUS_FILE_SUFFIX = ".previous";
+
+/// Identifies a flight recorder file.
+static const char FILE_MAGIC[8] = {'A', 'C', 'S', 'D', 'K', 'F', 'R', 'C'};
+
+/// Version of the layout of the file.
+static const uint32_t FILE_VERSION = 1;
+
+/// Size of the file header.  The rings follow it.
+static const size_t HEADER_SIZE = 64;
+
+/// The signals that are noted in the file by the crash handler.
+static const int CRASH_SIGNALS[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+/// The number of signals in @c CRASH_SIGNALS.
+static const size_t CRASH_SIGNAL_COUNT = sizeof(CRASH_SIGNALS) / sizeof(CRASH_SIGNALS[0]);
+
+/// Smallest size of the alternate stack the crash handler runs on, in bytes.
+static const size_t MIN_ALTERNATE_STACK_SIZE = 64 * 1024;
+
+/// The header at the start of the file.
+struct FileHeader {
+    /// Equal to @c FILE_MAGIC once the rest of the header has been written.
+    char magic[sizeof(FILE_MAGIC)];
+
+    /// Equal to @c FILE_VERSION.
+    uint32_t version;
+
+    /// The number of rings.
+    uint32_t ringCount;
+
+    /// The number of slots in each ring.
+    uint32_t slotCount;
+
+    /// The size of each slot, including its @c SlotHeader.
+    uint32_t slotSize;
+
+    /// The identifier of the process writing to the file.
+    int32_t pid;
+
+    /// The signal that crashed the process, or zero.
+    std::atomic<int32_t> crashSignal;
+
+    /// The time the recorder was started, in nanoseconds since the epoch.
+    int64_t startTime;
+
+    /// The time of the crash, in nanoseconds since the epoch.
+    std::atomic<int64_t> crashTime;
+
+    /// The number of entries dropped because no ring was free.
+    std::atomic<uint64_t> droppedCount;
+};
+
+static_assert(sizeof(FileHeader) <= HEADER_SIZE, "FileHeader does not fit in HEADER_SIZE");
+
+/// The header of a ring.  Aligned so that threads writing to different rings do not share cache lines.
+struct alignas(64) FlightRecorder::Ring {
+    /// The identifier of the thread that has claimed the ring, or zero if it is free.
+    std::atomic<int32_t> owner;
+
+    /// The identifier of the thread that last claimed the ring.
+    int32_t threadId;
+
+    /// The sequence number of the next entry to write.  The slot for entry @c n is @c n modulo the slot count.
+    std::atomic<uint64_t> next;
+
+    /// The moniker of the thread that last claimed the ring.
+    char threadMoniker[ThreadMoniker::MAX_MONIKER_LENGTH + 1];
+};
+
+/// The header of a slot.  The text of the entry follows it.
+struct SlotHeader {
+    /// @c 2n+1 while entry @c n is being written to the slot, and @c 2n+2 once it has been written.
+    std::atomic<uint64_t> sequence;
+
+    /// The time that the entry was logged, in nanoseconds since the epoch.
+    int64_t time;
+
+    /// The number of bytes of text.
+    uint32_t length;
+
+    /// The severity level of the entry.
+    uint8_t level;
+
+    /// Padding.
+    uint8_t reserved[3];
+};
+
+class FlightRecorder::RingHandle {
+public:
+    /// Constructor.
+    RingHandle() : recorder{nullptr}, ring{nullptr}, releaseCount{0}, claimFailed{false} {
+    }
+
+    /// Destructor.  Releases the ring, keeping its entries for readers until another thread claims it.
+    ~RingHandle() {
+        if (ring) {
+            ring->owner.store(0, std::memory_order_release);
+            recorder->m_releaseCount++;
+        }
+    }
+
+    /// The recorder that @c ring belongs to.
+    FlightRecorder* recorder;
+
+    /// The ring claimed by this thread, or @c nullptr.
+    Ring* ring;
+
+    /// The value of @c m_releaseCount when this thread last tried to claim a ring.
+    uint32_t releaseCount;
+
+    /// Whether this thread's last attempt to claim a ring failed.
+    bool claimFailed;
+};
+
+/**
+ * Per-thread alternate stack for the crash handler.  Without one, a @c SIGSEGV raised by a stack overflow has no
+ * stack to run the handler on, and the process dies without the crash being noted.
+ */
+class AlternateSignalStack {
+public:
+    /// Constructor.
+    AlternateSignalStack() : m_stack{nullptr}, m_isInstalled{false} {
+    }
+
+    /// Destructor.  Removes the stack, if this object installed it, when the thread exits.
+    ~AlternateSignalStack() {
+        if (!m_stack) {
+            return;
+        }
+        stack_t disabled;
+        memset(&disabled, 0, sizeof(disabled));
+        disabled.ss_flags = SS_DISABLE;
+        sigaltstack(&disabled, nullptr);
+        free(m_stack);
+    }
+
+    /**
+     * Install an alternate stack for the calling thread, unless it already has one.  Does nothing after the first
+     * call on each thread.
+     */
+    void install() {
+        if (m_isInstalled) {
+            return;
+        }
+        m_isInstalled = true;
+        stack_t current;
+        if (sigaltstack(nullptr, &current) != 0 || !(current.ss_flags & SS_DISABLE)) {
+            // The application has already given this thread an alternate stack.
+            return;
+        }
+        // SIGSTKSZ is not a constant on every system.
+        auto size = std::max(static_cast<size_t>(SIGSTKSZ), MIN_ALTERNATE_STACK_SIZE);
+        auto stack = malloc(size);
+        if (!stack) {
+            return;
+        }
+        stack_t alternate;
+        memset(&alternate, 0, sizeof(alternate));
+        alternate.ss_sp = stack;
+        alternate.ss_size = size;
+        if (sigaltstack(&alternate, nullptr) != 0) {
+            free(stack);
+            return;
+        }
+        m_stack = stack;
+    }
+
+private:
+    /// The stack installed by this object, or @c nullptr.
+    void* m_stack;
+
+    /// Whether @c install() has been called.
+    bool m_isInstalled;
+};
+
+/// The recorder whose file the crash handler writes to.
+static std::atomic<FlightRecorder*> g_crashRecorder{nullptr};
+
+/**
+ * Give the calling thread an alternate stack for the crash handler, if it does not have one yet.
+ */
+static void installAlternateSignalStack() {
+    static thread_local AlternateSignalStack alternateStack;
+    alternateStack.install();
+}
+
+/// The handlers that were installed before the crash handler, in the order of @c CRASH_SIGNALS.
+static struct sigaction g_previousActions[CRASH_SIGNAL_COUNT];
+
+/**
+ * Get the header of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @return The header.
+ */
+static FileHeader* getHeader(char* data) {
+    return reinterpret_cast<FileHeader*>(data);
+}
+
+/**
+ * Get the first ring of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @return The first ring.
+ */
+template <typename RingType>
+static RingType* getRings(char* data) {
+    return reinterpret_cast<RingType*>(data + HEADER_SIZE);
+}
+
+/**
+ * Get a slot of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @param ringIndex The index of the ring.
+ * @param slotIndex The index of the slot within the ring.
+ * @param ringSize The size of a ring header.
+ * @return The slot.
+ */
+static SlotHeader* getSlot(char* data, size_t ringIndex, size_t slotIndex, size_t ringSize) {
+    auto header = getHeader(data);
+    auto slots = data + HEADER_SIZE + header->ringCount * ringSize;
+    return reinterpret_cast<SlotHeader*>(slots + (ringIndex * header->slotCount + slotIndex) * header->slotSize);
+}
+
+/**
+ * Convert a time to nanoseconds since the epoch.
+ *
+ * @param time The time.
+ * @return The number of nanoseconds since the epoch.
+ */
+static int64_t toNanoseconds(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+/**
+ * Convert nanoseconds since the epoch to a time.
+ *
+ * @param nanoseconds The number of nanoseconds since the epoch.
+ * @return The time.
+ */
+static std::chrono::system_clock::time_point fromNanoseconds(int64_t nanoseconds) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+}
+
+/**
+ * Get the operating system's identifier of the calling thread.
+ *
+ * @return The identifier, or -1 if the system does not provide one.  Never zero, which marks a free ring.
+ */
+static int32_t getThreadId() {
+#ifdef SYS_gettid
+    auto threadId = static_cast<int32_t>(syscall(SYS_gettid));
+    return threadId > 0 ? threadId : -1;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Report a failure to set up the recorder on @c std::cerr.  Logging it would recurse in to the @c ModuleLogger
+ * that is creating the recorder.
+ *
+ * @param entry The entry describing the failure.
+ */
+static void reportError(const LogEntry& entry) {
+    std::string line;
+    LogStringFormatter().format(
+        Level::ERROR,
+        std::chrono::system_clock::now(),
+        ThreadMoniker::getThisThreadMonikerCString(),
+        entry.c_str(),
+        &line);
+    line.push_back('\n');
+    auto coutMutex = getCoutMutex();
+    if (coutMutex) {
+        std::lock_guard<std::mutex> lock(*coutMutex);
+        std::cerr << line;
+        std::cerr.flush();
+    }
+}
+
+FlightRecorder* FlightRecorder::instance() {
+    static FlightRecorder* singleFlightRecorder = create();
+    return singleFlightRecorder;
+}
+
+FlightRecorder* FlightRecorder::create() {
+    auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_FLIGHT_RECORDER];
+    if (!configuration) {
+        return nullptr;
+    }
+    bool enabled = true;
+    configuration.getBool(CONFIG_KEY_ENABLED, &enabled, true);
+    if (!enabled) {
+        return nullptr;
+    }
+
+    std::string path;
+    configuration.getString(CONFIG_KEY_PATH, &path, DEFAULT_PATH);
+    auto level = DEFAULT_LEVEL;
+    std::string levelName;
+    if (configuration.getString(CONFIG_KEY_LOG_LEVEL, &levelName)) {
+        level = convertNameToLevel(levelName);
+        if (Level::UNKNOWN == level) {
+            reportError(LogEntry(TAG, "unknownLogLevel").d("name", levelName).m("using the levels of the sinks"));
+            level = DEFAULT_LEVEL;
+        }
+    }
+    uint32_t ringCount = DEFAULT_THREAD_COUNT;
+    configuration.getUint32(CONFIG_KEY_THREAD_COUNT, &ringCount, DEFAULT_THREAD_COUNT);
+    ringCount = std::max(ringCount, static_cast<uint32_t>(1));
+    uint32_t slotCount = DEFAULT_SLOT_COUNT;
+    configuration.getUint32(CONFIG_KEY_SLOT_COUNT, &slotCount, DEFAULT_SLOT_COUNT);
+    slotCount = std::max(slotCount, static_cast<uint32_t>(1));
+    uint32_t slotSize = DEFAULT_SLOT_SIZE;
+    configuration.getUint32(CONFIG_KEY_SLOT_SIZE, &slotSize, DEFAULT_SLOT_SIZE);
+    // Keep slots 8 byte aligned, for the sequence numbers.
+    slotSize = (std::max(slotSize, MIN_SLOT_SIZE) + 7) & ~static_cast<uint32_t>(7);
+    bool crashHandler = true;
+    configuration.getBool(CONFIG_KEY_CRASH_HANDLER, &crashHandler, true);
+
+    size_t size = HEADER_SIZE + ringCount * (sizeof(Ring) + static_cast<size_t>(slotCount) * slotSize);
+
+    // Keep the file of the previous run, which may have crashed.
+    if (access(path.c_str(), F_OK) == 0 && rename(path.c_str(), (path + PREVIOUS_FILE_SUFFIX).c_str()) != 0) {
+        reportError(LogEntry(TAG, "keepPreviousFileFailed").d("path", path).d("reason", strerror(errno)));
+    }
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        reportError(LogEntry(TAG, "createFailed").d("call", "open").d("path", path).d("reason", strerror(errno)));
+        return nullptr;
+    }
+    const char* failedCall = "ftruncate";
+    void* data = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) {
+        failedCall = "mmap";
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (MAP_FAILED == data) {
+        reportError(
+            LogEntry(TAG, "createFailed").d("call", failedCall).d("path", path).d("reason", strerror(errno)));
+        close(fd);
+        unlink(path.c_str());
+        return nullptr;
+    }
+    // The mapping keeps the file open.
+    close(fd);
+
+    auto header = getHeader(static_cast<char*>(data));
+    header->version = FILE_VERSION;
+    header->ringCount = ringCount;
+    header->slotCount = slotCount;
+    header->slotSize = slotSize;
+    header->pid = static_cast<int32_t>(getpid());
+    header->startTime = toNanoseconds(std::chrono::system_clock::now());
+    // Written last, so that readers that see the magic see the rest of the header.
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+
+    auto recorder = new FlightRecorder(level, static_cast<char*>(data));
+    if (crashHandler) {
+        recorder->installCrashHandler();
+    }
+    return recorder;
+}
+
+FlightRecorder::FlightRecorder(Level level, char* data) : m_level{level}, m_data{data}, m_releaseCount{0} {
+}
+
+Level FlightRecorder::getLevel() const {
+    return m_level;
+}
+
+void FlightRecorder::record(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& entry) {
+    auto ring = getRing(threadMoniker);
+    if (!ring) {
+        getHeader(m_data)->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // Entries captured in binary form are rendered, because their records point in to the memory of the process.
+    auto text = entry.c_str();
+    write(ring, level, time, text, strlen(text));
+}
+
+void FlightRecorder::record(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    auto ring = getRing(threadMoniker);
+    if (!ring) {
+        getHeader(m_data)->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!text) {
+        text = "";
+    }
+    write(ring, level, time, text, strlen(text));
+}
+
+FlightRecorder::Ring* FlightRecorder::getRing(const char* threadMoniker) {
+    static thread_local RingHandle handle;
+    if (handle.ring) {
+        return handle.ring;
+    }
+    auto releaseCount = m_releaseCount.load();
+    if (handle.claimFailed && handle.releaseCount == releaseCount) {
+        return nullptr;
+    }
+    if (g_crashRecorder.load() == this) {
+        installAlternateSignalStack();
+    }
+    handle.recorder = this;
+    handle.releaseCount = releaseCount;
+    handle.ring = claimRing(threadMoniker);
+    handle.claimFailed = !handle.ring;
+    return handle.ring;
+}
+
+FlightRecorder::Ring* FlightRecorder::claimRing(const char* threadMoniker) {
+    auto ringCount = getHeader(m_data)->ringCount;
+    auto rings = getRings<Ring>(m_data);
+    auto threadId = getThreadId();
+    // Prefer rings that have never been used, so that the entries of threads that have exited are kept longer.
+    for (int pass = 0; pass < 2; pass++) {
+        for (uint32_t ix = 0; ix < ringCount; ix++) {
+            auto& ring = rings[ix];
+            int32_t free = 0;
+            if ((0 == pass && ring.next.load(std::memory_order_relaxed) != 0) ||
+                !ring.owner.compare_exchange_strong(free, threadId)) {
+                continue;
+            }
+            ring.threadId = threadId;
+            strncpy(ring.threadMoniker, threadMoniker ? threadMoniker : "", sizeof(ring.threadMoniker) - 1);
+            ring.threadMoniker[sizeof(ring.threadMoniker) - 1] = '\0';
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+void FlightRecorder::write(
+    Ring* ring,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* text,
+    size_t length) {
+    auto header = getHeader(m_data);
+    auto sequence = ring->next.load(std::memory_order_relaxed);
+    auto slot = getSlot(m_data, ring - getRings<Ring>(m_data), sequence % header->slotCount, sizeof(Ring));
+    slot->sequence.store(2 * sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    length = std::min(length, header->slotSize - sizeof(SlotHeader));
+    slot->time = toNanoseconds(time);
+    slot->length = static_cast<uint32_t>(length);
+    slot->level = static_cast<uint8_t>(level);
+    memcpy(reinterpret_cast<char*>(slot + 1), text, length);
+    slot->sequence.store(2 * sequence + 2, std::memory_order_release);
+    ring->next.store(sequence + 1, std::memory_order_release);
+}
+
+void FlightRecorder::installCrashHandler() {
+    FlightRecorder* expected = nullptr;
+    if (!g_crashRecorder.compare_exchange_strong(expected, this)) {
+        return;
+    }
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onCrashSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_ONSTACK;
+    for (size_t ix = 0; ix < CRASH_SIGNAL_COUNT; ix++) {
+        sigaction(CRASH_SIGNALS[ix], &action, &g_previousActions[ix]);
+    }
+    // Other threads get theirs when they first record an entry.
+    installAlternateSignalStack();
+}
+
+void FlightRecorder::onCrashSignal(int signalNumber) {
+    // Only async-signal-safe calls from here on.
+    auto recorder = g_crashRecorder.load();
+    if (recorder) {
+        auto header = getHeader(recorder->m_data);
+        struct timespec now;
+        if (clock_gettime(CLOCK_REALTIME, &now) == 0) {
+            header->crashTime.store(static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec);
+        }
+        header->crashSignal.store(signalNumber);
+    }
+    // Hand the signal to the previous handler (by default, terminating the process).  The signal is blocked while
+    // this handler runs, so it is delivered again once this handler returns.
+    for (size_t ix = 0; ix < CRASH_SIGNAL_COUNT; ix++) {
+        if (CRASH_SIGNALS[ix] == signalNumber) {
+            sigaction(signalNumber, &g_previousActions[ix], nullptr);
+        }
+    }
+    raise(signalNumber);
+}
+
+bool FlightRecorder::read(const std::string& path, Snapshot* snapshot, std::string* error) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        *error = std::string("open: ") + strerror(errno);
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        *error = std::string("fstat: ") + strerror(errno);
+        close(fd);
+        return false;
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    if (size < HEADER_SIZE) {
+        *error = "file is too small";
+        close(fd);
+        return false;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == mapping) {
+        *error = std::string("mmap: ") + strerror(errno);
+        return false;
+    }
+    auto data = static_cast<char*>(mapping);
+    auto header = getHeader(data);
+    if (memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header->version != FILE_VERSION) {
+        *error = "not a flight recorder file";
+        munmap(mapping, size);
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->slotSize < sizeof(SlotHeader) ||
+        size < HEADER_SIZE + header->ringCount * (sizeof(Ring) + static_cast<size_t>(header->slotCount) *
+                                                                    header->slotSize)) {
+        *error = "file is truncated";
+        munmap(mapping, size);
+        return false;
+    }
+
+    snapshot->pid = header->pid;
+    snapshot->startTime = fromNanoseconds(header->startTime);
+    snapshot->crashSignal = header->crashSignal.load();
+    snapshot->crashTime = fromNanoseconds(header->crashTime.load());
+    snapshot->droppedCount = header->droppedCount.load();
+    snapshot->entries.clear();
+
+    auto rings = getRings<Ring>(data);
+    auto capacity = header->slotSize - sizeof(SlotHeader);
+    for (size_t ringIndex = 0; ringIndex < header->ringCount; ringIndex++) {
+        auto& ring = rings[ringIndex];
+        auto next = ring.next.load(std::memory_order_acquire);
+        auto first = next > header->slotCount ? next - header->slotCount : 0;
+        // Includes next, whose slot holds a torn entry if the thread died while writing it.
+        for (auto sequence = first; sequence <= next; sequence++) {
+            auto slot = getSlot(data, ringIndex, sequence % header->slotCount, sizeof(Ring));
+            auto before = slot->sequence.load(std::memory_order_acquire);
+            if (before != 2 * sequence + 2 && before != 2 * sequence + 1) {
+                continue;
+            }
+            Entry entry;
+            entry.torn = (before == 2 * sequence + 1);
+            entry.time = fromNanoseconds(slot->time);
+            entry.level = static_cast<Level>(std::min(slot->level, static_cast<uint8_t>(Level::UNKNOWN)));
+            entry.threadId = ring.threadId;
+            entry.threadMoniker.assign(ring.threadMoniker, strnlen(ring.threadMoniker, sizeof(ring.threadMoniker)));
+            entry.text.assign(reinterpret_cast<const char*>(slot + 1), std::min<size_t>(slot->length, capacity));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->sequence.load(std::memory_order_relaxed) != before) {
+                // Overwritten while it was being read.
+                continue;
+            }
+            snapshot->entries.push_back(std::move(entry));
+        }
+    }
+    munmap(mapping, size);
+
+    std::stable_sort(snapshot->entries.begin(), snapshot->entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.time < rhs.time;
+    });
+    return true;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,187 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include "AVSCommon/Utils/Logger/HexDump.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// The least number of hex digits in the offset of a row.
+static const int MIN_OFFSET_DIGITS = 8;
+
+/// The most number of hex digits in the offset of a row.
+static const int MAX_OFFSET_DIGITS = 2 * sizeof(size_t);
+
+/// Separator between the offset, hex and character columns of a row.
+static const char COLUMN_SEPARATOR[] = " : ";
+
+/// Length of @c COLUMN_SEPARATOR.
+static const size_t COLUMN_SEPARATOR_LENGTH = sizeof(COLUMN_SEPARATOR) - 1;
+
+/// The number of bytes in each group of the hex column.
+static const size_t GROUP_SIZE = 4;
+
+/// The digits of a hex number.
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+/// Lookup tables for rendering bytes.
+struct HexDumpTables {
+    /**
+     * Constructor.
+     */
+    HexDumpTables() {
+        for (int c = 0; c < 256; c++) {
+            hexPairs[2 * c] = HEX_DIGITS[c >> 4];
+            hexPairs[2 * c + 1] = HEX_DIGITS[c & 0xf];
+            // The characters that std::isprint() accepts in the "C" locale.
+            characters[c] = (c >= 0x20 && c < 0x7f) ? static_cast<char>(c) : '.';
+        }
+    }
+
+    /// The two hex digits of each byte.
+    char hexPairs[512];
+
+    /// Each byte as a character, or @c '.' if it is not printable.
+    char characters[256];
+};
+
+/**
+ * Get the lookup tables for rendering bytes.
+ *
+ * @return The lookup tables for rendering bytes.
+ */
+static const HexDumpTables& getTables() {
+    static const HexDumpTables tables;
+    return tables;
+}
+
+/**
+ * Write the offset of a row.
+ *
+ * @param offset The offset.
+ * @param[out] out The buffer to write to.
+ * @return The number of characters written.
+ */
+static size_t formatOffset(size_t offset, char* out) {
+    char digits[MAX_OFFSET_DIGITS];
+    int count = 0;
+    do {
+        digits[MAX_OFFSET_DIGITS - ++count] = HEX_DIGITS[offset & 0xf];
+        offset >>= 4;
+    } while (offset != 0);
+    while (count < MIN_OFFSET_DIGITS) {
+        digits[MAX_OFFSET_DIGITS - ++count] = '0';
+    }
+    memcpy(out, digits + MAX_OFFSET_DIGITS - count, count);
+    return count;
+}
+
+size_t getMaxHexDumpSize(size_t prefixLength, size_t width, size_t size) {
+    if (0 == width) {
+        width = DEFAULT_HEX_DUMP_WIDTH;
+    }
+    auto rowCount = (size + width - 1) / width;
+    auto rowSize = prefixLength + MAX_OFFSET_DIGITS + 2 * COLUMN_SEPARATOR_LENGTH + 2 * width + width / GROUP_SIZE +
+                   width + 1;
+    return rowCount * rowSize;
+}
+
+size_t formatHexDump(
+    const char* prefix,
+    size_t prefixLength,
+    size_t width,
+    const unsigned char* data,
+    size_t size,
+    char* out) {
+    if (0 == width) {
+        width = DEFAULT_HEX_DUMP_WIDTH;
+    }
+    auto& tables = getTables();
+    auto start = out;
+    for (size_t ix = 0; ix < size; ix += width) {
+        memcpy(out, prefix, prefixLength);
+        out += prefixLength;
+        out += formatOffset(ix, out);
+        memcpy(out, COLUMN_SEPARATOR, COLUMN_SEPARATOR_LENGTH);
+        out += COLUMN_SEPARATOR_LENGTH;
+
+        auto count = size - ix < width ? size - ix : width;
+        auto row = data + ix;
+        if (count == width && 0 == width % GROUP_SIZE) {
+            // A full row of whole groups: write a group of four bytes at a time.
+            for (size_t iy = 0; iy < width; iy += GROUP_SIZE) {
+                memcpy(out, &tables.hexPairs[2 * row[iy]], 2);
+                memcpy(out + 2, &tables.hexPairs[2 * row[iy + 1]], 2);
+                memcpy(out + 4, &tables.hexPairs[2 * row[iy + 2]], 2);
+                memcpy(out + 6, &tables.hexPairs[2 * row[iy + 3]], 2);
+                out[8] = ' ';
+                out += 9;
+            }
+            // No space follows the last group.
+            --out;
+        } else {
+            // Groups are aligned to offsets in the data, which only line up with rows if the width is a multiple of
+            // their size.
+            for (size_t iy = 0; iy < width; iy++) {
+                if (iy < count) {
+                    memcpy(out, &tables.hexPairs[2 * row[iy]], 2);
+                } else {
+                    out[0] = ' ';
+                    out[1] = ' ';
+                }
+                out += 2;
+                if (iy < width - 1 && GROUP_SIZE - 1 == ((ix + iy) & (GROUP_SIZE - 1))) {
+                    *out++ = ' ';
+                }
+            }
+        }
+
+        memcpy(out, COLUMN_SEPARATOR, COLUMN_SEPARATOR_LENGTH);
+        out += COLUMN_SEPARATOR_LENGTH;
+        for (size_t iy = 0; iy < count; iy++) {
+            out[iy] = tables.characters[row[iy]];
+        }
+        out += count;
+        *out++ = '\n';
+    }
+    return out - start;
+}
+
+void appendHexDump(const char* prefix, size_t width, const unsigned char* data, size_t size, std::string* out) {
+    if (!prefix) {
+        prefix = "";
+    }
+    auto prefixLength = strlen(prefix);
+    auto offset = out->size();
+    out->resize(offset + getMaxHexDumpSize(prefixLength, width, size));
+    out->resize(offset + formatHexDump(prefix, prefixLength, width, data, size, &(*out)[offset]));
+}
+
+size_t formatHex(const unsigned char* data, size_t size, char* out) {
+    auto& tables = getTables();
+    for (size_t ix = 0; ix < size; ix++) {
+        memcpy(out + 2 * ix, &tables.hexPairs[2 * data[ix]], 2);
+    }
+    return 2 * size;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
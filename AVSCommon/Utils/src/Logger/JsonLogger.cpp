@@ -0,0 +1,221 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cmath>
+
+#include "AVSCommon/Utils/CoutMutex.h"
+#include "AVSCommon/Utils/Logger/HexDump.h"
+#include "AVSCommon/Utils/Logger/JsonLogger.h"
+#include "AVSCommon/Utils/Logger/LogEntryRecord.h"
+#include "AVSCommon/Utils/Logger/NumberFormatting.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Configuration key for JsonLogger settings.
+static const std::string CONFIG_KEY_JSON_LOGGER = "jsonLogger";
+
+/// Key of the time of an entry, in milliseconds since the epoch.
+static const std::string KEY_TIMESTAMP = "timestamp";
+
+/// Key of the severity level of an entry.
+static const std::string KEY_LEVEL = "level";
+
+/// Key of the moniker of the thread that logged an entry.
+static const std::string KEY_THREAD = "thread";
+
+/// Key of the source of an entry.
+static const std::string KEY_SOURCE = "source";
+
+/// Key of the event of an entry.
+static const std::string KEY_EVENT = "event";
+
+/// Key of the object holding the metadata of an entry.
+static const std::string KEY_METADATA = "metadata";
+
+/// Key of the message of an entry.
+static const std::string KEY_MESSAGE = "message";
+
+/// Key of the text of an entry that was only available as text.
+static const std::string KEY_TEXT = "text";
+
+/// Lines at or above this level are flushed right away.
+static const Level FLUSH_LEVEL = Level::ERROR;
+
+std::shared_ptr<Logger> JsonLogger::instance() {
+    static std::shared_ptr<Logger> singleJsonLogger = [] {
+        // Capture the keys and values of entries, rather than just their text.
+        LogEntry::setCaptureMode(LogEntry::CaptureMode::BINARY);
+        return std::shared_ptr<JsonLogger>(new JsonLogger);
+    }();
+    return singleJsonLogger;
+}
+
+void JsonLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    auto& generator = startObject(level, time, threadMoniker);
+    generator.addMember(KEY_TEXT, text);
+    write(level, generator);
+}
+
+void JsonLogger::emitEntry(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& entry) {
+    if (!entry.isBinary()) {
+        emit(level, time, threadMoniker, entry.c_str());
+        return;
+    }
+    auto& generator = startObject(level, time, threadMoniker);
+    addRecord(generator, entry.record().data(), entry.record().size());
+    write(level, generator);
+}
+
+JsonLogger::JsonLogger() : Logger(Level::UNKNOWN), m_coutMutex{getCoutMutex()} {
+#ifdef DEBUG
+    setLevel(Level::DEBUG9);
+#else
+    setLevel(Level::INFO);
+#endif  // DEBUG
+    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_JSON_LOGGER]);
+}
+
+json::JsonGenerator& JsonLogger::startObject(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker) {
+    // Reused by each thread so that building an object does not allocate once its buffer has grown.
+    static thread_local json::JsonGenerator generator;
+    generator.reset();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+    generator.addMember(KEY_TIMESTAMP, static_cast<int64_t>(milliseconds));
+    generator.addMember(KEY_LEVEL, convertLevelToName(level));
+    if (!threadMoniker) {
+        threadMoniker = "";
+    }
+    // Monikers are padded for the columns of the text format.
+    while (' ' == *threadMoniker) {
+        ++threadMoniker;
+    }
+    generator.addMember(KEY_THREAD, threadMoniker);
+    return generator;
+}
+
+void JsonLogger::addRecord(json::JsonGenerator& generator, const char* data, size_t size) {
+    // Reused by each thread, as the generator takes keys and values as strings that are not null terminated here.
+    static thread_local std::string key;
+    static thread_local std::string value;
+    char number[MAX_FORMATTED_NUMBER_SIZE];
+
+    LogEntryRecord::Reader reader(data, size);
+    size_t length = 0;
+    auto text = reader.source(&length);
+    value.assign(text, length);
+    generator.addMember(KEY_SOURCE, value);
+    text = reader.event(&length);
+    value.assign(text, length);
+    generator.addMember(KEY_EVENT, value);
+
+    bool hasMetadata = false;
+    const char* message = nullptr;
+    size_t messageLength = 0;
+    LogEntryRecord::Field field;
+    while (reader.next(&field)) {
+        if (LogEntryRecord::FieldType::MESSAGE == field.type) {
+            message = field.text;
+            messageLength = field.textLength;
+            continue;
+        }
+        if (!hasMetadata) {
+            generator.startObject(KEY_METADATA);
+            hasMetadata = true;
+        }
+        key.assign(field.key, field.keyLength);
+        switch (field.type) {
+            case LogEntryRecord::FieldType::INT64:
+                generator.addMember(key, field.int64Value);
+                break;
+            case LogEntryRecord::FieldType::UINT64:
+                generator.addMember(key, field.uint64Value);
+                break;
+            case LogEntryRecord::FieldType::DOUBLE:
+            case LogEntryRecord::FieldType::FLOAT: {
+                double floating =
+                    LogEntryRecord::FieldType::DOUBLE == field.type ? field.doubleValue : field.floatValue;
+                // JSON has no representation of infinities and NaN, so they are written as strings.
+                if (std::isfinite(floating)) {
+                    generator.addMember(key, floating);
+                } else {
+                    value.assign(std::isnan(floating) ? "nan" : (floating > 0 ? "inf" : "-inf"));
+                    generator.addMember(key, value);
+                }
+                break;
+            }
+            case LogEntryRecord::FieldType::POINTER:
+                value.assign(number, formatPointer(field.pointerValue, number));
+                generator.addMember(key, value);
+                break;
+            case LogEntryRecord::FieldType::STRING:
+            case LogEntryRecord::FieldType::TEXT:
+                value.assign(field.text, field.textLength);
+                generator.addMember(key, value);
+                break;
+            case LogEntryRecord::FieldType::MESSAGE:
+                break;
+            case LogEntryRecord::FieldType::BYTES:
+                // Bytes are written as a string of hex digits rather than as a dump.
+                value.resize(2 * field.textLength);
+                value.resize(
+                    formatHex(reinterpret_cast<const unsigned char*>(field.text), field.textLength, &value[0]));
+                generator.addMember(key, value);
+                break;
+        }
+    }
+    if (hasMetadata) {
+        generator.finishObject();
+    }
+    if (message) {
+        value.assign(message, messageLength);
+        generator.addMember(KEY_MESSAGE, value);
+    }
+}
+
+void JsonLogger::write(Level level, json::JsonGenerator& generator) {
+    size_t length = 0;
+    auto json = generator.toCString(&length);
+    if (m_coutMutex) {
+        std::lock_guard<std::mutex> lock(*m_coutMutex);
+        std::cout.write(json, length);
+        std::cout.put('\n');
+        if (level >= FLUSH_LEVEL) {
+            std::cout.flush();
+        }
+    }
+}
+
+std::shared_ptr<Logger> getJsonLogger() {
+    return JsonLogger::instance();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
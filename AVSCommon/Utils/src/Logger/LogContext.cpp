@@ -0,0 +1,130 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+#include <memory>
+
+#include "AVSCommon/Utils/Logger/LogContext.h"
+#include "AVSCommon/Utils/Logger/MetadataEscaping.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Reserved in metadata sequences to separate key,value pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Reserved in metadata sequences to separate keys from values.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+/// Capacity reserved for each thread's context the first time it is used, so that most threads never grow it.
+static const size_t INITIAL_CAPACITY = 256;
+
+/// The context of a thread.
+struct ThreadContext {
+    /**
+     * Constructor.
+     */
+    ThreadContext() {
+        text.reserve(INITIAL_CAPACITY);
+        pairs.reserve(INITIAL_CAPACITY);
+    }
+
+    /// @c ",key=value" for each pair, with the values escaped.
+    std::string text;
+
+    /// Each key and value, followed by a null character.
+    std::string pairs;
+};
+
+/// The context of each thread.
+static thread_local ThreadContext g_threadContext;
+
+LogContext::LogContext(const char* key, const char* value) {
+    if (!value) {
+        value = "";
+    }
+    push(key, value, strlen(value));
+}
+
+LogContext::LogContext(const char* key, const std::string& value) {
+    push(key, value.data(), value.size());
+}
+
+LogContext::LogContext(const Snapshot& snapshot) {
+    auto& context = g_threadContext;
+    m_previousTextSize = context.text.size();
+    m_previousPairsSize = context.pairs.size();
+    context.text.append(snapshot.text);
+    context.pairs.append(snapshot.pairs);
+}
+
+LogContext::~LogContext() {
+    auto& context = g_threadContext;
+    context.text.resize(m_previousTextSize);
+    context.pairs.resize(m_previousPairsSize);
+}
+
+void LogContext::push(const char* key, const char* value, size_t length) {
+    auto& context = g_threadContext;
+    if (!key) {
+        key = "";
+    }
+    auto keyLength = strlen(key);
+    m_previousTextSize = context.text.size();
+    m_previousPairsSize = context.pairs.size();
+
+    // Make room for the value to be escaped in place, then trim to the length it took.
+    auto& text = context.text;
+    text.push_back(PAIR_SEPARATOR);
+    text.append(key, keyLength);
+    text.push_back(KEY_VALUE_SEPARATOR);
+    auto valueOffset = text.size();
+    text.resize(valueOffset + 2 * length);
+    text.resize(valueOffset + escapeMetadata(value, length, &text[valueOffset]));
+
+    auto& pairs = context.pairs;
+    pairs.append(key, keyLength + 1);
+    pairs.append(value, length);
+    pairs.push_back('\0');
+}
+
+std::function<void()> LogContext::bind(std::function<void()> task) {
+    auto& context = g_threadContext;
+    if (context.text.empty()) {
+        return task;
+    }
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->text = context.text;
+    snapshot->pairs = context.pairs;
+    return [snapshot, task]() {
+        LogContext scope(*snapshot);
+        task();
+    };
+}
+
+const std::string& LogContext::getText() {
+    return g_threadContext.text;
+}
+
+const std::string& LogContext::getPairs() {
+    return g_threadContext.pairs;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
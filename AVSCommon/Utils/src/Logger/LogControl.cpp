@@ -0,0 +1,412 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "AVSCommon/Utils/CoutMutex.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Logger/LogControl.h"
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LogControl");
+
+/// Configuration key for LogControl settings.
+static const std::string CONFIG_KEY_LOG_CONTROL = "logControl";
+
+/// Configuration key for whether the file is enabled.
+static const std::string CONFIG_KEY_ENABLED = "enabled";
+
+/// Configuration key for the path of the file.
+static const std::string CONFIG_KEY_PATH = "path";
+
+/// Configuration key for the number of slots, which is the number of modules the file can hold.
+static const std::string CONFIG_KEY_MODULE_COUNT = "moduleCount";
+
+/// Default path of the file, to which a '.' and the identifier of the process are appended.
+static const std::string DEFAULT_PATH_PREFIX = "/dev/shm/avsLogControl";
+
+/// Default number of slots.  Enough for every module of the SDK, and 32 KiB of memory.
+static const uint32_t DEFAULT_MODULE_COUNT = 512;
+
+/// Identifies a log control file.
+static const char FILE_MAGIC[8] = {'A', 'C', 'S', 'D', 'K', 'L', 'C', 'P'};
+
+/// Version of the layout of the file.
+static const uint32_t FILE_VERSION = 1;
+
+/// Size of the file header.  The slots follow it.
+static const size_t HEADER_SIZE = 64;
+
+/// The header at the start of the file.
+struct FileHeader {
+    /// Equal to @c FILE_MAGIC once the rest of the header has been written.
+    char magic[sizeof(FILE_MAGIC)];
+
+    /// Equal to @c FILE_VERSION.
+    uint32_t version;
+
+    /// The number of slots.
+    uint32_t slotCount;
+
+    /// The identifier of the process that created the file.
+    int32_t pid;
+
+    /// The number of slots that have been claimed.  Slots are claimed in order and never released.
+    std::atomic<uint32_t> usedCount;
+};
+
+constexpr size_t LogControl::MAX_MODULE_NAME_LENGTH;
+
+static_assert(sizeof(FileHeader) <= HEADER_SIZE, "FileHeader does not fit in HEADER_SIZE");
+static_assert(sizeof(LogControl::Slot) == 64, "LogControl::Slot should fill a cache line");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Levels shared with other processes must be lock free");
+
+/**
+ * Get the header of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @return The header.
+ */
+static FileHeader* getHeader(char* data) {
+    return reinterpret_cast<FileHeader*>(data);
+}
+
+/**
+ * Get the slots of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @return The first slot.
+ */
+static LogControl::Slot* getSlots(char* data) {
+    return reinterpret_cast<LogControl::Slot*>(data + HEADER_SIZE);
+}
+
+/**
+ * Report a failure to set up the file on @c std::cerr.  Logging it would recurse in to the @c ModuleLogger that is
+ * claiming a slot.
+ *
+ * @param entry The entry describing the failure.
+ */
+static void reportError(const LogEntry& entry) {
+    std::string line;
+    LogStringFormatter().format(
+        Level::ERROR,
+        std::chrono::system_clock::now(),
+        ThreadMoniker::getThisThreadMonikerCString(),
+        entry.c_str(),
+        &line);
+    line.push_back('\n');
+    auto coutMutex = getCoutMutex();
+    if (coutMutex) {
+        std::lock_guard<std::mutex> lock(*coutMutex);
+        std::cerr << line;
+        std::cerr.flush();
+    }
+}
+
+/**
+ * Map an existing log control file, for a process that changes the levels in it.
+ *
+ * @param path The path of the file.
+ * @param[out] size The size of the mapping.
+ * @param[out] error If the file could not be mapped, why.
+ * @return The mapping of the file, or @c nullptr if it could not be mapped or is not a log control file.
+ */
+static char* mapFile(const std::string& path, size_t* size, std::string* error) {
+    int fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+        *error = "open failed: " + std::string(strerror(errno));
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        *error = "fstat failed: " + std::string(strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+    *size = static_cast<size_t>(status.st_size);
+    if (*size < HEADER_SIZE) {
+        *error = "file too small";
+        close(fd);
+        return nullptr;
+    }
+    auto data = mmap(nullptr, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        *error = "mmap failed: " + std::string(strerror(errno));
+        return nullptr;
+    }
+    auto header = getHeader(static_cast<char*>(data));
+    if (memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+        *error = "not a log control file";
+    } else if (header->version != FILE_VERSION) {
+        *error = "unsupported version " + std::to_string(header->version);
+    } else if (HEADER_SIZE + static_cast<size_t>(header->slotCount) * sizeof(LogControl::Slot) > *size) {
+        *error = "file truncated";
+    } else {
+        return static_cast<char*>(data);
+    }
+    munmap(data, *size);
+    return nullptr;
+}
+
+/**
+ * Get the number of claimed slots of a mapped file.
+ *
+ * @param data The mapping of the file.
+ * @return The number of slots that have been claimed and had their names written.
+ */
+static uint32_t getUsedCount(char* data) {
+    auto header = getHeader(data);
+    return std::min(header->usedCount.load(std::memory_order_acquire), header->slotCount);
+}
+
+/**
+ * Return whether a log control file is in use by a process that is still running.
+ *
+ * @param path The path of the file.
+ * @param[out] pid The identifier of the process that created the file, if it is in use.
+ * @return Whether the file is a log control file created by a running process other than this one.
+ */
+static bool isInUse(const std::string& path, int32_t* pid) {
+    size_t size = 0;
+    std::string error;
+    auto data = mapFile(path, &size, &error);
+    if (!data) {
+        return false;
+    }
+    *pid = getHeader(data)->pid;
+    munmap(data, size);
+    if (*pid <= 0 || *pid == static_cast<int32_t>(getpid())) {
+        return false;
+    }
+    return kill(*pid, 0) == 0 || EPERM == errno;
+}
+
+/// The path of the file this process created, which is unlinked when the process exits.
+static std::string g_createdPath;
+
+/// The identifier of the process that created @c g_createdPath, so that a forked child does not unlink it.
+static pid_t g_creatorPid = 0;
+
+/**
+ * Unlink the file this process created.  The mapping stays valid for loggers still logging while the process exits.
+ */
+static void unlinkCreatedFile() {
+    if (getpid() == g_creatorPid) {
+        unlink(g_createdPath.c_str());
+    }
+}
+
+LogControl* LogControl::instance() {
+    static LogControl* singleLogControl = create();
+    return singleLogControl;
+}
+
+LogControl* LogControl::create() {
+    auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_LOG_CONTROL];
+    if (!configuration) {
+        return nullptr;
+    }
+    bool enabled = true;
+    configuration.getBool(CONFIG_KEY_ENABLED, &enabled, true);
+    if (!enabled) {
+        return nullptr;
+    }
+
+    std::string path;
+    configuration.getString(CONFIG_KEY_PATH, &path, DEFAULT_PATH_PREFIX + "." + std::to_string(getpid()));
+    uint32_t slotCount = DEFAULT_MODULE_COUNT;
+    configuration.getUint32(CONFIG_KEY_MODULE_COUNT, &slotCount, DEFAULT_MODULE_COUNT);
+    slotCount = std::max(slotCount, static_cast<uint32_t>(1));
+    size_t size = HEADER_SIZE + static_cast<size_t>(slotCount) * sizeof(Slot);
+
+    // Leave the file of a process that is still running to it.
+    int32_t ownerPid = 0;
+    if (isInUse(path, &ownerPid)) {
+        reportError(LogEntry(TAG, "createFailed").d("path", path).d("pid", ownerPid).m("file in use"));
+        return nullptr;
+    }
+    // Unlink rather than truncate a file left by another run, which may still be mapped by a process using it.
+    if (unlink(path.c_str()) != 0 && errno != ENOENT) {
+        reportError(LogEntry(TAG, "unlinkPreviousFileFailed").d("path", path).d("reason", strerror(errno)));
+    }
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        reportError(LogEntry(TAG, "createFailed").d("call", "open").d("path", path).d("reason", strerror(errno)));
+        return nullptr;
+    }
+    const char* failedCall = "ftruncate";
+    void* data = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) {
+        failedCall = "mmap";
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (MAP_FAILED == data) {
+        reportError(
+            LogEntry(TAG, "createFailed").d("call", failedCall).d("path", path).d("reason", strerror(errno)));
+        close(fd);
+        unlink(path.c_str());
+        return nullptr;
+    }
+    // The mapping keeps the file open.
+    close(fd);
+
+    auto header = getHeader(static_cast<char*>(data));
+    header->version = FILE_VERSION;
+    header->slotCount = slotCount;
+    header->pid = static_cast<int32_t>(getpid());
+    // Written last, so that readers that see the magic see the rest of the header.
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+
+    g_createdPath = path;
+    g_creatorPid = getpid();
+    atexit(unlinkCreatedFile);
+
+    return new LogControl(static_cast<char*>(data));
+}
+
+LogControl::LogControl(char* data) : m_data{data}, m_isFullReported{false} {
+}
+
+LogControl::Slot* LogControl::claimSlot(const std::string& name) {
+    auto header = getHeader(m_data);
+    auto slots = getSlots(m_data);
+    auto length = std::min(name.size(), MAX_MODULE_NAME_LENGTH);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto usedCount = header->usedCount.load(std::memory_order_relaxed);
+    for (uint32_t ix = 0; ix < usedCount; ix++) {
+        if (strncmp(slots[ix].name, name.c_str(), length) == 0 && '\0' == slots[ix].name[length]) {
+            return &slots[ix];
+        }
+    }
+    if (usedCount == header->slotCount) {
+        if (!m_isFullReported) {
+            reportError(LogEntry(TAG, "claimSlotFailed")
+                            .d("module", name)
+                            .d("moduleCount", header->slotCount)
+                            .m("every slot is in use, further modules are not reported"));
+            m_isFullReported = true;
+        }
+        return nullptr;
+    }
+    auto slot = &slots[usedCount];
+    memcpy(slot->name, name.c_str(), length);
+    slot->name[length] = '\0';
+    slot->level = Level::UNKNOWN;
+    slot->forwardLevel = Level::UNKNOWN;
+    slot->configuredLevel = Level::UNKNOWN;
+    slot->recordLevel = Level::UNKNOWN;
+    slot->overrideLevel = Level::UNKNOWN;
+    // Published after the name, so that readers only see slots whose names have been written.
+    header->usedCount.store(usedCount + 1, std::memory_order_release);
+    return slot;
+}
+
+void LogControl::update(Slot* slot, Level configuredLevel, Level recordLevel) {
+    slot->configuredLevel = configuredLevel;
+    slot->recordLevel = recordLevel;
+    apply(slot);
+}
+
+void LogControl::apply(Slot* slot) {
+    Level overrideLevel;
+    Level configuredLevel;
+    Level recordLevel;
+    // The process and a tool may change the levels at the same time.  Whichever of them stores the results last
+    // goes round again if the other has changed the levels it read, so the results are never left stale.
+    do {
+        overrideLevel = slot->overrideLevel;
+        configuredLevel = slot->configuredLevel;
+        recordLevel = slot->recordLevel;
+        auto forwardLevel = (Level::UNKNOWN == overrideLevel) ? configuredLevel : overrideLevel;
+        slot->forwardLevel = forwardLevel;
+        slot->level = (recordLevel < forwardLevel) ? recordLevel : forwardLevel;
+    } while (slot->overrideLevel != overrideLevel || slot->configuredLevel != configuredLevel ||
+             slot->recordLevel != recordLevel);
+}
+
+bool LogControl::readModules(const std::string& path, int32_t* pid, std::vector<Module>* modules, std::string* error) {
+    size_t size = 0;
+    auto data = mapFile(path, &size, error);
+    if (!data) {
+        return false;
+    }
+    *pid = getHeader(data)->pid;
+    modules->clear();
+    auto slots = getSlots(data);
+    auto usedCount = getUsedCount(data);
+    for (uint32_t ix = 0; ix < usedCount; ix++) {
+        auto& slot = slots[ix];
+        Module module;
+        module.name.assign(slot.name, strnlen(slot.name, MAX_MODULE_NAME_LENGTH));
+        module.level = slot.level;
+        module.forwardLevel = slot.forwardLevel;
+        module.configuredLevel = slot.configuredLevel;
+        module.overrideLevel = slot.overrideLevel;
+        modules->push_back(module);
+    }
+    munmap(data, size);
+    return true;
+}
+
+bool LogControl::setOverride(const std::string& path, const std::string& name, Level level, std::string* error) {
+    size_t size = 0;
+    auto data = mapFile(path, &size, error);
+    if (!data) {
+        return false;
+    }
+    bool found = false;
+    auto slots = getSlots(data);
+    auto usedCount = getUsedCount(data);
+    for (uint32_t ix = 0; ix < usedCount && !found; ix++) {
+        auto slot = &slots[ix];
+        if (name == std::string(slot->name, strnlen(slot->name, MAX_MODULE_NAME_LENGTH))) {
+            slot->overrideLevel = level;
+            apply(slot);
+            found = true;
+        }
+    }
+    munmap(data, size);
+    if (!found) {
+        *error = "no module named " + name;
+    }
+    return found;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
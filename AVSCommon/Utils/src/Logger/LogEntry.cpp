@@ -13,33 +13,24 @@
  * permissions and limitations under the License.
  */
 
+#include "AVSCommon/Utils/Logger/LogContext.h"
 #include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/MetadataEscaping.h"
+#include "AVSCommon/Utils/Logger/PrivateDataRedactor.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iomanip>
+#include <new>
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace logger {
 
-/// List of characters we need to escape.
-static const char* RESERVED_METADATA_CHARS = R"(\,=:)";
-
-/// Escape sequence for '%'.
-static const std::string ESCAPED_METADATA_ESCAPE = R"(\\)";
-
-/// Escape sequence for ','.
-static const std::string ESCAPED_PAIR_SEPARATOR = R"(\,)";
-
-/// Escape sequence for ':'.
-static const std::string ESCAPED_SECTION_SEPARATOR = R"(\:)";
-
-/// Escape sequence for '='.
-static const std::string ESCAPED_KEY_VALUE_SEPARATOR = R"(\=)";
-
-/// Reserved in metadata sequences for escaping other reserved values.
-static const char METADATA_ESCAPE = '\\';
+/// Number of characters escaped at a time by @c appendEscapedString() before writing them to the stream.
+static const size_t ESCAPE_BLOCK_SIZE = 256;
 
 /// Reserved in metadata sequences to separate key,value pairs.
 static const char PAIR_SEPARATOR = ',';
@@ -53,18 +44,59 @@ static const std::string BOOL_TRUE = "true";
 /// String for boolean FALSE
 static const std::string BOOL_FALSE = "false";
 
-LogEntry::LogEntry(const std::string& source, const char* event) : m_hasMetadata(false) {
-    m_stream << source << SECTION_SEPARATOR;
-    if (event) {
-        m_stream << event;
+/// The capture mode used by newly created instances of @c LogEntry.
+static std::atomic<LogEntry::CaptureMode> g_captureMode{LogEntry::CaptureMode::TEXT};
+
+void LogEntry::setCaptureMode(CaptureMode mode) {
+    g_captureMode.store(mode, std::memory_order_relaxed);
+}
+
+LogEntry::CaptureMode LogEntry::getCaptureMode() {
+    return g_captureMode.load(std::memory_order_relaxed);
+}
+
+LogEntry::LogEntry(const std::string& source, const char* event) :
+        m_hasMetadata(false),
+        m_isBinary(CaptureMode::BINARY == g_captureMode.load(std::memory_order_relaxed)),
+        m_hasStream(false),
+        m_hasRenderedDumps(false),
+        m_messageOffset(0) {
+    if (m_isBinary) {
+        m_record.start(source, event);
+    } else {
+        stream() << source << SECTION_SEPARATOR;
+        if (event) {
+            stream() << event;
+        }
+    }
+    addContext();
+}
+
+LogEntry::LogEntry(const std::string& source, const std::string& event) :
+        m_hasMetadata(false),
+        m_isBinary(CaptureMode::BINARY == g_captureMode.load(std::memory_order_relaxed)),
+        m_hasStream(false),
+        m_hasRenderedDumps(false),
+        m_messageOffset(0) {
+    if (m_isBinary) {
+        m_record.start(source, event);
+    } else {
+        stream() << source << SECTION_SEPARATOR << event;
     }
+    addContext();
 }
 
-LogEntry::LogEntry(const std::string& source, const std::string& event) : m_hasMetadata(false) {
-    m_stream << source << SECTION_SEPARATOR << event;
+LogEntry::~LogEntry() {
+    if (m_hasStream) {
+        reinterpret_cast<LogEntryStream*>(&m_streamStorage)->~LogEntryStream();
+    }
 }
 
 LogEntry& LogEntry::d(const std::string& key, const char* value) {
+    if (m_isBinary) {
+        captureString(key.c_str(), true, value);
+        return *this;
+    }
     return d(key.c_str(), value);
 }
 
@@ -73,16 +105,24 @@ LogEntry& LogEntry::d(const char* key, char* value) {
 }
 
 LogEntry& LogEntry::d(const char* key, const char* value) {
+    if (m_isBinary) {
+        captureString(key, false, value);
+        return *this;
+    }
     prefixKeyValuePair();
     if (!key) {
         key = "";
     }
-    m_stream << key << KEY_VALUE_SEPARATOR;
+    stream() << key << KEY_VALUE_SEPARATOR;
     appendEscapedString(value);
     return *this;
 }
 
 LogEntry& LogEntry::d(const std::string& key, const std::string& value) {
+    if (m_isBinary) {
+        captureString(key.c_str(), true, value.c_str());
+        return *this;
+    }
     return d(key.c_str(), value.c_str());
 }
 
@@ -91,6 +131,10 @@ LogEntry& LogEntry::d(const char* key, const std::string& value) {
 }
 
 LogEntry& LogEntry::d(const std::string& key, bool value) {
+    if (m_isBinary) {
+        captureString(key.c_str(), true, value ? BOOL_TRUE.c_str() : BOOL_FALSE.c_str());
+        return *this;
+    }
     return d(key.c_str(), value);
 }
 
@@ -98,17 +142,36 @@ LogEntry& LogEntry::d(const char* key, bool value) {
     return d(key, value ? BOOL_TRUE : BOOL_FALSE);
 }
 
+LogEntry& LogEntry::obfuscatePrivateData(const char* key, const std::string& value) {
+    // Reused by each thread so that obfuscating a value does not allocate once the buffer has grown.
+    static thread_local std::string obfuscated;
+    if (PrivateDataRedactor::instance().redact(value, &obfuscated)) {
+        return d(key, obfuscated);
+    }
+    return d(key, value);
+}
+
 LogEntry& LogEntry::m(const char* message) {
+    if (m_isBinary) {
+        m_record.addMessage(message ? message : "", message ? strlen(message) : 0);
+        return *this;
+    }
+    m_messageOffset = stream().size();
     prefixMessage();
     if (message) {
-        m_stream << message;
+        stream() << message;
     }
     return *this;
 }
 
 LogEntry& LogEntry::m(const std::string& message) {
+    if (m_isBinary) {
+        m_record.addMessage(message.data(), message.size());
+        return *this;
+    }
+    m_messageOffset = stream().size();
     prefixMessage();
-    m_stream << message;
+    stream() << message;
     return *this;
 }
 
@@ -116,56 +179,119 @@ LogEntry& LogEntry::p(const char* key, void* ptr) {
     return d(key, ptr);
 }
 
+LogEntry& LogEntry::dump(const char* key, const void* data, size_t size, size_t width) {
+    if (!data) {
+        size = 0;
+    }
+    if (!m_isBinary) {
+        prefixKeyValuePair();
+        stream() << (key ? key : "") << KEY_VALUE_SEPARATOR;
+        appendValue(size, UnsignedTag());
+        if (0 == m_record.size()) {
+            // The record only holds the bytes to dump, but starts like any other so that it can be read back.
+            m_record.start(std::string(), nullptr);
+        }
+    }
+    m_record.beginField(LogEntryRecord::FieldType::BYTES, key, false);
+    m_record.appendBytes(data, size, width);
+    return *this;
+}
+
 const char* LogEntry::c_str() const {
-    return m_stream.c_str();
+    if (m_isBinary && !m_hasStream) {
+        LogEntryRecord::render(m_record.data(), m_record.size(), stream());
+    } else if (!m_isBinary && m_record.size() > 0 && !m_hasRenderedDumps) {
+        LogEntryRecord::renderDumps(m_record.data(), m_record.size(), stream());
+        m_hasRenderedDumps = true;
+    }
+    return stream().c_str();
+}
+
+bool LogEntry::isBinary() const {
+    return m_isBinary;
+}
+
+const LogEntryRecord& LogEntry::record() const {
+    return m_record;
+}
+
+void LogEntry::captureString(const char* key, bool copyKey, const char* value) {
+    m_record.beginField(LogEntryRecord::FieldType::STRING, key, copyKey);
+    m_record.appendText(value ? value : "", value ? strlen(value) : 0);
+}
+
+LogEntryStream& LogEntry::stream() const {
+    if (!m_hasStream) {
+        new (&m_streamStorage) LogEntryStream();
+        m_hasStream = true;
+    }
+    return *reinterpret_cast<LogEntryStream*>(&m_streamStorage);
+}
+
+void LogEntry::addContext() {
+    if (m_isBinary) {
+        auto& pairs = LogContext::getPairs();
+        auto position = pairs.c_str();
+        auto end = position + pairs.size();
+        while (position < end) {
+            auto value = position + strlen(position) + 1;
+            captureString(position, true, value);
+            position = value + strlen(value) + 1;
+        }
+        return;
+    }
+    auto& text = LogContext::getText();
+    if (text.empty()) {
+        return;
+    }
+    // The text starts with a pair separator, in place of which the metadata section starts.
+    auto& out = stream();
+    out << SECTION_SEPARATOR;
+    memcpy(out.reserve(text.size() - 1), text.data() + 1, text.size() - 1);
+    out.commit(text.size() - 1);
+    m_hasMetadata = true;
 }
 
 void LogEntry::prefixKeyValuePair() {
     if (m_hasMetadata) {
-        m_stream << PAIR_SEPARATOR;
+        stream() << PAIR_SEPARATOR;
     } else {
-        m_stream << SECTION_SEPARATOR;
+        stream() << SECTION_SEPARATOR;
         m_hasMetadata = true;
     }
 }
 
 void LogEntry::prefixMessage() {
     if (!m_hasMetadata) {
-        m_stream << SECTION_SEPARATOR;
+        stream() << SECTION_SEPARATOR;
     }
-    m_stream << SECTION_SEPARATOR;
+    stream() << SECTION_SEPARATOR;
+}
+
+const std::string& LogEntry::detachMessage() {
+    // Reused by each thread so that moving a message does not allocate once the buffer has grown.
+    static thread_local std::string message;
+    auto& out = stream();
+    // The message section starts with the separators added by prefixMessage().
+    auto textOffset = m_messageOffset + (m_hasMetadata ? 1 : 2);
+    message.assign(out.c_str() + textOffset, out.size() - textOffset);
+    out.truncate(m_messageOffset);
+    m_messageOffset = 0;
+    return message;
 }
 
 void LogEntry::appendEscapedString(const char* in) {
     if (!in) {
         return;
     }
-    auto pos = in;
-    // A little insurance against an infinite loop.
-    auto maxCount = strlen(in);
-    while (maxCount-- > 0 && *pos != 0) {
-        auto next = strpbrk(pos, RESERVED_METADATA_CHARS);
-        if (next) {
-            m_stream.write(pos, next - pos);
-            switch (*next) {
-                case METADATA_ESCAPE:
-                    m_stream << ESCAPED_METADATA_ESCAPE;
-                    break;
-                case PAIR_SEPARATOR:
-                    m_stream << ESCAPED_PAIR_SEPARATOR;
-                    break;
-                case SECTION_SEPARATOR:
-                    m_stream << ESCAPED_SECTION_SEPARATOR;
-                    break;
-                case KEY_VALUE_SEPARATOR:
-                    m_stream << ESCAPED_KEY_VALUE_SEPARATOR;
-                    break;
-            }
-            pos = next + 1;
-        } else {
-            m_stream << pos;
-            return;
-        }
+    auto& out = stream();
+    auto remaining = strlen(in);
+    char escaped[2 * ESCAPE_BLOCK_SIZE];
+    while (remaining > 0) {
+        auto blockSize = std::min(remaining, ESCAPE_BLOCK_SIZE);
+        out.write(escaped, escapeMetadata(in, blockSize, escaped));
+        in += blockSize;
+        remaining -= blockSize;
     }
 }
 
@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
+
 #include "AVSCommon/Utils/Logger/LogEntryBuffer.h"
 
 namespace alexaClientSDK {
@@ -33,13 +36,66 @@ LogEntryBuffer::int_type LogEntryBuffer::overflow(int_type ch) {
         return traits_type::eof();
     }
 
+    grow(1);
+
+    *pptr() = ch;
+    pbump(1);
+    return ch;
+}
+
+std::streamsize LogEntryBuffer::xsputn(const char_type* s, std::streamsize count) {
+    if (count <= 0) {
+        return 0;
+    }
+    auto size = static_cast<size_t>(count);
+    if (static_cast<size_t>(epptr() - pptr()) < size) {
+        grow(size);
+    }
+    memcpy(pptr(), s, size);
+    // pbump() takes an int, so advance in steps in case count does not fit.
+    while (size > 0) {
+        auto step = std::min(size, static_cast<size_t>(std::numeric_limits<int>::max()));
+        pbump(static_cast<int>(step));
+        size -= step;
+    }
+    return count;
+}
+
+char* LogEntryBuffer::reserve(size_t count) {
+    if (static_cast<size_t>(epptr() - pptr()) < count) {
+        grow(count);
+    }
+    return pptr();
+}
+
+void LogEntryBuffer::commit(size_t count) {
+    pbump(static_cast<int>(count));
+}
+
+size_t LogEntryBuffer::size() const {
+    return static_cast<size_t>(pptr() - m_base);
+}
+
+void LogEntryBuffer::truncate(size_t size) {
+    setp(m_base, epptr());
+    // pbump() takes an int, so advance in steps in case size does not fit.
+    while (size > 0) {
+        auto step = std::min(size, static_cast<size_t>(std::numeric_limits<int>::max()));
+        pbump(static_cast<int>(step));
+        size -= step;
+    }
+}
+
+void LogEntryBuffer::grow(size_t count) {
     auto size = pptr() - m_base;
+    auto requiredSize = size + count + 1;
 
     if (!m_largeBuffer) {
-        m_largeBuffer.reset(new std::vector<char>(ACSDK_LOG_ENTRY_BUFFER_SMALL_BUFFER_SIZE * 2));
+        m_largeBuffer.reset(new std::vector<char>(
+            std::max(requiredSize, static_cast<size_t>(ACSDK_LOG_ENTRY_BUFFER_SMALL_BUFFER_SIZE * 2))));
         memcpy(m_largeBuffer->data(), m_base, size);
     } else {
-        m_largeBuffer->resize(m_largeBuffer->size() * 2);
+        m_largeBuffer->resize(std::max(requiredSize, m_largeBuffer->size() * 2));
     }
 
     auto newBase = m_largeBuffer->data();
@@ -49,10 +105,6 @@ LogEntryBuffer::int_type LogEntryBuffer::overflow(int_type ch) {
     setp(newBase + size, newEnd);
     setg(newBase, gptr() + delta, newEnd);
     m_base = newBase;
-
-    *pptr() = ch;
-    pbump(1);
-    return ch;
 }
 
 const char* LogEntryBuffer::c_str() const {
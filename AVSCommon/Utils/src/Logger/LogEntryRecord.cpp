@@ -0,0 +1,531 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/HexDump.h"
+#include "AVSCommon/Utils/Logger/LogEntryRecord.h"
+#include "AVSCommon/Utils/Logger/MetadataEscaping.h"
+#include "AVSCommon/Utils/Logger/NumberFormatting.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Marker for a string reference that is null.
+static const uint8_t STRING_NULL = 0;
+
+/// Marker for a string reference that is stored as a pointer to a null terminated string.
+static const uint8_t STRING_POINTER = 1;
+
+/// Marker for a string reference that is stored inline as a length followed by the characters.
+static const uint8_t STRING_INLINE = 2;
+
+/// Number of characters escaped at a time before writing them to the output.
+static const size_t ESCAPE_BLOCK_SIZE = 256;
+
+/// Reserved in metadata sequences to separate key,value pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Reserved in metadata sequences to separate them from a preceding event and an optional terminal message.
+static const char SECTION_SEPARATOR = ':';
+
+/// Character used to separate key from value text in metadata.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+LogEntryRecord::Reader::Reader(const char* data, size_t size) :
+        m_position{data},
+        m_end{data + size},
+        m_source{""},
+        m_sourceLength{0},
+        m_event{""},
+        m_eventLength{0} {
+    if (size > 0) {
+        m_source = readString(&m_sourceLength);
+        m_event = readString(&m_eventLength);
+    }
+}
+
+const char* LogEntryRecord::Reader::source(size_t* length) const {
+    *length = m_sourceLength;
+    return m_source;
+}
+
+const char* LogEntryRecord::Reader::event(size_t* length) const {
+    *length = m_eventLength;
+    return m_event;
+}
+
+bool LogEntryRecord::Reader::next(Field* field) {
+    if (m_position >= m_end) {
+        return false;
+    }
+    field->type = static_cast<FieldType>(read<uint8_t>());
+    if (FieldType::MESSAGE == field->type) {
+        field->key = "";
+        field->keyLength = 0;
+    } else {
+        field->key = readString(&field->keyLength);
+    }
+    switch (field->type) {
+        case FieldType::INT64:
+            field->int64Value = read<int64_t>();
+            break;
+        case FieldType::UINT64:
+            field->uint64Value = read<uint64_t>();
+            break;
+        case FieldType::DOUBLE:
+            field->doubleValue = read<double>();
+            break;
+        case FieldType::FLOAT:
+            field->floatValue = read<float>();
+            break;
+        case FieldType::POINTER:
+            field->pointerValue = read<const void*>();
+            break;
+        case FieldType::STRING:
+        case FieldType::TEXT:
+        case FieldType::MESSAGE:
+            field->text = readString(&field->textLength);
+            break;
+        case FieldType::BYTES:
+            field->rowWidth = read<uint32_t>();
+            field->text = readString(&field->textLength);
+            break;
+    }
+    return true;
+}
+
+const char* LogEntryRecord::Reader::readString(size_t* length) {
+    switch (read<uint8_t>()) {
+        case STRING_POINTER: {
+            auto value = read<const char*>();
+            *length = strlen(value);
+            return value;
+        }
+        case STRING_INLINE: {
+            *length = read<uint32_t>();
+            auto value = m_position;
+            m_position += *length;
+            return value;
+        }
+        default:
+            *length = 0;
+            return "";
+    }
+}
+
+template <typename Type>
+Type LogEntryRecord::Reader::read() {
+    // Values are not aligned within the record, so copy them out rather than dereferencing them in place.
+    Type value;
+    memcpy(&value, m_position, sizeof(value));
+    m_position += sizeof(value);
+    return value;
+}
+
+LogEntryRecord::LogEntryRecord() : m_base{m_smallBuffer}, m_size{0}, m_capacity{sizeof(m_smallBuffer)} {
+}
+
+void LogEntryRecord::start(const std::string& source, const char* event) {
+    appendString(source.c_str(), true);
+    appendString(event, false);
+}
+
+void LogEntryRecord::start(const std::string& source, const std::string& event) {
+    appendString(source.c_str(), true);
+    appendString(event.c_str(), true);
+}
+
+void LogEntryRecord::beginField(FieldType type, const char* key, bool copyKey) {
+    auto typeByte = static_cast<uint8_t>(type);
+    append(&typeByte, sizeof(typeByte));
+    appendString(key, copyKey);
+}
+
+void LogEntryRecord::appendInt64(int64_t value) {
+    append(&value, sizeof(value));
+}
+
+void LogEntryRecord::appendUint64(uint64_t value) {
+    append(&value, sizeof(value));
+}
+
+void LogEntryRecord::appendDouble(double value) {
+    append(&value, sizeof(value));
+}
+
+void LogEntryRecord::appendFloat(float value) {
+    append(&value, sizeof(value));
+}
+
+void LogEntryRecord::appendPointer(const void* value) {
+    append(&value, sizeof(value));
+}
+
+void LogEntryRecord::appendText(const char* value, size_t length) {
+    auto marker = STRING_INLINE;
+    auto length32 = static_cast<uint32_t>(length);
+    append(&marker, sizeof(marker));
+    append(&length32, sizeof(length32));
+    append(value, length32);
+}
+
+void LogEntryRecord::addMessage(const char* message, size_t length) {
+    auto typeByte = static_cast<uint8_t>(FieldType::MESSAGE);
+    append(&typeByte, sizeof(typeByte));
+    appendText(message, length);
+}
+
+void LogEntryRecord::appendBytes(const void* data, size_t size, size_t rowWidth) {
+    auto rowWidth32 = static_cast<uint32_t>(rowWidth);
+    append(&rowWidth32, sizeof(rowWidth32));
+    appendText(static_cast<const char*>(data), size);
+}
+
+const char* LogEntryRecord::data() const {
+    return m_base;
+}
+
+size_t LogEntryRecord::size() const {
+    return m_size;
+}
+
+void LogEntryRecord::append(const void* bytes, size_t count) {
+    auto newSize = m_size + count;
+    if (newSize > m_capacity) {
+        if (!m_largeBuffer) {
+            m_largeBuffer.reset(new std::vector<char>(m_smallBuffer, m_smallBuffer + m_size));
+        }
+        m_largeBuffer->resize(std::max(newSize, m_capacity * 2));
+        m_base = m_largeBuffer->data();
+        m_capacity = m_largeBuffer->size();
+    }
+    memcpy(m_base + m_size, bytes, count);
+    m_size = newSize;
+}
+
+void LogEntryRecord::appendString(const char* value, bool copy) {
+    if (!value) {
+        append(&STRING_NULL, sizeof(STRING_NULL));
+    } else if (copy) {
+        appendText(value, strlen(value));
+    } else {
+        append(&STRING_POINTER, sizeof(STRING_POINTER));
+        append(&value, sizeof(value));
+    }
+}
+
+/// Adapter used by @c renderRecord() to append rendered text to a @c std::string.
+class StringOutput {
+public:
+    /**
+     * Constructor.
+     *
+     * @param out The string to append to.
+     */
+    StringOutput(std::string* out) : m_out{out} {
+    }
+
+    /**
+     * Append characters.
+     *
+     * @param text The characters to append.
+     * @param length The number of characters to append.
+     */
+    void write(const char* text, size_t length) {
+        m_out->append(text, length);
+    }
+
+    /**
+     * Append a single character.
+     *
+     * @param c The character to append.
+     */
+    void put(char c) {
+        m_out->push_back(c);
+    }
+
+private:
+    /// The string to append to.
+    std::string* m_out;
+};
+
+/// Adapter used by @c renderRecord() to write rendered text to a @c std::ostream.
+class StreamOutput {
+public:
+    /**
+     * Constructor.
+     *
+     * @param stream The stream to write to.
+     */
+    StreamOutput(std::ostream& stream) : m_stream(stream) {
+    }
+
+    /**
+     * Write characters.
+     *
+     * @param text The characters to write.
+     * @param length The number of characters to write.
+     */
+    void write(const char* text, size_t length) {
+        m_stream.write(text, length);
+    }
+
+    /**
+     * Write a single character.
+     *
+     * @param c The character to write.
+     */
+    void put(char c) {
+        m_stream.put(c);
+    }
+
+private:
+    /// The stream to write to.
+    std::ostream& m_stream;
+};
+
+/**
+ * Write a string reference that holds a copy of the string.
+ *
+ * @tparam Output The type of output to write to.
+ * @param output The output to write to.
+ * @param text The string.
+ * @param length The length of @c text.
+ */
+template <typename Output>
+static void writeInlineString(Output& output, const char* text, size_t length) {
+    auto length32 = static_cast<uint32_t>(length);
+    output.put(static_cast<char>(STRING_INLINE));
+    output.write(reinterpret_cast<const char*>(&length32), sizeof(length32));
+    output.write(text, length32);
+}
+
+/**
+ * Write the bytes of a value.
+ *
+ * @tparam Output The type of output to write to.
+ * @tparam Type The type of the value.
+ * @param output The output to write to.
+ * @param value The value.
+ */
+template <typename Output, typename Type>
+static void writeValue(Output& output, const Type& value) {
+    output.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Write a string, escaping the characters that are reserved in metadata sequences.
+ *
+ * @tparam Output The type of output to write to.
+ * @param output The output to write to.
+ * @param text The string to write.
+ * @param length The length of @c text.
+ */
+template <typename Output>
+static void writeEscaped(Output& output, const char* text, size_t length) {
+    char escaped[2 * ESCAPE_BLOCK_SIZE];
+    while (length > 0) {
+        auto blockSize = std::min(length, ESCAPE_BLOCK_SIZE);
+        output.write(escaped, escapeMetadata(text, blockSize, escaped));
+        text += blockSize;
+        length -= blockSize;
+    }
+}
+
+/**
+ * Render the hex dumps of the @c BYTES fields of a serialized record, each row on a line of its own.
+ *
+ * @tparam Output The type of output to write to.
+ * @param data The bytes of the record.
+ * @param size The number of bytes in @c data.
+ * @param output The output to write to.
+ */
+template <typename Output>
+static void renderRecordDumps(const char* data, size_t size, Output& output) {
+    // Reused by each thread so that rendering does not allocate once the buffers have grown.
+    static thread_local std::string prefix;
+    static thread_local std::string dump;
+    LogEntryRecord::Reader reader(data, size);
+    LogEntryRecord::Field field;
+    while (reader.next(&field)) {
+        if (LogEntryRecord::FieldType::BYTES != field.type || 0 == field.textLength) {
+            continue;
+        }
+        prefix.assign(field.key, field.keyLength);
+        prefix.push_back(' ');
+        dump.clear();
+        appendHexDump(
+            prefix.c_str(),
+            field.rowWidth,
+            reinterpret_cast<const unsigned char*>(field.text),
+            field.textLength,
+            &dump);
+        // Move each row's newline to its start, so that the entry does not end with one.
+        output.put('\n');
+        output.write(dump.data(), dump.size() - 1);
+    }
+}
+
+/**
+ * Render a serialized record in the format used by @c LogEntry.
+ *
+ * @tparam Output The type of output to write to.
+ * @param data The bytes of the record.
+ * @param size The number of bytes in @c data.
+ * @param output The output to write to.
+ */
+template <typename Output>
+static void renderRecord(const char* data, size_t size, Output& output) {
+    LogEntryRecord::Reader reader(data, size);
+    size_t length;
+    auto text = reader.source(&length);
+    output.write(text, length);
+    output.put(SECTION_SEPARATOR);
+    text = reader.event(&length);
+    output.write(text, length);
+
+    bool hasMetadata = false;
+    bool hasDumps = false;
+    const char* message = nullptr;
+    size_t messageLength = 0;
+    char number[MAX_FORMATTED_NUMBER_SIZE];
+    LogEntryRecord::Field field;
+    while (reader.next(&field)) {
+        if (LogEntryRecord::FieldType::MESSAGE == field.type) {
+            // Rendered after all of the metadata, which LogEntry::insertBeforeMessage() may add after the message.
+            message = field.text;
+            messageLength = field.textLength;
+            continue;
+        }
+        output.put(hasMetadata ? PAIR_SEPARATOR : SECTION_SEPARATOR);
+        hasMetadata = true;
+        output.write(field.key, field.keyLength);
+        output.put(KEY_VALUE_SEPARATOR);
+        size_t count = 0;
+        switch (field.type) {
+            case LogEntryRecord::FieldType::INT64:
+                count = formatInt64(field.int64Value, number);
+                break;
+            case LogEntryRecord::FieldType::UINT64:
+                count = formatUint64(field.uint64Value, number);
+                break;
+            case LogEntryRecord::FieldType::DOUBLE:
+                count = formatDouble(field.doubleValue, number);
+                break;
+            case LogEntryRecord::FieldType::FLOAT:
+                count = formatFloat(field.floatValue, number);
+                break;
+            case LogEntryRecord::FieldType::POINTER:
+                count = formatPointer(field.pointerValue, number);
+                break;
+            case LogEntryRecord::FieldType::STRING:
+                writeEscaped(output, field.text, field.textLength);
+                break;
+            case LogEntryRecord::FieldType::TEXT:
+                output.write(field.text, field.textLength);
+                break;
+            case LogEntryRecord::FieldType::MESSAGE:
+                break;
+            case LogEntryRecord::FieldType::BYTES:
+                count = formatUint64(field.textLength, number);
+                hasDumps = true;
+                break;
+        }
+        if (count > 0) {
+            output.write(number, count);
+        }
+    }
+    if (message) {
+        if (!hasMetadata) {
+            output.put(SECTION_SEPARATOR);
+        }
+        output.put(SECTION_SEPARATOR);
+        output.write(message, messageLength);
+    }
+    if (hasDumps) {
+        renderRecordDumps(data, size, output);
+    }
+}
+
+void LogEntryRecord::copyDetached(const char* data, size_t size, std::string* out) {
+    if (0 == size) {
+        return;
+    }
+    StringOutput output(out);
+    Reader reader(data, size);
+    size_t length;
+    auto text = reader.source(&length);
+    writeInlineString(output, text, length);
+    text = reader.event(&length);
+    writeInlineString(output, text, length);
+
+    Field field;
+    while (reader.next(&field)) {
+        output.put(static_cast<char>(field.type));
+        if (FieldType::MESSAGE != field.type) {
+            writeInlineString(output, field.key, field.keyLength);
+        }
+        switch (field.type) {
+            case FieldType::INT64:
+                writeValue(output, field.int64Value);
+                break;
+            case FieldType::UINT64:
+                writeValue(output, field.uint64Value);
+                break;
+            case FieldType::DOUBLE:
+                writeValue(output, field.doubleValue);
+                break;
+            case FieldType::FLOAT:
+                writeValue(output, field.floatValue);
+                break;
+            case FieldType::POINTER:
+                writeValue(output, field.pointerValue);
+                break;
+            case FieldType::STRING:
+            case FieldType::TEXT:
+            case FieldType::MESSAGE:
+                writeInlineString(output, field.text, field.textLength);
+                break;
+            case FieldType::BYTES:
+                writeValue(output, static_cast<uint32_t>(field.rowWidth));
+                writeInlineString(output, field.text, field.textLength);
+                break;
+        }
+    }
+}
+
+void LogEntryRecord::render(const char* data, size_t size, std::string* out) {
+    StringOutput output(out);
+    renderRecord(data, size, output);
+}
+
+void LogEntryRecord::render(const char* data, size_t size, std::ostream& stream) {
+    StreamOutput output(stream);
+    renderRecord(data, size, output);
+}
+
+void LogEntryRecord::renderDumps(const char* data, size_t size, std::ostream& stream) {
+    StreamOutput output(stream);
+    renderRecordDumps(data, size, output);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,509 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include "AVSCommon/Utils/Logger/LogFileScanner.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// The size that blocks are split at, before being moved to the start of the next entry.
+static const size_t BLOCK_SIZE = 1024 * 1024;
+
+/// Suffix of the path of the sidecar index.
+static const std::string INDEX_SUFFIX = ".idx";
+
+/// Suffix of the path the sidecar index is written to before it is renamed in to place.
+static const std::string TEMPORARY_INDEX_SUFFIX = ".idx.tmp";
+
+/// Identifies a sidecar index file.
+static const char INDEX_MAGIC[8] = {'A', 'C', 'S', 'D', 'K', 'L', 'I', 'X'};
+
+/// Version of the sidecar index format.
+static const uint32_t INDEX_VERSION = 1;
+
+/// Number of bits of a block's Bloom filter set for each source, event and key.
+static const int BLOOM_HASH_COUNT = 3;
+
+/// Tag of a source in the Bloom filter.
+static const char BLOOM_TAG_SOURCE = 's';
+
+/// Tag of an event in the Bloom filter.
+static const char BLOOM_TAG_EVENT = 'e';
+
+/// Tag of a key in the Bloom filter.
+static const char BLOOM_TAG_KEY = 'k';
+
+/// The header of the sidecar index, which is followed by the blocks.  Written in the byte order of the machine.
+struct IndexHeader {
+    /// @c INDEX_MAGIC.
+    char magic[8];
+
+    /// @c INDEX_VERSION.
+    uint32_t version;
+
+    /// @c BLOCK_SIZE when the index was written.
+    uint32_t blockSize;
+
+    /// The size of the log file when the index was written.
+    uint64_t fileSize;
+
+    /// The modification time of the log file when the index was written, in nanoseconds since the epoch.
+    int64_t modifiedTime;
+
+    /// The number of blocks.
+    uint64_t blockCount;
+};
+
+/**
+ * Hash a source, event or key for the Bloom filter, with FNV-1a.
+ *
+ * @param tag What kind of name is being hashed, so that e.g. a source and a key with the same name differ.
+ * @param name The name.
+ * @param length The length of @c name.
+ * @return The hash.
+ */
+static uint64_t bloomHash(char tag, const char* name, size_t length) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = (hash ^ static_cast<unsigned char>(tag)) * 0x100000001b3ULL;
+    for (size_t ix = 0; ix < length; ix++) {
+        hash = (hash ^ static_cast<unsigned char>(name[ix])) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * Run a function for each bit of a Bloom filter that a hash sets.
+ *
+ * @param hash The hash.
+ * @param bitCount The number of bits in the filter.
+ * @param function The function, called with the word and the mask of each bit.
+ * @return Whether @c function returned true for every bit.
+ */
+template <typename Function>
+static bool forEachBloomBit(uint64_t hash, size_t bitCount, Function function) {
+    auto first = static_cast<uint32_t>(hash);
+    auto step = static_cast<uint32_t>(hash >> 32) | 1;
+    for (int ix = 0; ix < BLOOM_HASH_COUNT; ix++) {
+        auto bit = (first + ix * step) % bitCount;
+        if (!function(bit / 64, 1ULL << (bit % 64))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Check whether a filter selects every entry, including lines that are not log lines.
+ *
+ * @param filter The filter.
+ * @return Whether @c filter selects every entry.
+ */
+static bool selectsAll(const LogFilter& filter) {
+    return filter.sources.empty() && filter.events.empty() && filter.keys.empty() &&
+           std::numeric_limits<int64_t>::min() == filter.from && std::numeric_limits<int64_t>::max() == filter.to;
+}
+
+/**
+ * Check whether a span holds any of a list of names.
+ *
+ * @param span The span.
+ * @param names The names.
+ * @return Whether @c span holds one of @c names.
+ */
+static bool isAnyOf(const LogSpan& span, const std::vector<std::string>& names) {
+    for (auto& name : names) {
+        if (span == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Check whether the metadata of a line has a key, and optionally a value for it.
+ *
+ * @param metadata The metadata of the line.
+ * @param keyFilter The key and value to look for.
+ * @return Whether @c metadata has the key, with the value if one is given.
+ */
+static bool hasKey(const LogSpan& metadata, const LogFilter::KeyFilter& keyFilter) {
+    // Reused by each thread, to unescape values without allocating.
+    static thread_local std::string unescaped;
+    LogMetadataTokenizer tokenizer(metadata);
+    LogSpan key, value;
+    while (tokenizer.next(&key, &value)) {
+        if (!(key == keyFilter.key)) {
+            continue;
+        }
+        if (!keyFilter.hasValue) {
+            return true;
+        }
+        if (!memchr(value.data, '\\', value.size)) {
+            if (value == keyFilter.value) {
+                return true;
+            }
+            continue;
+        }
+        unescapeLogValue(value, &unescaped);
+        if (unescaped == keyFilter.value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Run a function for each entry of a block: a line, along with any following lines that do not start with a date and
+ * time.
+ *
+ * @param begin The start of the block, which is the start of an entry.
+ * @param end The end of the block.
+ * @param fileEnd The end of the file.
+ * @param function The function, called with the start of the entry, the end of its first line and its end.
+ */
+template <typename Function>
+static void forEachEntry(const char* begin, const char* end, const char* fileEnd, Function function) {
+    auto position = begin;
+    while (position < end) {
+        auto lineEnd = static_cast<const char*>(memchr(position, '\n', end - position));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+        auto entryEnd = lineEnd;
+        while (entryEnd + 1 < end && !isLogLineStart(entryEnd + 1, fileEnd - (entryEnd + 1))) {
+            auto next = entryEnd + 1;
+            entryEnd = static_cast<const char*>(memchr(next, '\n', end - next));
+            if (!entryEnd) {
+                entryEnd = end;
+            }
+        }
+        function(position, lineEnd, entryEnd);
+        position = entryEnd + 1;
+    }
+}
+
+LogFilter::LogFilter() : from{std::numeric_limits<int64_t>::min()}, to{std::numeric_limits<int64_t>::max()} {
+}
+
+bool LogFilter::matches(const ParsedLogLine& line) const {
+    if (line.time < from || line.time >= to) {
+        return false;
+    }
+    if (!sources.empty() && !isAnyOf(line.source, sources)) {
+        return false;
+    }
+    if (!events.empty() && !isAnyOf(line.event, events)) {
+        return false;
+    }
+    for (auto& keyFilter : keys) {
+        if (!hasKey(line.metadata, keyFilter)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<LogFileScanner> LogFileScanner::open(const std::string& path, std::string* error) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        *error = std::string("open: ") + strerror(errno);
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        *error = std::string("fstat: ") + strerror(errno);
+        close(fd);
+        return nullptr;
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    const char* data = nullptr;
+    if (size > 0) {
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == mapping) {
+            *error = std::string("mmap: ") + strerror(errno);
+            close(fd);
+            return nullptr;
+        }
+        // Each thread reads its blocks from start to end, so have the kernel read ahead.
+        madvise(mapping, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(mapping);
+    }
+    // The mapping keeps the file open.
+    close(fd);
+    auto modifiedTime = static_cast<int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+    return std::unique_ptr<LogFileScanner>(new LogFileScanner(path, data, size, modifiedTime));
+}
+
+LogFileScanner::LogFileScanner(const std::string& path, const char* data, size_t size, int64_t modifiedTime) :
+        m_path{path},
+        m_data{data},
+        m_size{size},
+        m_modifiedTime{modifiedTime},
+        m_hasIndex{false} {
+    splitBlocks();
+}
+
+LogFileScanner::~LogFileScanner() {
+    if (m_data) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+}
+
+void LogFileScanner::splitBlocks() {
+    auto fileEnd = m_data + m_size;
+    size_t offset = 0;
+    while (offset < m_size) {
+        size_t end = m_size;
+        if (m_size - offset > BLOCK_SIZE) {
+            // Move the end of the block on to the start of the next entry, so that no entry is split.
+            auto position = m_data + offset + BLOCK_SIZE;
+            while (position < fileEnd) {
+                auto newline = static_cast<const char*>(memchr(position, '\n', fileEnd - position));
+                if (!newline) {
+                    position = fileEnd;
+                    break;
+                }
+                position = newline + 1;
+                if (isLogLineStart(position, fileEnd - position)) {
+                    break;
+                }
+            }
+            end = position - m_data;
+        }
+        Block block;
+        memset(&block, 0, sizeof(block));
+        block.offset = offset;
+        block.size = end - offset;
+        m_blocks.push_back(block);
+        offset = end;
+    }
+}
+
+template <typename Function>
+void LogFileScanner::forEachBlock(size_t threadCount, Function function) const {
+    if (0 == threadCount) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = std::min(threadCount, m_blocks.size());
+    std::atomic<size_t> nextBlock{0};
+    auto worker = [this, &nextBlock, &function] {
+        for (size_t ix = nextBlock++; ix < m_blocks.size(); ix = nextBlock++) {
+            function(ix);
+        }
+    };
+    if (threadCount <= 1) {
+        worker();
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (size_t ix = 1; ix < threadCount; ix++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void LogFileScanner::summarize(Block* block) const {
+    static const size_t bitCount = BLOOM_WORDS * 64;
+    block->minTime = std::numeric_limits<int64_t>::max();
+    block->maxTime = std::numeric_limits<int64_t>::min();
+    memset(block->bloom, 0, sizeof(block->bloom));
+    auto add = [block](uint64_t hash) {
+        forEachBloomBit(hash, bitCount, [block](size_t word, uint64_t mask) {
+            block->bloom[word] |= mask;
+            return true;
+        });
+    };
+    auto onEntry = [&](const char* entry, const char* lineEnd, const char*) {
+        ParsedLogLine line;
+        if (!parseLogLine(entry, lineEnd - entry, &line)) {
+            return;
+        }
+        block->minTime = std::min(block->minTime, line.time);
+        block->maxTime = std::max(block->maxTime, line.time);
+        add(bloomHash(BLOOM_TAG_SOURCE, line.source.data, line.source.size));
+        add(bloomHash(BLOOM_TAG_EVENT, line.event.data, line.event.size));
+        LogMetadataTokenizer tokenizer(line.metadata);
+        LogSpan key, value;
+        while (tokenizer.next(&key, &value)) {
+            add(bloomHash(BLOOM_TAG_KEY, key.data, key.size));
+        }
+    };
+    auto begin = m_data + block->offset;
+    forEachEntry(begin, begin + block->size, m_data + m_size, onEntry);
+}
+
+bool LogFileScanner::canSkip(const Block& block, const LogFilter& filter) const {
+    static const size_t bitCount = BLOOM_WORDS * 64;
+    if (!m_hasIndex || selectsAll(filter)) {
+        return false;
+    }
+    // A block without log lines has nothing but lines that only a filter that selects everything selects.
+    if (block.minTime > block.maxTime || filter.from > block.maxTime || filter.to <= block.minTime) {
+        return true;
+    }
+    auto mayHave = [&block](char tag, const std::string& name) {
+        auto hash = bloomHash(tag, name.data(), name.size());
+        return forEachBloomBit(
+            hash, bitCount, [&block](size_t word, uint64_t mask) { return 0 != (block.bloom[word] & mask); });
+    };
+    auto mayHaveAnyOf = [&mayHave](char tag, const std::vector<std::string>& names) {
+        for (auto& name : names) {
+            if (mayHave(tag, name)) {
+                return true;
+            }
+        }
+        return names.empty();
+    };
+    if (!mayHaveAnyOf(BLOOM_TAG_SOURCE, filter.sources) || !mayHaveAnyOf(BLOOM_TAG_EVENT, filter.events)) {
+        return true;
+    }
+    for (auto& keyFilter : filter.keys) {
+        if (!mayHave(BLOOM_TAG_KEY, keyFilter.key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LogFileScanner::loadIndex(std::string* error) {
+    auto indexPath = m_path + INDEX_SUFFIX;
+    auto file = fopen(indexPath.c_str(), "rb");
+    if (!file) {
+        *error = indexPath + ": " + strerror(errno);
+        return false;
+    }
+    IndexHeader header;
+    std::vector<Block> blocks;
+    bool valid = 1 == fread(&header, sizeof(header), 1, file) && 0 == memcmp(header.magic, INDEX_MAGIC, 8) &&
+                 INDEX_VERSION == header.version;
+    if (!valid) {
+        *error = indexPath + ": not an index";
+    } else if (header.fileSize != m_size || header.modifiedTime != m_modifiedTime || header.blockSize != BLOCK_SIZE) {
+        *error = indexPath + ": stale, the log file has changed since it was written";
+        valid = false;
+    } else {
+        // Each block holds at least one byte of the file.
+        blocks.resize(std::min<uint64_t>(header.blockCount, m_size));
+        valid = header.blockCount == blocks.size() &&
+                blocks.size() == fread(blocks.data(), sizeof(Block), blocks.size(), file);
+        uint64_t offset = 0;
+        for (size_t ix = 0; valid && ix < blocks.size(); ix++) {
+            valid = blocks[ix].offset == offset && blocks[ix].size > 0;
+            offset += blocks[ix].size;
+        }
+        valid = valid && offset == m_size;
+        if (!valid) {
+            *error = indexPath + ": corrupt";
+        }
+    }
+    fclose(file);
+    if (!valid) {
+        return false;
+    }
+    m_blocks.swap(blocks);
+    m_hasIndex = true;
+    return true;
+}
+
+bool LogFileScanner::writeIndex(size_t threadCount, std::string* error) {
+    forEachBlock(threadCount, [this](size_t ix) { summarize(&m_blocks[ix]); });
+    m_hasIndex = true;
+
+    // Write to a temporary file and rename it in to place, so that readers never see a partial index.
+    auto temporaryPath = m_path + TEMPORARY_INDEX_SUFFIX;
+    auto file = fopen(temporaryPath.c_str(), "wb");
+    if (!file) {
+        *error = temporaryPath + ": " + strerror(errno);
+        return false;
+    }
+    IndexHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    header.version = INDEX_VERSION;
+    header.blockSize = BLOCK_SIZE;
+    header.fileSize = m_size;
+    header.modifiedTime = m_modifiedTime;
+    header.blockCount = m_blocks.size();
+    bool written = 1 == fwrite(&header, sizeof(header), 1, file) &&
+                   m_blocks.size() == fwrite(m_blocks.data(), sizeof(Block), m_blocks.size(), file);
+    written = 0 == fclose(file) && written;
+    auto indexPath = m_path + INDEX_SUFFIX;
+    if (!written || rename(temporaryPath.c_str(), indexPath.c_str()) != 0) {
+        *error = indexPath + ": " + strerror(errno);
+        unlink(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+size_t LogFileScanner::scan(const LogFilter& filter, size_t threadCount, std::vector<LogSpan>* matches) const {
+    bool selectAll = selectsAll(filter);
+    std::vector<std::vector<LogSpan>> blockMatches(m_blocks.size());
+    std::atomic<size_t> skippedCount{0};
+    forEachBlock(threadCount, [&](size_t ix) {
+        auto& block = m_blocks[ix];
+        if (canSkip(block, filter)) {
+            ++skippedCount;
+            return;
+        }
+        auto& found = blockMatches[ix];
+        auto begin = m_data + block.offset;
+        auto onEntry = [&](const char* entry, const char* lineEnd, const char* end) {
+            ParsedLogLine line;
+            if (selectAll || (parseLogLine(entry, lineEnd - entry, &line) && filter.matches(line))) {
+                found.push_back({entry, static_cast<size_t>(end - entry)});
+            }
+        };
+        forEachEntry(begin, begin + block.size, m_data + m_size, onEntry);
+    });
+
+    matches->clear();
+    size_t total = 0;
+    for (auto& found : blockMatches) {
+        total += found.size();
+    }
+    matches->reserve(total);
+    for (auto& found : blockMatches) {
+        matches->insert(matches->end(), found.begin(), found.end());
+    }
+    return skippedCount;
+}
+
+size_t LogFileScanner::getBlockCount() const {
+    return m_blocks.size();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
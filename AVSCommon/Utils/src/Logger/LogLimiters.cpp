@@ -0,0 +1,204 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <unistd.h>
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogLimiters.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LogLimiter");
+
+/// How often the background thread looks at the counts of the registered limiters.
+static const std::chrono::seconds SUMMARY_INTERVAL(1);
+
+/**
+ * The background thread that logs the counts of limiters whose call sites have stopped logging.
+ */
+class LogLimiterSummarizer {
+public:
+    /**
+     * Get the summarizer.  Never destroyed, so that it can be stopped by @c atexit() handlers.
+     *
+     * @return The summarizer.
+     */
+    static LogLimiterSummarizer& instance();
+
+    /**
+     * Add a limiter, starting the thread if needed.  Ignored once the summarizer has been stopped.
+     *
+     * @param limiter The limiter to add.
+     */
+    void add(LogLimiter* limiter);
+
+    /// Stop the thread and log the counts of all the limiters.  Does nothing after the first call.
+    void stop();
+
+private:
+    /// Constructor.
+    LogLimiterSummarizer();
+
+    /// The loop run by @c m_thread.
+    void summaryLoop();
+
+    /**
+     * Log the counts of the limiters.
+     *
+     * @param lock The lock on @c m_mutex, which is released while logging.
+     * @param isFinal Whether to log every non-zero count, rather than just those that have not changed.
+     */
+    void summarizeLocked(std::unique_lock<std::mutex>& lock, bool isFinal);
+
+    /**
+     * Log the count of a limiter.
+     *
+     * @param limiter The limiter.
+     * @param count The number of entries it suppressed.
+     */
+    static void logSummary(const LogLimiter& limiter, uint64_t count);
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Used to wake @c m_thread when the summarizer is stopped.
+    std::condition_variable m_wakeCondition;
+
+    /// The registered limiters.  Limiters are static, so are never removed.
+    std::vector<LogLimiter*> m_limiters;
+
+    /// Whether @c stop() has been called.
+    bool m_isStopped;
+
+    /// The process that started @c m_thread.  The thread does not exist in a child process.
+    pid_t m_threadPid;
+
+    /// The thread that logs the counts.
+    std::thread m_thread;
+};
+
+/// Stops the summarizer at exit, before the @c Logger of any registered call site is destroyed.
+static void stopSummarizer() {
+    LogLimiterSummarizer::instance().stop();
+}
+
+LogLimiterSummarizer& LogLimiterSummarizer::instance() {
+    static auto summarizer = new LogLimiterSummarizer();
+    return *summarizer;
+}
+
+LogLimiterSummarizer::LogLimiterSummarizer() : m_isStopped{false}, m_threadPid{0} {
+}
+
+void LogLimiterSummarizer::add(LogLimiter* limiter) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isStopped) {
+        return;
+    }
+    m_limiters.push_back(limiter);
+    if (0 == m_threadPid) {
+        m_threadPid = getpid();
+        m_thread = std::thread(&LogLimiterSummarizer::summaryLoop, this);
+    }
+    /*
+     * Registered for each limiter rather than once, because handlers run in reverse order of registration, and the
+     * Logger of this call site may have been constructed after the Logger of the first one was.
+     */
+    atexit(stopSummarizer);
+}
+
+void LogLimiterSummarizer::stop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_isStopped) {
+        return;
+    }
+    m_isStopped = true;
+    if (m_threadPid != getpid()) {
+        // A child process forked after the thread was started.  Leave the counts to the parent.
+        return;
+    }
+    m_wakeCondition.notify_all();
+    lock.unlock();
+    m_thread.join();
+    lock.lock();
+    summarizeLocked(lock, true);
+}
+
+void LogLimiterSummarizer::summaryLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_wakeCondition.wait_for(lock, SUMMARY_INTERVAL, [this] { return m_isStopped; })) {
+        summarizeLocked(lock, false);
+    }
+}
+
+void LogLimiterSummarizer::summarizeLocked(std::unique_lock<std::mutex>& lock, bool isFinal) {
+    // Limiters are only ever appended, so iterate by index in case one is added while the lock is released.
+    for (size_t ix = 0; ix < m_limiters.size(); ix++) {
+        auto limiter = m_limiters[ix];
+        auto count = limiter->m_suppressed.load(std::memory_order_relaxed);
+        auto lastCount = limiter->m_lastSuppressed;
+        limiter->m_lastSuppressed = count;
+        if (0 == count || (count != lastCount && !isFinal)) {
+            continue;
+        }
+        // Fails if the call site let an entry through in the meantime, which then took the count with it.
+        if (!limiter->m_suppressed.compare_exchange_strong(count, 0, std::memory_order_relaxed)) {
+            continue;
+        }
+        limiter->m_lastSuppressed = 0;
+        lock.unlock();
+        logSummary(*limiter, count);
+        lock.lock();
+    }
+}
+
+void LogLimiterSummarizer::logSummary(const LogLimiter& limiter, uint64_t count) {
+    if (limiter.m_logger->shouldLog(limiter.m_level)) {
+        limiter.m_logger->log(
+            limiter.m_level,
+            LogEntry(TAG, "entriesSuppressed")
+                .d("file", limiter.m_file)
+                .d("line", limiter.m_line)
+                .d("suppressed", count));
+    }
+}
+
+void LogLimiter::registerForSummary(Logger& logger, Level level, const char* file, int line) {
+    bool isRegistered = false;
+    if (!m_isRegistered.compare_exchange_strong(isRegistered, true)) {
+        return;
+    }
+    m_logger = &logger;
+    m_level = level;
+    m_file = file;
+    m_line = line;
+    // The summarizer's mutex orders these writes before its thread reads them.
+    LogLimiterSummarizer::instance().add(this);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,335 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/LogParser.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Reserved in metadata sequences for escaping other reserved values.
+static const char METADATA_ESCAPE = '\\';
+
+/// Reserved in metadata sequences to separate key,value pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Reserved in metadata sequences to separate them from a preceding event and an optional terminal message.
+static const char SECTION_SEPARATOR = ':';
+
+/// Reserved in metadata sequences to separate keys from values.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+/// Length of "YYYY-MM-DD HH:MM:SS".
+static const size_t DATE_AND_TIME_LENGTH = 19;
+
+/// Length of "YYYY-MM-DD HH:MM:SS.mmm".
+static const size_t DATE_AND_TIME_AND_MILLIS_LENGTH = 23;
+
+/// Length of "YYYY-MM-DD HH:MM:SS.mmm [", which is followed by the thread moniker.
+static const size_t PREFIX_LENGTH = 25;
+
+/// Number of milliseconds per second.
+static const int64_t MILLISECONDS_PER_SECOND = 1000;
+
+/// Number of seconds per day.
+static const int64_t SECONDS_PER_DAY = 86400;
+
+/**
+ * Parse a run of decimal digits.
+ *
+ * @param text The digits.
+ * @param count The number of digits.
+ * @param[out] out The value of the digits.
+ * @return Whether the first @c count characters of @c text are all digits.
+ */
+static inline bool parseDigits(const char* text, int count, int* out) {
+    int value = 0;
+    for (int ix = 0; ix < count; ix++) {
+        auto digit = static_cast<unsigned>(text[ix] - '0');
+        if (digit > 9) {
+            return false;
+        }
+        value = value * 10 + static_cast<int>(digit);
+    }
+    *out = value;
+    return true;
+}
+
+/**
+ * Count the days from 1970-01-01 to a date in the proleptic Gregorian calendar, without going through the C library,
+ * whose conversions use the local time zone and take locks.
+ *
+ * @param year The year.
+ * @param month The month, from 1 to 12.
+ * @param day The day of the month, from 1.
+ * @return The number of days from 1970-01-01 to the date.
+ */
+static int64_t daysFromCivil(int64_t year, int month, int day) {
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yearOfEra = year - era * 400;
+    const int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**
+ * Build the table mapping the characters written by @c convertLevelToChar() back to levels.
+ *
+ * @param[out] table The table, indexed by character.
+ */
+static void buildLevelTable(Level table[256]) {
+    for (int ix = 0; ix < 256; ix++) {
+        table[ix] = Level::UNKNOWN;
+    }
+    for (int level = static_cast<int>(Level::DEBUG9); level <= static_cast<int>(Level::NONE); level++) {
+        table[static_cast<unsigned char>(convertLevelToChar(static_cast<Level>(level)))] = static_cast<Level>(level);
+    }
+}
+
+/**
+ * Map the character written by @c convertLevelToChar() back to a level.
+ *
+ * @param c The character.
+ * @return The level written as @c c, or @c Level::UNKNOWN.
+ */
+static Level levelFromChar(char c) {
+    static struct LevelTable {
+        LevelTable() {
+            buildLevelTable(levels);
+        }
+        Level levels[256];
+    } table;
+    return table.levels[static_cast<unsigned char>(c)];
+}
+
+/**
+ * Check whether a character in some metadata is escaped.  Escape characters are themselves escaped, so it is if it
+ * follows an odd number of escape characters.
+ *
+ * @param begin The start of the metadata.
+ * @param position The position of the character.
+ * @return Whether the character at @c position is escaped.
+ */
+static inline bool isEscaped(const char* begin, const char* position) {
+    auto escape = position;
+    while (escape > begin && METADATA_ESCAPE == escape[-1]) {
+        --escape;
+    }
+    return (position - escape) & 1;
+}
+
+/**
+ * Find the first section separator in some metadata that is not escaped.  Separators are found with @c memchr(),
+ * which scans many characters at a time, as escaped ones are rare.
+ *
+ * @param begin The start of the metadata.
+ * @param end The end of the metadata.
+ * @return The position of the first unescaped section separator, or @c end if there is none.
+ */
+static inline const char* findSectionEnd(const char* begin, const char* end) {
+    auto position = begin;
+    while (position < end) {
+        auto separator = static_cast<const char*>(memchr(position, SECTION_SEPARATOR, end - position));
+        if (!separator) {
+            return end;
+        }
+        if (!isEscaped(begin, separator)) {
+            return separator;
+        }
+        position = separator + 1;
+    }
+    return end;
+}
+
+/**
+ * Find the end of a value in some metadata: the first pair or section separator that is not escaped.
+ *
+ * @param position The start of the value.
+ * @param end The end of the metadata.
+ * @return The position of the end of the value.
+ */
+static inline const char* findValueEnd(const char* position, const char* end) {
+    while (position < end) {
+        auto c = *position;
+        if (METADATA_ESCAPE == c) {
+            position += 2;
+            continue;
+        }
+        if (PAIR_SEPARATOR == c || SECTION_SEPARATOR == c) {
+            return position;
+        }
+        ++position;
+    }
+    return end;
+}
+
+/// The date and time most recently parsed by this thread, cached so lines within the same second can reuse it.
+struct CachedDateAndTime {
+    /// Whether @c milliseconds holds the parse of @c text.
+    bool valid;
+
+    /// The date and time, in the format "YYYY-MM-DD HH:MM:SS".
+    char text[DATE_AND_TIME_LENGTH];
+
+    /// The date and time, in milliseconds since the epoch.
+    int64_t milliseconds;
+};
+
+/// Per-thread cache of the parsed date and time.
+static thread_local CachedDateAndTime g_cachedDateAndTime = {false, {0}, 0};
+
+/**
+ * Parse the "YYYY-MM-DD HH:MM:SS.mmm" at the start of a log line.
+ *
+ * @param line The line, which must be at least @c DATE_AND_TIME_AND_MILLIS_LENGTH long.
+ * @param[out] milliseconds The date and time, in milliseconds since the epoch.
+ * @return Whether @c line starts with a date and time.
+ */
+static bool parseLineTime(const char* line, int64_t* milliseconds) {
+    auto& cache = g_cachedDateAndTime;
+    int millis = 0;
+    if ('.' != line[DATE_AND_TIME_LENGTH] || !parseDigits(line + DATE_AND_TIME_LENGTH + 1, 3, &millis)) {
+        return false;
+    }
+    if (!cache.valid || 0 != memcmp(cache.text, line, DATE_AND_TIME_LENGTH)) {
+        cache.valid = parseLogTime(line, DATE_AND_TIME_LENGTH, &cache.milliseconds);
+        if (!cache.valid) {
+            return false;
+        }
+        memcpy(cache.text, line, DATE_AND_TIME_LENGTH);
+    }
+    *milliseconds = cache.milliseconds + millis;
+    return true;
+}
+
+bool isLogLineStart(const char* line, size_t length) {
+    int unused = 0;
+    return length >= DATE_AND_TIME_LENGTH && '-' == line[4] && '-' == line[7] && ' ' == line[10] &&
+           ':' == line[13] && ':' == line[16] && parseDigits(line, 4, &unused);
+}
+
+bool parseLogTime(const char* text, size_t length, int64_t* milliseconds) {
+    if (length != DATE_AND_TIME_LENGTH && length != DATE_AND_TIME_AND_MILLIS_LENGTH) {
+        return false;
+    }
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0, millis = 0;
+    if (!parseDigits(text, 4, &year) || '-' != text[4] || !parseDigits(text + 5, 2, &month) || '-' != text[7] ||
+        !parseDigits(text + 8, 2, &day) || ' ' != text[10] || !parseDigits(text + 11, 2, &hour) ||
+        ':' != text[13] || !parseDigits(text + 14, 2, &minute) || ':' != text[16] ||
+        !parseDigits(text + 17, 2, &second)) {
+        return false;
+    }
+    if (DATE_AND_TIME_AND_MILLIS_LENGTH == length && ('.' != text[19] || !parseDigits(text + 20, 3, &millis))) {
+        return false;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+    int64_t seconds = daysFromCivil(year, month, day) * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+    *milliseconds = seconds * MILLISECONDS_PER_SECOND + millis;
+    return true;
+}
+
+bool parseLogLine(const char* line, size_t length, ParsedLogLine* out) {
+    if (length < PREFIX_LENGTH || ' ' != line[DATE_AND_TIME_AND_MILLIS_LENGTH] || '[' != line[PREFIX_LENGTH - 1] ||
+        !parseLineTime(line, &out->time)) {
+        return false;
+    }
+    auto end = line + length;
+
+    // The moniker is padded with spaces, and is followed by "] L " where L is the level.
+    auto position = line + PREFIX_LENGTH;
+    auto monikerEnd = static_cast<const char*>(memchr(position, ']', end - position));
+    if (!monikerEnd || end - monikerEnd < 3 || ' ' != monikerEnd[1] || (end - monikerEnd > 3 && ' ' != monikerEnd[3])) {
+        return false;
+    }
+    while (position < monikerEnd && ' ' == *position) {
+        ++position;
+    }
+    out->threadMoniker = {position, static_cast<size_t>(monikerEnd - position)};
+    out->level = levelFromChar(monikerEnd[2]);
+    position = monikerEnd + 3 < end ? monikerEnd + 4 : end;
+
+    // source:event, then either nothing, ":metadata", ":metadata:message" or "::message".
+    auto sourceEnd = static_cast<const char*>(memchr(position, SECTION_SEPARATOR, end - position));
+    if (!sourceEnd) {
+        sourceEnd = end;
+    }
+    out->source = {position, static_cast<size_t>(sourceEnd - position)};
+    position = sourceEnd < end ? sourceEnd + 1 : end;
+    auto eventEnd = static_cast<const char*>(memchr(position, SECTION_SEPARATOR, end - position));
+    if (!eventEnd) {
+        eventEnd = end;
+    }
+    out->event = {position, static_cast<size_t>(eventEnd - position)};
+    position = eventEnd < end ? eventEnd + 1 : end;
+    auto metadataEnd = findSectionEnd(position, end);
+    out->metadata = {position, static_cast<size_t>(metadataEnd - position)};
+    position = metadataEnd < end ? metadataEnd + 1 : end;
+    out->message = {position, static_cast<size_t>(end - position)};
+    return true;
+}
+
+void unescapeLogValue(const LogSpan& value, std::string* out) {
+    out->clear();
+    auto position = value.data;
+    auto end = value.data + value.size;
+    while (position < end) {
+        auto escape = static_cast<const char*>(memchr(position, METADATA_ESCAPE, end - position));
+        if (!escape) {
+            out->append(position, end - position);
+            break;
+        }
+        out->append(position, escape - position);
+        if (escape + 1 < end) {
+            out->push_back(escape[1]);
+        }
+        position = escape + 2;
+    }
+}
+
+LogMetadataTokenizer::LogMetadataTokenizer(const LogSpan& metadata) :
+        m_position{metadata.data},
+        m_end{metadata.data + metadata.size} {
+}
+
+bool LogMetadataTokenizer::next(LogSpan* key, LogSpan* value) {
+    if (m_position >= m_end) {
+        return false;
+    }
+    // Keys are not escaped, so the key ends at the first '=' (or ',', for a pair without a value).
+    auto keyEnd = m_position;
+    while (keyEnd < m_end && KEY_VALUE_SEPARATOR != *keyEnd && PAIR_SEPARATOR != *keyEnd) {
+        ++keyEnd;
+    }
+    *key = {m_position, static_cast<size_t>(keyEnd - m_position)};
+    if (keyEnd == m_end || PAIR_SEPARATOR == *keyEnd) {
+        *value = {keyEnd, 0};
+        m_position = keyEnd + 1;
+        return true;
+    }
+    auto valueStart = keyEnd + 1;
+    auto valueEnd = findValueEnd(valueStart, m_end);
+    *value = {valueStart, static_cast<size_t>(valueEnd - valueStart)};
+    m_position = valueEnd + 1;
+    return true;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
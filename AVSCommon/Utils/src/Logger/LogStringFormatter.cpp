@@ -14,6 +14,7 @@
  */
 
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 
 #include "AVSCommon/Utils/Logger/LogStringFormatter.h"
@@ -32,11 +33,8 @@ static const int DATE_AND_TIME_STRING_SIZE = 20;
 /// Separator between date/time and millis.
 static const char TIME_AND_MILLIS_SEPARATOR = '.';
 
-// Format string for sprintf() to produce millis in the format "nnn".
-static const char* MILLIS_FORMAT_STRING = "%03d";
-
-/// Size of buffer needed to hold "nnn" (milliseconds value) and a null terminator
-static const int MILLIS_STRING_SIZE = 4;
+/// Message logged in place of the date and time if they could not be rendered.
+static const char* DATE_AND_TIME_FAILURE_STRING = "ERROR: strftime() failed.  Date and time not logged.";
 
 /// Separator string between milliseconds value and ExampleLogger name.
 static const std::string MILLIS_AND_THREAD_SEPARATOR = " [";
@@ -53,35 +51,76 @@ static const int MILLISECONDS_PER_SECOND = 1000;
 LogStringFormatter::LogStringFormatter() : m_safeCTimeAccess(timing::SafeCTimeAccess::instance()) {
 }
 
+/// The date and time most recently rendered by this thread, cached so lines within the same second can reuse it.
+struct CachedDateAndTime {
+    /// Whether @c text holds the rendering of @c second.
+    bool valid;
+
+    /// The second that @c text was rendered for.
+    std::time_t second;
+
+    /// The rendered date and time, in the format "YYYY-MM-DD HH:MM:SS".
+    char text[DATE_AND_TIME_STRING_SIZE];
+
+    /// The length of @c text.
+    size_t length;
+};
+
+/// Per-thread cache of the rendered date and time.
+static thread_local CachedDateAndTime g_cachedDateAndTime = {false, 0, {0}, 0};
+
 std::string LogStringFormatter::format(
     Level level,
     std::chrono::system_clock::time_point time,
     const char* threadMoniker,
     const char* text) {
-    bool dateTimeFailure = false;
-    bool millisecondFailure = false;
-    char dateTimeString[DATE_AND_TIME_STRING_SIZE];
+    std::string stringToEmit;
+    format(level, time, threadMoniker, text, &stringToEmit);
+    return stringToEmit;
+}
+
+void LogStringFormatter::format(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    std::string* out) {
+    auto& cache = g_cachedDateAndTime;
     auto timeAsTime_t = std::chrono::system_clock::to_time_t(time);
-    std::tm timeAsTm;
-    if (!m_safeCTimeAccess->getGmtime(timeAsTime_t, &timeAsTm) ||
-        0 == strftime(dateTimeString, sizeof(dateTimeString), STRFTIME_FORMAT_STRING, &timeAsTm)) {
-        dateTimeFailure = true;
+    if (!cache.valid || cache.second != timeAsTime_t) {
+        std::tm timeAsTm;
+        cache.valid = m_safeCTimeAccess->getGmtime(timeAsTime_t, &timeAsTm) &&
+                      0 != strftime(cache.text, sizeof(cache.text), STRFTIME_FORMAT_STRING, &timeAsTm);
+        cache.second = timeAsTime_t;
+        cache.length = cache.valid ? strlen(cache.text) : 0;
     }
     auto timeMillisPart = static_cast<int>(
         std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() %
         MILLISECONDS_PER_SECOND);
-    char millisString[MILLIS_STRING_SIZE];
-    if (snprintf(millisString, sizeof(millisString), MILLIS_FORMAT_STRING, timeMillisPart) < 0) {
-        millisecondFailure = true;
+    if (timeMillisPart < 0) {
+        timeMillisPart += MILLISECONDS_PER_SECOND;
+    }
+    char millisString[] = {TIME_AND_MILLIS_SEPARATOR,
+                           static_cast<char>('0' + timeMillisPart / 100),
+                           static_cast<char>('0' + timeMillisPart / 10 % 10),
+                           static_cast<char>('0' + timeMillisPart % 10)};
+
+    if (cache.valid) {
+        out->append(cache.text, cache.length);
+    } else {
+        out->append(DATE_AND_TIME_FAILURE_STRING);
+    }
+    out->append(millisString, sizeof(millisString));
+    out->append(MILLIS_AND_THREAD_SEPARATOR);
+    if (threadMoniker) {
+        out->append(threadMoniker);
+    }
+    out->append(THREAD_AND_LEVEL_SEPARATOR);
+    out->push_back(convertLevelToChar(level));
+    out->push_back(LEVEL_AND_TEXT_SEPARATOR);
+    if (text) {
+        out->append(text);
     }
-
-    std::stringstream stringToEmit;
-    stringToEmit << (dateTimeFailure ? "ERROR: strftime() failed.  Date and time not logged." : dateTimeString)
-                 << TIME_AND_MILLIS_SEPARATOR
-                 << (millisecondFailure ? "ERROR: snprintf() failed.  Milliseconds not logged." : millisString)
-                 << MILLIS_AND_THREAD_SEPARATOR << threadMoniker << THREAD_AND_LEVEL_SEPARATOR
-                 << convertLevelToChar(level) << LEVEL_AND_TEXT_SEPARATOR << text;
-    return stringToEmit.str();
 }
 
 }  // namespace logger
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include "AVSCommon/Utils/Logger/FlightRecorder.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Logger/ThreadMoniker.h"
 
@@ -31,12 +32,24 @@ static const std::string CONFIG_KEY_LOG_LEVEL = "logLevel";
 
 static constexpr auto AT_EXIT_THREAD_ID = "0";
 
-Logger::Logger(Level level) : m_level{level} {
+Logger::Logger(Level level) : m_level(m_ownLevel), m_ownLevel{level} {
+}
+
+Logger::Logger(Level level, std::atomic<Level>* levelStorage) :
+        m_level(levelStorage ? *levelStorage : m_ownLevel),
+        m_ownLevel{level} {
+    m_level = level;
 }
 
 void Logger::log(Level level, const LogEntry& entry) {
     if (shouldLog(level)) {
-        emit(level, std::chrono::system_clock::now(), ThreadMoniker::getThisThreadMoniker().c_str(), entry.c_str());
+        auto time = std::chrono::system_clock::now();
+        auto threadMoniker = ThreadMoniker::getThisThreadMonikerCString();
+        auto flightRecorder = FlightRecorder::instance();
+        if (flightRecorder && flightRecorder->shouldRecord(level)) {
+            flightRecorder->record(level, time, threadMoniker, entry);
+        }
+        emitEntry(level, time, threadMoniker, entry);
     }
 }
 
@@ -116,10 +129,48 @@ void Logger::notifyObserversOnLogLevelChanged() {
 
 void Logger::logAtExit(Level level, const LogEntry& entry) {
     if (shouldLog(level)) {
-        emit(level, std::chrono::system_clock::now(), AT_EXIT_THREAD_ID, entry.c_str());
+        emitAtExit(level, std::chrono::system_clock::now(), AT_EXIT_THREAD_ID, entry.c_str());
     }
 }
 
+void Logger::emitEntry(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& entry) {
+    emit(level, time, threadMoniker, entry.c_str());
+}
+
+void Logger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    const char* /*line*/,
+    size_t /*length*/) {
+    emit(level, time, threadMoniker, text);
+}
+
+void Logger::emitUnfiltered(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    emit(level, time, threadMoniker, text);
+}
+
+bool Logger::usesFormattedLines() const {
+    return false;
+}
+
+void Logger::emitAtExit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    emit(level, time, threadMoniker, text);
+}
+
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
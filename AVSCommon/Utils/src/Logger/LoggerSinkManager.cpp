@@ -61,6 +61,7 @@ void LoggerSinkManager::initialize(const std::shared_ptr<Logger>& sink) {
         return;
     }
 
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
     if (m_sink == sink) {
         // don't do anything if the sink is the same
         return;
@@ -70,6 +71,37 @@ void LoggerSinkManager::initialize(const std::shared_ptr<Logger>& sink) {
         sink->setLevel(m_level);
     }
 
+    m_multiSink.reset();
+    setSinkLocked(sink);
+}
+
+bool LoggerSinkManager::addSink(const std::shared_ptr<Logger>& sink, Level level) {
+    if (!sink) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (!m_multiSink) {
+        auto multiSink = MultiSinkLogger::create();
+        if (m_sink) {
+            multiSink->addSink(m_sink);
+        }
+        m_multiSink = multiSink;
+        setSinkLocked(multiSink);
+    }
+    sink->setLevel(level);
+    return m_multiSink->addSink(sink);
+}
+
+bool LoggerSinkManager::removeSink(const std::shared_ptr<Logger>& sink) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (!m_multiSink) {
+        return false;
+    }
+    return m_multiSink->removeSink(sink);
+}
+
+void LoggerSinkManager::setSinkLocked(const std::shared_ptr<Logger>& sink) {
     // copy the vector first with the lock
     std::vector<SinkObserverInterface*> observersCopy;
     {
@@ -14,9 +14,9 @@
  */
 
 #include <cstdio>
-#include <iomanip>
 #include <iostream>
 
+#include "AVSCommon/Utils/Logger/HexDump.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
@@ -91,47 +91,12 @@ void logEntry(Level level, const LogEntry& entry) {
 }
 
 void dumpBytesToStream(std::ostream& stream, const char* prefix, size_t width, const unsigned char* data, size_t size) {
-    std::ios incomingFormat(nullptr);
-    incomingFormat.copyfmt(stream);
-
-    stream << std::hex << std::right << std::setfill('0');
-
-    for (size_t ix = 0; ix < size; ix += width) {
-        // Output byte offset for this row.
-        stream << prefix << std::setw(8) << ix;
-        stream << " : ";
-
-        // Output bytes for this row in hex.
-        auto columnLimit = ix + width;
-        auto byteLimit = columnLimit < size ? columnLimit : size;
-        for (size_t iy = ix; iy < columnLimit; iy++) {
-            if (iy < byteLimit) {
-                stream << std::setw(2) << static_cast<unsigned int>(data[iy]);
-            } else {
-                stream << "  ";
-            }
-            // Split the output in to 4 byte (8 hex digit) wide columns.
-            if ((iy < columnLimit - 1) && (iy & 0x03) == 0x03) {
-                stream << " ";
-            }
-        }
-
-        stream << " : ";
-
-        // Output bytes as visible characters.
-        for (size_t iy = ix; iy < byteLimit; iy++) {
-            auto ch = data[iy];
-            if (std::isprint(ch)) {
-                stream << ch;
-            } else {
-                stream << '.';
-            }
-        }
-
-        stream << std::endl;
-    }
-
-    stream.copyfmt(incomingFormat);
+    // Reused by each thread so that dumping does not allocate once the buffer has grown.
+    static thread_local std::string dump;
+    dump.clear();
+    appendHexDump(prefix, width, data, size, &dump);
+    stream.write(dump.data(), dump.size());
+    stream.flush();
 }
 
 }  // namespace logger
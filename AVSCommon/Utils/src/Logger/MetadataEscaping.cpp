@@ -0,0 +1,249 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/MetadataEscaping.h"
+
+#include <cstdint>
+#include <initializer_list>
+
+/*
+ * SSE2 is part of the x86-64 baseline.  The AVX2 implementation is built with a per-function target attribute, so
+ * the library as a whole does not need to be compiled for a CPU that supports it.  The CPU is checked at run time
+ * before it is used.
+ */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define ACSDK_METADATA_ESCAPER_X86
+#include <immintrin.h>
+#endif
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Reserved in metadata sequences for escaping other reserved values.
+static const char METADATA_ESCAPE = '\\';
+
+/// Reserved in metadata sequences to separate key,value pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Reserved in metadata sequences to separate them from a preceding event and an optional terminal message.
+static const char SECTION_SEPARATOR = ':';
+
+/// Reserved in metadata sequences to separate keys from values.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+/// Type of a function implementing @c escapeMetadata().
+using EscapeFunction = size_t (*)(const char* text, size_t length, char* out);
+
+/**
+ * Check whether a character is reserved in metadata sequences.
+ *
+ * @param c The character to check.
+ * @return Whether @c c is reserved.
+ */
+static inline bool isReserved(char c) {
+    return METADATA_ESCAPE == c || PAIR_SEPARATOR == c || SECTION_SEPARATOR == c || KEY_VALUE_SEPARATOR == c;
+}
+
+/**
+ * Scalar implementation of @c escapeMetadata().
+ *
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.
+ * @return The number of characters written to @c out.
+ */
+static size_t escapeScalar(const char* text, size_t length, char* out) {
+    auto start = out;
+    for (size_t ix = 0; ix < length; ix++) {
+        auto c = text[ix];
+        if (isReserved(c)) {
+            *out++ = METADATA_ESCAPE;
+        }
+        *out++ = c;
+    }
+    return out - start;
+}
+
+/**
+ * Copy a block of characters in which @c mask flags the reserved ones, escaping those.
+ *
+ * @param text The block of characters.
+ * @param blockSize The number of characters in the block.
+ * @param mask Bit @c n of which is set if character @c n of the block is reserved.
+ * @param[out] out The buffer to write the escaped block to.
+ * @return The number of characters written to @c out.
+ */
+static inline size_t escapeBlock(const char* text, size_t blockSize, uint32_t mask, char* out) {
+    auto start = out;
+    for (size_t ix = 0; ix < blockSize; ix++) {
+        if (mask & (1u << ix)) {
+            *out++ = METADATA_ESCAPE;
+        }
+        *out++ = text[ix];
+    }
+    return out - start;
+}
+
+#ifdef ACSDK_METADATA_ESCAPER_X86
+
+/**
+ * Escape a string 16 characters at a time using SSE2 instructions.  Always inlined, so that when it is called from
+ * @c escapeAvx2() it is compiled with VEX encoding and does not incur SSE/AVX transition penalties.
+ *
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.
+ * @return The number of characters written to @c out.
+ */
+static inline __attribute__((always_inline)) size_t escapeSse2Inline(const char* text, size_t length, char* out) {
+    const __m128i escape = _mm_set1_epi8(METADATA_ESCAPE);
+    const __m128i pairSeparator = _mm_set1_epi8(PAIR_SEPARATOR);
+    const __m128i sectionSeparator = _mm_set1_epi8(SECTION_SEPARATOR);
+    const __m128i keyValueSeparator = _mm_set1_epi8(KEY_VALUE_SEPARATOR);
+    auto start = out;
+    size_t ix = 0;
+    for (; ix + sizeof(__m128i) <= length; ix += sizeof(__m128i)) {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + ix));
+        auto matches = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, escape), _mm_cmpeq_epi8(block, pairSeparator)),
+            _mm_or_si128(_mm_cmpeq_epi8(block, sectionSeparator), _mm_cmpeq_epi8(block, keyValueSeparator)));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+        if (!mask) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+            out += sizeof(__m128i);
+        } else {
+            out += escapeBlock(text + ix, sizeof(__m128i), mask, out);
+        }
+    }
+    for (; ix < length; ix++) {
+        if (isReserved(text[ix])) {
+            *out++ = METADATA_ESCAPE;
+        }
+        *out++ = text[ix];
+    }
+    return out - start;
+}
+
+/**
+ * SSE2 implementation of @c escapeMetadata().
+ *
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.
+ * @return The number of characters written to @c out.
+ */
+static size_t escapeSse2(const char* text, size_t length, char* out) {
+    return escapeSse2Inline(text, length, out);
+}
+
+/**
+ * AVX2 implementation of @c escapeMetadata().
+ *
+ * @param text The string to escape.
+ * @param length The number of characters in @c text.
+ * @param[out] out The buffer to write the escaped string to.
+ * @return The number of characters written to @c out.
+ */
+__attribute__((target("avx2"))) static size_t escapeAvx2(const char* text, size_t length, char* out) {
+    const __m256i escape = _mm256_set1_epi8(METADATA_ESCAPE);
+    const __m256i pairSeparator = _mm256_set1_epi8(PAIR_SEPARATOR);
+    const __m256i sectionSeparator = _mm256_set1_epi8(SECTION_SEPARATOR);
+    const __m256i keyValueSeparator = _mm256_set1_epi8(KEY_VALUE_SEPARATOR);
+    auto start = out;
+    size_t ix = 0;
+    for (; ix + sizeof(__m256i) <= length; ix += sizeof(__m256i)) {
+        auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + ix));
+        auto escapesOrPairs =
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, escape), _mm256_cmpeq_epi8(block, pairSeparator));
+        auto sectionsOrKeyValues =
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, sectionSeparator), _mm256_cmpeq_epi8(block, keyValueSeparator));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(escapesOrPairs, sectionsOrKeyValues)));
+        if (!mask) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), block);
+            out += sizeof(__m256i);
+        } else {
+            out += escapeBlock(text + ix, sizeof(__m256i), mask, out);
+        }
+    }
+    // Finish with SSE2 so that a tail of 16 to 31 characters is still scanned a block at a time.
+    out += escapeSse2Inline(text + ix, length - ix, out);
+    return out - start;
+}
+
+#endif  // ACSDK_METADATA_ESCAPER_X86
+
+/**
+ * Get the function implementing an escaper.
+ *
+ * @param escaper The escaper.
+ * @return The function implementing @c escaper, or @c nullptr if it is not supported.
+ */
+static EscapeFunction getEscapeFunction(MetadataEscaper escaper) {
+    switch (escaper) {
+        case MetadataEscaper::SCALAR:
+            return escapeScalar;
+        case MetadataEscaper::SSE2:
+#ifdef ACSDK_METADATA_ESCAPER_X86
+            return escapeSse2;
+#else
+            return nullptr;
+#endif
+        case MetadataEscaper::AVX2:
+#ifdef ACSDK_METADATA_ESCAPER_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return escapeAvx2;
+            }
+#endif
+            return nullptr;
+    }
+    return nullptr;
+}
+
+/**
+ * Select the fastest escaper supported by the CPU.
+ *
+ * @return The function implementing the fastest escaper supported by the CPU.
+ */
+static EscapeFunction selectEscapeFunction() {
+    for (auto escaper : {MetadataEscaper::AVX2, MetadataEscaper::SSE2}) {
+        auto function = getEscapeFunction(escaper);
+        if (function) {
+            return function;
+        }
+    }
+    return escapeScalar;
+}
+
+size_t escapeMetadata(const char* text, size_t length, char* out) {
+    static const EscapeFunction escapeFunction = selectEscapeFunction();
+    return escapeFunction(text, length, out);
+}
+
+size_t escapeMetadata(MetadataEscaper escaper, const char* text, size_t length, char* out) {
+    auto function = getEscapeFunction(escaper);
+    return function ? function(text, length, out) : escapeScalar(text, length, out);
+}
+
+bool isMetadataEscaperSupported(MetadataEscaper escaper) {
+    return getEscapeFunction(escaper) != nullptr;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -22,13 +22,100 @@ namespace avsCommon {
 namespace utils {
 namespace logger {
 
+/// Configuration key for root level "logger" object.
+static const std::string CONFIG_KEY_LOGGER = "logger";
+
+/// Configuration key for the "backtrace" object under "logger" and other per-module objects.
+static const std::string CONFIG_KEY_BACKTRACE = "backtrace";
+
+/// Configuration key for the lowest level of entries to buffer.
+static const std::string CONFIG_KEY_LOG_LEVEL = "logLevel";
+
+/// Configuration key for the lowest level of entries that flush the buffer.
+static const std::string CONFIG_KEY_FLUSH_LEVEL = "flushLevel";
+
+/// Configuration key for the number of entries to buffer.
+static const std::string CONFIG_KEY_ENTRY_COUNT = "entryCount";
+
+/// Configuration key for how old buffered entries may be and still be flushed, in milliseconds.
+static const std::string CONFIG_KEY_MAX_AGE = "maxAgeMs";
+
+/// Default lowest level of entries to buffer.
+static const Level DEFAULT_BACKTRACE_LEVEL = Level::DEBUG9;
+
+/// Default lowest level of entries that flush the buffer.
+static const Level DEFAULT_FLUSH_LEVEL = Level::ERROR;
+
+/// Default number of entries to buffer.
+static const uint32_t DEFAULT_ENTRY_COUNT = 64;
+
+/// Default of how old buffered entries may be and still be flushed.
+static const std::chrono::milliseconds DEFAULT_MAX_AGE = std::chrono::milliseconds(10000);
+
 void ModuleLogger::emit(
     Level level,
     std::chrono::system_clock::time_point time,
     const char* threadId,
     const char* text) {
-    if (shouldLog(level)) {
-        m_sink->emit(level, time, threadId, text);
+    if (m_flightRecorder && m_flightRecorder->shouldRecord(level)) {
+        m_flightRecorder->record(level, time, threadId, text);
+    }
+    if (shouldForward(level)) {
+        flushBacktrace(level, time);
+        if (isForwardedByOverride(level)) {
+            m_sink->emitUnfiltered(level, time, threadId, text);
+        } else {
+            m_sink->emit(level, time, threadId, text);
+        }
+    } else {
+        bufferBacktrace(level, time, threadId, text);
+    }
+}
+
+void ModuleLogger::emitEntry(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadId,
+    const LogEntry& entry) {
+    if (shouldForward(level)) {
+        flushBacktrace(level, time);
+        if (isForwardedByOverride(level)) {
+            m_sink->emitUnfiltered(level, time, threadId, entry.c_str());
+        } else {
+            m_sink->emitEntry(level, time, threadId, entry);
+        }
+    } else if (m_backtrace && m_backtrace->shouldBuffer(level)) {
+        m_backtrace->add(level, time, threadId, entry);
+    }
+}
+
+void ModuleLogger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadId,
+    const char* text,
+    const char* line,
+    size_t length) {
+    if (shouldForward(level)) {
+        flushBacktrace(level, time);
+        if (isForwardedByOverride(level)) {
+            m_sink->emitUnfiltered(level, time, threadId, text);
+        } else {
+            m_sink->emitFormatted(level, time, threadId, text, line, length);
+        }
+    } else {
+        bufferBacktrace(level, time, threadId, text);
+    }
+}
+
+void ModuleLogger::emitAtExit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadId,
+    const char* text) {
+    if (shouldForward(level)) {
+        // Not sent with emitUnfiltered(), which a sink may defer, while the entry must be written before this returns.
+        m_sink->emitAtExit(level, time, threadId, text);
     }
 }
 
@@ -51,19 +138,48 @@ void ModuleLogger::onSinkChanged(const std::shared_ptr<Logger>& logger) {
 }
 
 void ModuleLogger::updateLogLevel() {
+    Level forwardLevel;
     if (Level::UNKNOWN == m_sinkLogLevel) {
-        Logger::setLevel(m_moduleLogLevel);
+        forwardLevel = m_moduleLogLevel;
     } else if (Level::UNKNOWN == m_moduleLogLevel) {
-        Logger::setLevel(m_sinkLogLevel);
+        forwardLevel = m_sinkLogLevel;
     } else {
-        Logger::setLevel((m_sinkLogLevel > m_moduleLogLevel) ? m_sinkLogLevel : m_moduleLogLevel);
+        forwardLevel = (m_sinkLogLevel > m_moduleLogLevel) ? m_sinkLogLevel : m_moduleLogLevel;
+    }
+    // Build entries the flight recorder or the backtrace buffer wants, even if they are not forwarded to the sink.
+    auto recordLevel = m_flightRecorder ? m_flightRecorder->getLevel() : Level::UNKNOWN;
+    if (m_backtrace && m_backtrace->getLevel() < recordLevel) {
+        recordLevel = m_backtrace->getLevel();
+    }
+#ifndef ACSDK_DEBUG_LOG_ENABLED
+    // DEBUG logs are compiled out, so lowering the level below INFO would only trigger a warning.
+    if (recordLevel < Level::INFO) {
+        recordLevel = Level::INFO;
     }
+#endif
+    m_configuredForwardLogLevel = forwardLevel;
+    if (m_controlSlot) {
+        // The slot holds m_level and m_forwardLogLevel, and applies any level set with the LogControl file.
+        LogControl::update(m_controlSlot, forwardLevel, recordLevel);
+        return;
+    }
+    m_forwardLogLevel = forwardLevel;
+    Logger::setLevel(recordLevel < forwardLevel ? recordLevel : forwardLevel);
 }
 
 ModuleLogger::ModuleLogger(const std::string& configKey) :
-        Logger(Level::UNKNOWN),
+        ModuleLogger(configKey, LogControl::instance() ? LogControl::instance()->claimSlot(configKey) : nullptr) {
+}
+
+ModuleLogger::ModuleLogger(const std::string& configKey, LogControl::Slot* controlSlot) :
+        Logger(Level::UNKNOWN, controlSlot ? &controlSlot->level : nullptr),
         m_moduleLogLevel(Level::UNKNOWN),
         m_sinkLogLevel(Level::UNKNOWN),
+        m_controlSlot(controlSlot),
+        m_ownForwardLogLevel(Level::UNKNOWN),
+        m_forwardLogLevel(controlSlot ? controlSlot->forwardLevel : m_ownForwardLogLevel),
+        m_configuredForwardLogLevel(Level::UNKNOWN),
+        m_flightRecorder(FlightRecorder::instance()),
         m_sink(nullptr) {
     /*
      * By adding itself to the LoggerSinkManager, the LoggerSinkManager will
@@ -74,7 +190,41 @@ ModuleLogger::ModuleLogger(const std::string& configKey) :
      */
     LoggerSinkManager::instance().addSinkObserver(this);
 
-    init(configuration::ConfigurationNode::getRoot()[configKey]);
+    auto configuration = configuration::ConfigurationNode::getRoot()[configKey];
+    initBacktrace(configuration);
+    init(configuration);
+}
+
+void ModuleLogger::initBacktrace(const configuration::ConfigurationNode& configuration) {
+    auto backtrace = configuration[CONFIG_KEY_BACKTRACE];
+    if (!backtrace) {
+        backtrace = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_LOGGER][CONFIG_KEY_BACKTRACE];
+        if (!backtrace) {
+            return;
+        }
+    }
+    auto level = DEFAULT_BACKTRACE_LEVEL;
+    auto flushLevel = DEFAULT_FLUSH_LEVEL;
+    auto readLevel = [this, &backtrace](const std::string& key, Level* level) {
+        std::string name;
+        if (backtrace.getString(key, &name)) {
+            auto configured = convertNameToLevel(name);
+            if (Level::UNKNOWN == configured) {
+                // Log without ACSDK_* macros to avoid recursive invocation of constructor.
+                log(Level::ERROR, LogEntry("Logger", "unknownBacktraceLogLevel").d("key", key).d("name", name));
+            } else {
+                *level = configured;
+            }
+        }
+    };
+    readLevel(CONFIG_KEY_LOG_LEVEL, &level);
+    readLevel(CONFIG_KEY_FLUSH_LEVEL, &flushLevel);
+    uint32_t entryCount = DEFAULT_ENTRY_COUNT;
+    backtrace.getUint32(CONFIG_KEY_ENTRY_COUNT, &entryCount, DEFAULT_ENTRY_COUNT);
+    std::chrono::milliseconds maxAge;
+    backtrace.getDuration<std::chrono::milliseconds>(CONFIG_KEY_MAX_AGE, &maxAge, DEFAULT_MAX_AGE);
+    m_backtrace.reset(new BacktraceBuffer(level, flushLevel, entryCount, maxAge));
+    updateLogLevel();
 }
 
 }  // namespace logger
@@ -0,0 +1,243 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "AVSCommon/Utils/Logger/MultiSinkLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+std::shared_ptr<MultiSinkLogger> MultiSinkLogger::create() {
+    return std::shared_ptr<MultiSinkLogger>(new MultiSinkLogger());
+}
+
+MultiSinkLogger::MultiSinkLogger() :
+        Logger(Level::NONE),
+        m_sinks{std::make_shared<Sinks>()},
+        m_gateLevel{Level::DEBUG9} {
+}
+
+MultiSinkLogger::~MultiSinkLogger() {
+    std::lock_guard<std::mutex> lock(m_sinksMutex);
+    for (auto& sink : *m_sinks) {
+        sink->removeLogLevelObserver(this);
+    }
+}
+
+bool MultiSinkLogger::addSink(const std::shared_ptr<Logger>& sink) {
+    if (!sink || sink.get() == this) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_sinksMutex);
+    auto current = std::atomic_load(&m_sinks);
+    if (std::find(current->begin(), current->end(), sink) != current->end()) {
+        return false;
+    }
+    auto sinks = std::make_shared<Sinks>(*current);
+    sinks->push_back(sink);
+    std::atomic_store(&m_sinks, std::shared_ptr<const Sinks>(sinks));
+    // Notifies this object of the level of the sink right away, which updates the level of this object.
+    sink->addLogLevelObserver(this);
+    return true;
+}
+
+bool MultiSinkLogger::removeSink(const std::shared_ptr<Logger>& sink) {
+    {
+        std::lock_guard<std::mutex> lock(m_sinksMutex);
+        auto current = std::atomic_load(&m_sinks);
+        auto it = std::find(current->begin(), current->end(), sink);
+        if (it == current->end()) {
+            return false;
+        }
+        auto sinks = std::make_shared<Sinks>(current->begin(), it);
+        sinks->insert(sinks->end(), it + 1, current->end());
+        std::atomic_store(&m_sinks, std::shared_ptr<const Sinks>(sinks));
+        sink->removeLogLevelObserver(this);
+    }
+    updateLevel();
+    return true;
+}
+
+std::vector<std::shared_ptr<Logger>> MultiSinkLogger::getSinks() const {
+    return *std::atomic_load(&m_sinks);
+}
+
+void MultiSinkLogger::setLevel(Level level) {
+    std::lock_guard<std::mutex> lock(m_levelMutex);
+    m_gateLevel = level;
+    updateLevelLocked();
+}
+
+void MultiSinkLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (!shouldLog(level)) {
+        return;
+    }
+    auto sinks = std::atomic_load(&m_sinks);
+    int count = 0;
+    auto sink = findOnlySink(*sinks, level, &count);
+    if (sink) {
+        sink->emit(level, time, threadMoniker, text);
+    } else if (count > 1) {
+        emitToSinks(*sinks, true, level, time, threadMoniker, text, nullptr);
+    }
+}
+
+void MultiSinkLogger::emitEntry(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogEntry& entry) {
+    if (!shouldLog(level)) {
+        return;
+    }
+    auto sinks = std::atomic_load(&m_sinks);
+    int count = 0;
+    auto sink = findOnlySink(*sinks, level, &count);
+    if (sink) {
+        sink->emitEntry(level, time, threadMoniker, entry);
+    } else if (count > 1) {
+        emitToSinks(*sinks, true, level, time, threadMoniker, entry.c_str(), &entry);
+    }
+}
+
+void MultiSinkLogger::emitFormatted(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    const char* line,
+    size_t length) {
+    if (!shouldLog(level)) {
+        return;
+    }
+    auto sinks = std::atomic_load(&m_sinks);
+    for (auto& sink : *sinks) {
+        if (sink->shouldLog(level)) {
+            sink->emitFormatted(level, time, threadMoniker, text, line, length);
+        }
+    }
+}
+
+void MultiSinkLogger::emitAtExit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (!shouldLog(level)) {
+        return;
+    }
+    auto sinks = std::atomic_load(&m_sinks);
+    for (auto& sink : *sinks) {
+        if (sink->shouldLog(level)) {
+            sink->emitAtExit(level, time, threadMoniker, text);
+        }
+    }
+}
+
+void MultiSinkLogger::emitUnfiltered(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    // A gate set to NONE turns every sink off.
+    if (!shouldLog(Level::CRITICAL)) {
+        return;
+    }
+    emitToSinks(*std::atomic_load(&m_sinks), false, level, time, threadMoniker, text, nullptr);
+}
+
+void MultiSinkLogger::onLogLevelChanged(Level /*level*/) {
+    updateLevel();
+}
+
+void MultiSinkLogger::updateLevel() {
+    std::lock_guard<std::mutex> lock(m_levelMutex);
+    updateLevelLocked();
+}
+
+void MultiSinkLogger::updateLevelLocked() {
+    auto sinks = std::atomic_load(&m_sinks);
+    // Sinks with an UNKNOWN level accept nothing, and NONE is the level that accepts nothing if there are no sinks.
+    auto level = Level::NONE;
+    for (auto& sink : *sinks) {
+        auto sinkLevel = sink->getLevel();
+        if (sinkLevel < level) {
+            level = sinkLevel;
+        }
+    }
+    if (m_gateLevel > level) {
+        level = m_gateLevel;
+    }
+    Logger::setLevel(level);
+}
+
+Logger* MultiSinkLogger::findOnlySink(const Sinks& sinks, Level level, int* count) {
+    Logger* only = nullptr;
+    *count = 0;
+    for (auto& sink : sinks) {
+        if (sink->shouldLog(level)) {
+            if (++*count > 1) {
+                return nullptr;
+            }
+            only = sink.get();
+        }
+    }
+    return only;
+}
+
+void MultiSinkLogger::emitToSinks(
+    const Sinks& sinks,
+    bool filter,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    const LogEntry* entry) {
+    // Reused by each thread so that formatting a line does not allocate once the buffer has grown.
+    static thread_local std::string line;
+    bool formatted = false;
+    for (auto& sink : sinks) {
+        // Sinks set to NONE or UNKNOWN accept nothing, even unfiltered.
+        if (!sink->shouldLog(filter ? level : Level::CRITICAL)) {
+            continue;
+        }
+        if (!sink->usesFormattedLines()) {
+            if (entry) {
+                sink->emitEntry(level, time, threadMoniker, *entry);
+            } else {
+                sink->emit(level, time, threadMoniker, text);
+            }
+            continue;
+        }
+        if (!formatted) {
+            line.clear();
+            m_logFormatter.format(level, time, threadMoniker, text, &line);
+            formatted = true;
+        }
+        sink->emitFormatted(level, time, threadMoniker, text, line.data(), line.size());
+    }
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
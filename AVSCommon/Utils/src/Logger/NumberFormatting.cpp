@@ -0,0 +1,582 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/NumberFormatting.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// The two digit decimal representations of 0 to 99, concatenated.
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// The hexadecimal digits.
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+/// Powers of ten from 10^0 to 10^19, which are all that fit in a @c uint64_t.
+static const uint64_t POWERS_OF_TEN[] = {1ULL,
+                                         10ULL,
+                                         100ULL,
+                                         1000ULL,
+                                         10000ULL,
+                                         100000ULL,
+                                         1000000ULL,
+                                         10000000ULL,
+                                         100000000ULL,
+                                         1000000000ULL,
+                                         10000000000ULL,
+                                         100000000000ULL,
+                                         1000000000000ULL,
+                                         10000000000000ULL,
+                                         100000000000000ULL,
+                                         1000000000000000ULL,
+                                         10000000000000000ULL,
+                                         100000000000000000ULL,
+                                         1000000000000000000ULL,
+                                         10000000000000000000ULL};
+
+/// Doubles whose decimal exponent is below this are written in scientific notation.
+static const int MIN_FIXED_EXPONENT = -4;
+
+/// Doubles whose decimal exponent is at or above this are written in scientific notation.
+static const int MAX_FIXED_EXPONENT = 17;
+
+/// Big enough for the significant digits generated for any double.
+static const size_t MAX_SIGNIFICANT_DIGITS = 24;
+
+/**
+ * Count the leading zero bits of a non-zero value.
+ *
+ * @param value The value.  Must not be zero.
+ * @return The number of leading zero bits in @c value.
+ */
+static inline int countLeadingZeros(uint64_t value) {
+#if defined(__GNUC__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    while (!(value & (1ULL << 63))) {
+        value <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Count the decimal digits of a value.
+ *
+ * @param value The value.
+ * @return The number of decimal digits in @c value, or 0 if it is zero.
+ */
+static inline int countDecimalDigits(uint64_t value) {
+    // 1233 / 4096 approximates log10(2), which gives the digit count to within one.
+    auto estimate = ((64 - countLeadingZeros(value | 1)) * 1233) >> 12;
+    return estimate + 1 - (value < POWERS_OF_TEN[estimate] ? 1 : 0);
+}
+
+size_t formatUint64(uint64_t value, char* out) {
+    if (value < 10) {
+        *out = static_cast<char>('0' + value);
+        return 1;
+    }
+    size_t length = countDecimalDigits(value);
+    auto position = out + length;
+    while (value >= 100) {
+        auto pair = (value % 100) * 2;
+        value /= 100;
+        position -= 2;
+        memcpy(position, DIGIT_PAIRS + pair, 2);
+    }
+    if (value >= 10) {
+        memcpy(position - 2, DIGIT_PAIRS + value * 2, 2);
+    } else {
+        *(position - 1) = static_cast<char>('0' + value);
+    }
+    return length;
+}
+
+size_t formatInt64(int64_t value, char* out) {
+    if (value < 0) {
+        *out = '-';
+        // Negate as unsigned so that the most negative value does not overflow.
+        return 1 + formatUint64(0 - static_cast<uint64_t>(value), out + 1);
+    }
+    return formatUint64(static_cast<uint64_t>(value), out);
+}
+
+size_t formatPointer(const void* value, char* out) {
+    auto address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+    if (!address) {
+        *out = '0';
+        return 1;
+    }
+    size_t length = (64 - countLeadingZeros(address) + 3) / 4;
+    out[0] = '0';
+    out[1] = 'x';
+    for (auto position = out + 2 + length; address; address >>= 4) {
+        *--position = HEX_DIGITS[address & 0xf];
+    }
+    return 2 + length;
+}
+
+/*
+ * Doubles and floats are converted to decimal with the Grisu2 algorithm (Florian Loitsch, "Printing Floating-Point
+ * Numbers Quickly and Accurately with Integers", PLDI 2010).  Grisu2 always produces digits that read back as the
+ * same value, and for all but a tiny fraction of values produces the fewest such digits.
+ */
+
+/// A floating point value with a 64 bit significand: @c significand * 2^exponent.
+struct DiyFp {
+    /// The significand.
+    uint64_t significand;
+
+    /// The binary exponent.
+    int exponent;
+};
+
+/// 10^k for k from -348 to 340 in steps of 8, normalized so that the most significant bit of each is set.
+static const DiyFp CACHED_POWERS[] = {
+    {0xFA8FD5A0081C0288ULL, -1220},
+    {0xBAAEE17FA23EBF76ULL, -1193},
+    {0x8B16FB203055AC76ULL, -1166},
+    {0xCF42894A5DCE35EAULL, -1140},
+    {0x9A6BB0AA55653B2DULL, -1113},
+    {0xE61ACF033D1A45DFULL, -1087},
+    {0xAB70FE17C79AC6CAULL, -1060},
+    {0xFF77B1FCBEBCDC4FULL, -1034},
+    {0xBE5691EF416BD60CULL, -1007},
+    {0x8DD01FAD907FFC3CULL, -980},
+    {0xD3515C2831559A83ULL, -954},
+    {0x9D71AC8FADA6C9B5ULL, -927},
+    {0xEA9C227723EE8BCBULL, -901},
+    {0xAECC49914078536DULL, -874},
+    {0x823C12795DB6CE57ULL, -847},
+    {0xC21094364DFB5637ULL, -821},
+    {0x9096EA6F3848984FULL, -794},
+    {0xD77485CB25823AC7ULL, -768},
+    {0xA086CFCD97BF97F4ULL, -741},
+    {0xEF340A98172AACE5ULL, -715},
+    {0xB23867FB2A35B28EULL, -688},
+    {0x84C8D4DFD2C63F3BULL, -661},
+    {0xC5DD44271AD3CDBAULL, -635},
+    {0x936B9FCEBB25C996ULL, -608},
+    {0xDBAC6C247D62A584ULL, -582},
+    {0xA3AB66580D5FDAF6ULL, -555},
+    {0xF3E2F893DEC3F126ULL, -529},
+    {0xB5B5ADA8AAFF80B8ULL, -502},
+    {0x87625F056C7C4A8BULL, -475},
+    {0xC9BCFF6034C13053ULL, -449},
+    {0x964E858C91BA2655ULL, -422},
+    {0xDFF9772470297EBDULL, -396},
+    {0xA6DFBD9FB8E5B88FULL, -369},
+    {0xF8A95FCF88747D94ULL, -343},
+    {0xB94470938FA89BCFULL, -316},
+    {0x8A08F0F8BF0F156BULL, -289},
+    {0xCDB02555653131B6ULL, -263},
+    {0x993FE2C6D07B7FACULL, -236},
+    {0xE45C10C42A2B3B06ULL, -210},
+    {0xAA242499697392D3ULL, -183},
+    {0xFD87B5F28300CA0EULL, -157},
+    {0xBCE5086492111AEBULL, -130},
+    {0x8CBCCC096F5088CCULL, -103},
+    {0xD1B71758E219652CULL, -77},
+    {0x9C40000000000000ULL, -50},
+    {0xE8D4A51000000000ULL, -24},
+    {0xAD78EBC5AC620000ULL, 3},
+    {0x813F3978F8940984ULL, 30},
+    {0xC097CE7BC90715B3ULL, 56},
+    {0x8F7E32CE7BEA5C70ULL, 83},
+    {0xD5D238A4ABE98068ULL, 109},
+    {0x9F4F2726179A2245ULL, 136},
+    {0xED63A231D4C4FB27ULL, 162},
+    {0xB0DE65388CC8ADA8ULL, 189},
+    {0x83C7088E1AAB65DBULL, 216},
+    {0xC45D1DF942711D9AULL, 242},
+    {0x924D692CA61BE758ULL, 269},
+    {0xDA01EE641A708DEAULL, 295},
+    {0xA26DA3999AEF774AULL, 322},
+    {0xF209787BB47D6B85ULL, 348},
+    {0xB454E4A179DD1877ULL, 375},
+    {0x865B86925B9BC5C2ULL, 402},
+    {0xC83553C5C8965D3DULL, 428},
+    {0x952AB45CFA97A0B3ULL, 455},
+    {0xDE469FBD99A05FE3ULL, 481},
+    {0xA59BC234DB398C25ULL, 508},
+    {0xF6C69A72A3989F5CULL, 534},
+    {0xB7DCBF5354E9BECEULL, 561},
+    {0x88FCF317F22241E2ULL, 588},
+    {0xCC20CE9BD35C78A5ULL, 614},
+    {0x98165AF37B2153DFULL, 641},
+    {0xE2A0B5DC971F303AULL, 667},
+    {0xA8D9D1535CE3B396ULL, 694},
+    {0xFB9B7CD9A4A7443CULL, 720},
+    {0xBB764C4CA7A44410ULL, 747},
+    {0x8BAB8EEFB6409C1AULL, 774},
+    {0xD01FEF10A657842CULL, 800},
+    {0x9B10A4E5E9913129ULL, 827},
+    {0xE7109BFBA19C0C9DULL, 853},
+    {0xAC2820D9623BF429ULL, 880},
+    {0x80444B5E7AA7CF85ULL, 907},
+    {0xBF21E44003ACDD2DULL, 933},
+    {0x8E679C2F5E44FF8FULL, 960},
+    {0xD433179D9C8CB841ULL, 986},
+    {0x9E19DB92B4E31BA9ULL, 1013},
+    {0xEB96BF6EBADF77D9ULL, 1039},
+    {0xAF87023B9BF0EE6BULL, 1066}
+};
+
+/// The decimal exponent of @c CACHED_POWERS[0].
+static const int FIRST_CACHED_POWER_EXPONENT = -348;
+
+/// The step between the decimal exponents of consecutive entries of @c CACHED_POWERS.
+static const int CACHED_POWER_EXPONENT_STEP = 8;
+
+/**
+ * Details of the binary representation of the floating point types that are formatted.
+ *
+ * @tparam Type The floating point type.
+ */
+template <typename Type>
+struct FloatTraits;
+
+/// Details of the binary representation of @c double.
+template <>
+struct FloatTraits<double> {
+    /// An unsigned integer type the same size as the floating point type.
+    using Bits = uint64_t;
+    /// The number of explicitly stored significand bits.
+    static const int SIGNIFICAND_SIZE = 52;
+    /// The bias of the stored exponent, including the adjustment for the significand being an integer.
+    static const int EXPONENT_BIAS = 0x3FF + SIGNIFICAND_SIZE;
+    /// The mask for the stored exponent, once shifted down past the significand.
+    static const Bits EXPONENT_MASK = 0x7FF;
+};
+
+/// Details of the binary representation of @c float.
+template <>
+struct FloatTraits<float> {
+    /// An unsigned integer type the same size as the floating point type.
+    using Bits = uint32_t;
+    /// The number of explicitly stored significand bits.
+    static const int SIGNIFICAND_SIZE = 23;
+    /// The bias of the stored exponent, including the adjustment for the significand being an integer.
+    static const int EXPONENT_BIAS = 0x7F + SIGNIFICAND_SIZE;
+    /// The mask for the stored exponent, once shifted down past the significand.
+    static const Bits EXPONENT_MASK = 0xFF;
+};
+
+/**
+ * Shift a value so that the most significant bit of its significand is set.
+ *
+ * @param value The value.  Its significand must not be zero.
+ * @return The normalized value.
+ */
+static inline DiyFp normalize(DiyFp value) {
+    auto shift = countLeadingZeros(value.significand);
+    return {value.significand << shift, value.exponent - shift};
+}
+
+/**
+ * Multiply two values, rounding the product to 64 bits.
+ *
+ * @param lhs The left hand side.
+ * @param rhs The right hand side.
+ * @return The product.
+ */
+static inline DiyFp multiply(const DiyFp& lhs, const DiyFp& rhs) {
+#if defined(__SIZEOF_INT128__)
+    auto product = static_cast<unsigned __int128>(lhs.significand) * rhs.significand;
+    auto high = static_cast<uint64_t>(product >> 64);
+    auto low = static_cast<uint64_t>(product);
+    if (low & (1ULL << 63)) {
+        high++;
+    }
+    return {high, lhs.exponent + rhs.exponent + 64};
+#else
+    const uint64_t low32 = 0xFFFFFFFF;
+    auto a = lhs.significand >> 32;
+    auto b = lhs.significand & low32;
+    auto c = rhs.significand >> 32;
+    auto d = rhs.significand & low32;
+    auto ac = a * c;
+    auto bc = b * c;
+    auto ad = a * d;
+    auto bd = b * d;
+    auto middle = (bd >> 32) + (ad & low32) + (bc & low32) + (1ULL << 31);
+    return {ac + (ad >> 32) + (bc >> 32) + (middle >> 32), lhs.exponent + rhs.exponent + 64};
+#endif
+}
+
+/**
+ * Decompose a positive, finite floating point value and compute the boundaries halfway to its neighbours, within
+ * which any decimal reads back as the same value.
+ *
+ * @tparam Type The floating point type.
+ * @param value The value.  Must be positive and finite.
+ * @param[out] lower The lower boundary.
+ * @param[out] upper The upper boundary, normalized.  @c lower has the same exponent.
+ * @return The value, normalized.
+ */
+template <typename Type>
+static DiyFp decompose(Type value, DiyFp* lower, DiyFp* upper) {
+    using Traits = FloatTraits<Type>;
+    typename Traits::Bits bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint64_t hiddenBit = 1ULL << Traits::SIGNIFICAND_SIZE;
+    auto storedExponent = static_cast<int>((bits >> Traits::SIGNIFICAND_SIZE) & Traits::EXPONENT_MASK);
+    auto storedSignificand = static_cast<uint64_t>(bits) & (hiddenBit - 1);
+    DiyFp result;
+    if (storedExponent) {
+        result = {storedSignificand | hiddenBit, storedExponent - Traits::EXPONENT_BIAS};
+    } else {
+        result = {storedSignificand, 1 - Traits::EXPONENT_BIAS};
+    }
+    *upper = normalize({(result.significand << 1) + 1, result.exponent - 1});
+    // The gap below a power of two is half the gap above it.
+    if (result.significand == hiddenBit) {
+        *lower = {(result.significand << 2) - 1, result.exponent - 2};
+    } else {
+        *lower = {(result.significand << 1) - 1, result.exponent - 1};
+    }
+    lower->significand <<= lower->exponent - upper->exponent;
+    lower->exponent = upper->exponent;
+    return normalize(result);
+}
+
+/**
+ * Get a cached power of ten that scales a value with the given binary exponent into the range in which the digits
+ * can be generated with 64 bit integer arithmetic.
+ *
+ * @param exponent The binary exponent of the value to scale.
+ * @param[out] decimalExponent The decimal exponent to apply to the scaled value to get back the original.
+ * @return The cached power of ten.
+ */
+static inline DiyFp getCachedPower(int exponent, int* decimalExponent) {
+    // 0.30102999566398114 is log10(2).
+    auto estimate = (-61 - exponent) * 0.30102999566398114 - FIRST_CACHED_POWER_EXPONENT - 1;
+    auto k = static_cast<int>(estimate);
+    if (estimate - k > 0.0) {
+        k++;
+    }
+    auto index = (k >> 3) + 1;
+    *decimalExponent = -(FIRST_CACHED_POWER_EXPONENT + index * CACHED_POWER_EXPONENT_STEP);
+    return CACHED_POWERS[index];
+}
+
+/**
+ * Move the last generated digit towards the scaled value while the result stays within the boundaries.
+ *
+ * @param digits The generated digits.
+ * @param length The number of generated digits.
+ * @param delta The distance between the scaled boundaries.
+ * @param rest The distance from the generated digits to the scaled upper boundary.
+ * @param tenKappa The scaled value of one unit of the last generated digit.
+ * @param distance The distance from the scaled value to the scaled upper boundary.
+ */
+static inline void roundLastDigit(
+    char* digits,
+    int length,
+    uint64_t delta,
+    uint64_t rest,
+    uint64_t tenKappa,
+    uint64_t distance) {
+    while (rest < distance && delta - rest >= tenKappa &&
+           (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance)) {
+        digits[length - 1]--;
+        rest += tenKappa;
+    }
+}
+
+/**
+ * Generate the shortest digits of a scaled value that lie within its scaled boundaries.
+ *
+ * @param value The scaled value.
+ * @param upper The scaled upper boundary.
+ * @param delta The distance between the scaled boundaries.
+ * @param[out] digits The generated digits.
+ * @param[out] length The number of generated digits.
+ * @param[in,out] decimalExponent The decimal exponent of the scaled value, adjusted to that of the last digit.
+ */
+static void generateDigits(
+    const DiyFp& value,
+    const DiyFp& upper,
+    uint64_t delta,
+    char* digits,
+    int* length,
+    int* decimalExponent) {
+    const int shift = -upper.exponent;
+    const uint64_t one = 1ULL << shift;
+    const uint64_t distance = upper.significand - value.significand;
+    auto integral = static_cast<uint32_t>(upper.significand >> shift);
+    auto fractional = upper.significand & (one - 1);
+    auto kappa = countDecimalDigits(integral);
+    *length = 0;
+    while (kappa > 0) {
+        auto divisor = static_cast<uint32_t>(POWERS_OF_TEN[kappa - 1]);
+        auto digit = integral / divisor;
+        integral %= divisor;
+        if (digit || *length) {
+            digits[(*length)++] = static_cast<char>('0' + digit);
+        }
+        kappa--;
+        auto rest = (static_cast<uint64_t>(integral) << shift) + fractional;
+        if (rest <= delta) {
+            *decimalExponent += kappa;
+            roundLastDigit(digits, *length, delta, rest, POWERS_OF_TEN[kappa] << shift, distance);
+            return;
+        }
+    }
+    while (true) {
+        fractional *= 10;
+        delta *= 10;
+        auto digit = static_cast<char>(fractional >> shift);
+        if (digit || *length) {
+            digits[(*length)++] = static_cast<char>('0' + digit);
+        }
+        fractional &= one - 1;
+        kappa--;
+        if (fractional < delta) {
+            *decimalExponent += kappa;
+            auto index = -kappa;
+            roundLastDigit(digits, *length, delta, fractional, one, distance * (index < 20 ? POWERS_OF_TEN[index] : 0));
+            return;
+        }
+    }
+}
+
+/**
+ * Write digits in fixed or scientific notation.
+ *
+ * @param digits The significant digits.
+ * @param length The number of significant digits.
+ * @param decimalExponent The decimal exponent of the last digit.
+ * @param[out] out The buffer to write to.
+ * @return The number of characters written to @c out.
+ */
+static size_t writeDecimal(const char* digits, int length, int decimalExponent, char* out) {
+    // The exponent of the first digit, as it would be written in scientific notation.
+    auto exponent = length + decimalExponent - 1;
+    auto start = out;
+    if (exponent >= MIN_FIXED_EXPONENT && exponent < MAX_FIXED_EXPONENT) {
+        if (exponent >= length - 1) {
+            memcpy(out, digits, length);
+            out += length;
+            memset(out, '0', exponent - length + 1);
+            out += exponent - length + 1;
+        } else if (exponent >= 0) {
+            memcpy(out, digits, exponent + 1);
+            out += exponent + 1;
+            *out++ = '.';
+            memcpy(out, digits + exponent + 1, length - exponent - 1);
+            out += length - exponent - 1;
+        } else {
+            *out++ = '0';
+            *out++ = '.';
+            memset(out, '0', -exponent - 1);
+            out += -exponent - 1;
+            memcpy(out, digits, length);
+            out += length;
+        }
+        return out - start;
+    }
+    *out++ = digits[0];
+    if (length > 1) {
+        *out++ = '.';
+        memcpy(out, digits + 1, length - 1);
+        out += length - 1;
+    }
+    *out++ = 'e';
+    *out++ = exponent < 0 ? '-' : '+';
+    auto magnitude = static_cast<uint64_t>(exponent < 0 ? -exponent : exponent);
+    // As printf() does, write at least two digits of exponent.
+    if (magnitude < 10) {
+        *out++ = '0';
+    }
+    out += formatUint64(magnitude, out);
+    return out - start;
+}
+
+/**
+ * Format a floating point value with the fewest significant digits that read back as the same value.
+ *
+ * @tparam Type The floating point type.
+ * @param value The value to format.
+ * @param[out] out The buffer to write to.
+ * @return The number of characters written to @c out.
+ */
+template <typename Type>
+static size_t formatFloatingPoint(Type value, char* out) {
+    auto start = out;
+    if (std::signbit(value)) {
+        *out++ = '-';
+        value = -value;
+    }
+    if (std::isnan(value)) {
+        memcpy(out, "nan", 3);
+        return out + 3 - start;
+    }
+    if (std::isinf(value)) {
+        memcpy(out, "inf", 3);
+        return out + 3 - start;
+    }
+    if (0 == value) {
+        *out++ = '0';
+        return out - start;
+    }
+    DiyFp lower;
+    DiyFp upper;
+    auto normalized = decompose(value, &lower, &upper);
+    int decimalExponent;
+    auto cachedPower = getCachedPower(upper.exponent, &decimalExponent);
+    auto scaled = multiply(normalized, cachedPower);
+    auto scaledLower = multiply(lower, cachedPower);
+    auto scaledUpper = multiply(upper, cachedPower);
+    // Narrow the boundaries by the possible error of the multiplications, so that the result is always in range.
+    scaledLower.significand++;
+    scaledUpper.significand--;
+    char digits[MAX_SIGNIFICANT_DIGITS];
+    int length;
+    generateDigits(
+        scaled, scaledUpper, scaledUpper.significand - scaledLower.significand, digits, &length, &decimalExponent);
+    return out + writeDecimal(digits, length, decimalExponent, out) - start;
+}
+
+size_t formatDouble(double value, char* out) {
+    return formatFloatingPoint(value, out);
+}
+
+size_t formatFloat(float value, char* out) {
+    return formatFloatingPoint(value, out);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
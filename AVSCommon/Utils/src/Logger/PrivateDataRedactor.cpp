@@ -0,0 +1,298 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cctype>
+#include <cstring>
+#include <deque>
+#include <set>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+
+#include "AVSCommon/Utils/Logger/LoggerUtils.h"
+#include "AVSCommon/Utils/Logger/PrivateDataRedactor.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("PrivateDataRedactor");
+
+/// Configuration key for root level "logger" object.
+static const std::string CONFIG_KEY_LOGGER = "logger";
+
+/// Configuration key for the labels to add to the deny list.
+static const std::string CONFIG_KEY_PRIVATE_LABELS = "privateLabels";
+
+/// Configuration key for the hash key, as 32 hex digits.
+static const std::string CONFIG_KEY_HASH_KEY = "privateDataHashKey";
+
+/// The labels that are always on the deny list.
+static const char* BUILT_IN_LABELS[] = {"ssid"};
+
+/// The first half of the hash key used if none is configured.
+static const uint64_t DEFAULT_KEY0 = 0x0706050403020100ULL;
+
+/// The second half of the hash key used if none is configured.
+static const uint64_t DEFAULT_KEY1 = 0x0f0e0d0c0b0a0908ULL;
+
+/// The number of hex digits in each half of the hash key.
+static const size_t KEY_HALF_DIGITS = 16;
+
+/// The state the automaton starts in.
+static const uint32_t ROOT_STATE = 0;
+
+/// Marks a transition that is not yet known while the automaton is being built.
+static const uint32_t NO_STATE = 0xffffffff;
+
+/// Set in a transition to a state that means a label has just ended.
+static const uint32_t ACCEPTING_BIT = 0x80000000;
+
+/**
+ * Fold the case of a byte.
+ *
+ * @param c The byte.
+ * @return @c c in lower case, if it is an upper case letter.
+ */
+static uint8_t foldCase(uint8_t c) {
+    return static_cast<uint8_t>(std::tolower(c));
+}
+
+/**
+ * Parse one half of a hash key.
+ *
+ * @param digits The 16 hex digits of the half.
+ * @param[out] out The half.
+ * @return Whether @c digits are all hex digits.
+ */
+static bool parseKeyHalf(const char* digits, uint64_t* out) {
+    uint64_t value = 0;
+    for (size_t ix = 0; ix < KEY_HALF_DIGITS; ix++) {
+        auto c = static_cast<unsigned char>(digits[ix]);
+        if (!std::isxdigit(c)) {
+            return false;
+        }
+        value = (value << 4) | static_cast<uint64_t>(std::isdigit(c) ? c - '0' : std::tolower(c) - 'a' + 10);
+    }
+    *out = value;
+    return true;
+}
+
+/**
+ * Rotate a 64 bit value left.
+ *
+ * @param value The value.
+ * @param bits The number of bits to rotate it by.
+ * @return The rotated value.
+ */
+static inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * One SipRound of SipHash.
+ *
+ * @param v The four words of SipHash state.
+ */
+static inline void sipRound(uint64_t v[4]) {
+    v[0] += v[1];
+    v[1] = rotateLeft(v[1], 13);
+    v[1] ^= v[0];
+    v[0] = rotateLeft(v[0], 32);
+    v[2] += v[3];
+    v[3] = rotateLeft(v[3], 16);
+    v[3] ^= v[2];
+    v[0] += v[3];
+    v[3] = rotateLeft(v[3], 21);
+    v[3] ^= v[0];
+    v[2] += v[1];
+    v[1] = rotateLeft(v[1], 17);
+    v[1] ^= v[2];
+    v[2] = rotateLeft(v[2], 32);
+}
+
+/**
+ * Read eight bytes as a little endian word.
+ *
+ * @param data The bytes.
+ * @return The word.
+ */
+static inline uint64_t readLittleEndian(const unsigned char* data) {
+    uint64_t word = 0;
+    for (int ix = 7; ix >= 0; ix--) {
+        word = (word << 8) | data[ix];
+    }
+    return word;
+}
+
+const PrivateDataRedactor& PrivateDataRedactor::instance() {
+    static const PrivateDataRedactor singleRedactor = [] {
+        auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_LOGGER];
+        std::vector<std::string> labels(std::begin(BUILT_IN_LABELS), std::end(BUILT_IN_LABELS));
+        std::set<std::string> configuredLabels;
+        configuration.getStringValues(CONFIG_KEY_PRIVATE_LABELS, &configuredLabels);
+        labels.insert(labels.end(), configuredLabels.begin(), configuredLabels.end());
+
+        uint64_t key0 = DEFAULT_KEY0;
+        uint64_t key1 = DEFAULT_KEY1;
+        std::string key;
+        if (configuration.getString(CONFIG_KEY_HASH_KEY, &key)) {
+            if (key.size() != 2 * KEY_HALF_DIGITS || !parseKeyHalf(key.data(), &key0) ||
+                !parseKeyHalf(key.data() + KEY_HALF_DIGITS, &key1)) {
+                acsdkError(LogEntry(TAG, "invalidHashKey").m("expected 32 hex digits, using the built in key"));
+                key0 = DEFAULT_KEY0;
+                key1 = DEFAULT_KEY1;
+            }
+        }
+        return PrivateDataRedactor(labels, key0, key1);
+    }();
+    return singleRedactor;
+}
+
+PrivateDataRedactor::PrivateDataRedactor(const std::vector<std::string>& labels, uint64_t key0, uint64_t key1) :
+        m_classCount{1},
+        m_key0{key0},
+        m_key1{key1} {
+    // Give each byte that appears in a label (after folding case) its own class, and every other byte class 0.
+    memset(m_classes, 0, sizeof(m_classes));
+    for (auto& label : labels) {
+        for (auto c : label) {
+            auto folded = foldCase(static_cast<uint8_t>(c));
+            if (0 == m_classes[folded]) {
+                m_classes[folded] = static_cast<uint8_t>(m_classCount++);
+            }
+        }
+    }
+    for (int c = 0; c < 256; c++) {
+        m_classes[c] = m_classes[foldCase(static_cast<uint8_t>(c))];
+    }
+
+    // Build the trie of the labels.
+    m_transitions.assign(m_classCount, NO_STATE);
+    std::vector<bool> accepting(1, false);
+    for (auto& label : labels) {
+        if (label.empty()) {
+            continue;
+        }
+        uint32_t state = ROOT_STATE;
+        for (auto c : label) {
+            auto index = state * m_classCount + m_classes[static_cast<uint8_t>(c)];
+            if (NO_STATE == m_transitions[index]) {
+                m_transitions[index] = static_cast<uint32_t>(accepting.size());
+                accepting.push_back(false);
+                m_transitions.resize(m_transitions.size() + m_classCount, NO_STATE);
+            }
+            state = m_transitions[index];
+        }
+        accepting[state] = true;
+    }
+
+    /*
+     * Turn the trie in to a deterministic automaton, breadth first, so that each state's failure state (the state of
+     * the longest proper suffix of its path that is also in the trie) is complete before the state is visited.
+     */
+    std::vector<uint32_t> failure(accepting.size(), ROOT_STATE);
+    std::deque<uint32_t> queue;
+    for (size_t c = 0; c < m_classCount; c++) {
+        auto& next = m_transitions[c];
+        if (NO_STATE == next) {
+            next = ROOT_STATE;
+        } else {
+            queue.push_back(next);
+        }
+    }
+    while (!queue.empty()) {
+        auto state = queue.front();
+        queue.pop_front();
+        for (size_t c = 0; c < m_classCount; c++) {
+            auto& next = m_transitions[state * m_classCount + c];
+            auto fallback = m_transitions[failure[state] * m_classCount + c];
+            if (NO_STATE == next) {
+                next = fallback;
+            } else {
+                failure[next] = fallback;
+                if (accepting[fallback]) {
+                    accepting[next] = true;
+                }
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // Refer to states by the offset of their transitions, and mark those that end a label, for the scan.
+    for (auto& next : m_transitions) {
+        next = (next * m_classCount) | (accepting[next] ? ACCEPTING_BIT : 0);
+    }
+}
+
+size_t PrivateDataRedactor::findLabelEnd(const char* data, size_t length) const {
+    uint32_t offset = ROOT_STATE;
+    for (size_t ix = 0; ix < length; ix++) {
+        offset = m_transitions[offset + m_classes[static_cast<uint8_t>(data[ix])]];
+        if (offset & ACCEPTING_BIT) {
+            return ix + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+uint64_t PrivateDataRedactor::hash(const char* data, size_t length) const {
+    uint64_t v[4] = {m_key0 ^ 0x736f6d6570736575ULL,
+                     m_key1 ^ 0x646f72616e646f6dULL,
+                     m_key0 ^ 0x6c7967656e657261ULL,
+                     m_key1 ^ 0x7465646279746573ULL};
+    auto bytes = reinterpret_cast<const unsigned char*>(data);
+    auto end = bytes + (length & ~static_cast<size_t>(7));
+    for (; bytes != end; bytes += 8) {
+        auto word = readLittleEndian(bytes);
+        v[3] ^= word;
+        sipRound(v);
+        sipRound(v);
+        v[0] ^= word;
+    }
+    uint64_t last = static_cast<uint64_t>(length) << 56;
+    for (size_t ix = 0; ix < (length & 7); ix++) {
+        last |= static_cast<uint64_t>(bytes[ix]) << (8 * ix);
+    }
+    v[3] ^= last;
+    sipRound(v);
+    sipRound(v);
+    v[0] ^= last;
+    v[2] ^= 0xff;
+    for (int round = 0; round < 4; round++) {
+        sipRound(v);
+    }
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+bool PrivateDataRedactor::redact(const std::string& value, std::string* out) const {
+    auto labelEnd = findLabelEnd(value.data(), value.size());
+    if (std::string::npos == labelEnd) {
+        return false;
+    }
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    auto digest = hash(value.data() + labelEnd, value.size() - labelEnd);
+    out->assign(value, 0, labelEnd);
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        out->push_back(HEX_DIGITS[(digest >> shift) & 0xf]);
+    }
+    return true;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,15 +13,20 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <atomic>
-#include <iomanip>
+#include <cstdio>
+#include <cstring>
 #include <mutex>
-#include <sstream>
 #include <thread>
 #include <unordered_map>
 
 #include "AVSCommon/Utils/Logger/ThreadMoniker.h"
 
+#if defined(ACSDK_SET_OS_THREAD_NAMES) && defined(__linux__)
+#include <pthread.h>
+#endif
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
@@ -30,13 +35,37 @@ namespace logger {
 /// Counter to generate (small) unique thread monikers.
 static std::atomic<int> g_nextThreadMoniker(1);
 
-ThreadMoniker::ThreadMoniker(const std::string& moniker) : m_moniker{moniker.empty() ? generateMoniker() : moniker} {
+/// Format string for generated monikers: the counter in hex, right aligned in 3 characters.
+static const char* GENERATED_MONIKER_FORMAT = "%3x";
+
+#if defined(ACSDK_SET_OS_THREAD_NAMES) && defined(__linux__)
+/// Maximum length of a thread name on Linux, not including the null terminator.
+static const size_t MAX_OS_THREAD_NAME_LENGTH = 15;
+#endif
+
+constexpr size_t ThreadMoniker::MAX_MONIKER_LENGTH;
+
+ThreadMoniker::ThreadMoniker(const std::string& moniker) {
+    if (moniker.empty()) {
+        snprintf(m_moniker, sizeof(m_moniker), GENERATED_MONIKER_FORMAT, g_nextThreadMoniker++);
+        return;
+    }
+    auto length = std::min(moniker.size(), MAX_MONIKER_LENGTH);
+    memcpy(m_moniker, moniker.data(), length);
+    m_moniker[length] = '\0';
+#if defined(ACSDK_SET_OS_THREAD_NAMES) && defined(__linux__)
+    char osThreadName[MAX_OS_THREAD_NAME_LENGTH + 1];
+    auto osThreadNameLength = std::min(length, MAX_OS_THREAD_NAME_LENGTH);
+    memcpy(osThreadName, m_moniker, osThreadNameLength);
+    osThreadName[osThreadNameLength] = '\0';
+    pthread_setname_np(pthread_self(), osThreadName);
+#endif
 }
 
 std::string ThreadMoniker::generateMoniker() {
-    std::ostringstream stream;
-    stream << std::setw(3) << std::hex << std::right << g_nextThreadMoniker++;
-    return stream.str();
+    char moniker[MAX_MONIKER_LENGTH + 1];
+    snprintf(moniker, sizeof(moniker), GENERATED_MONIKER_FORMAT, g_nextThreadMoniker++);
+    return moniker;
 }
 
 const ThreadMoniker& ThreadMoniker::getMonikerObjectFromMap(const std::string& moniker) {
@@ -15,45 +15,122 @@
 
 #include "AVSCommon/Utils/Timing/SafeCTimeAccess.h"
 
+#include <cstdint>
+#include <limits>
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace timing {
 
+/// Number of seconds per day.
+static const std::time_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+/// Number of seconds per hour.
+static const int SECONDS_PER_HOUR = 60 * 60;
+
+/// Number of seconds per minute.
+static const int SECONDS_PER_MINUTE = 60;
+
+/// Number of days in a 400 year cycle of the Gregorian calendar.
+static const int64_t DAYS_PER_ERA = 146097;
+
+/// Number of days from 0000-03-01 (the start of the era containing the epoch) to 1970-01-01.
+static const int64_t DAYS_FROM_ERA_START_TO_EPOCH = 719468;
+
+/// Day of the week of 1970-01-01 (a Thursday), with Sunday as 0.
+static const int EPOCH_WEEKDAY = 4;
+
+/// Offset between a calendar year and the value of @c std::tm::tm_year.
+static const int64_t TM_YEAR_BASE = 1900;
+
+/// Cumulative days before the start of each month (0 = January) in a non-leap year.
+static const int DAYS_BEFORE_MONTH[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+/**
+ * Divide, rounding towards negative infinity.
+ *
+ * @param numerator The numerator.
+ * @param denominator The denominator.  Must be positive.
+ * @return The quotient, rounded towards negative infinity.
+ */
+static int64_t floorDivide(int64_t numerator, int64_t denominator) {
+    return numerator / denominator - (numerator % denominator < 0 ? 1 : 0);
+}
+
+/**
+ * Check whether a year of the proleptic Gregorian calendar is a leap year.
+ *
+ * @param year The year to check.
+ * @return Whether @c year is a leap year.
+ */
+static bool isLeapYear(int64_t year) {
+    return (0 == year % 4 && 0 != year % 100) || 0 == year % 400;
+}
+
 std::shared_ptr<SafeCTimeAccess> SafeCTimeAccess::instance() {
     static std::shared_ptr<SafeCTimeAccess> s_safeCTimeAccess(new SafeCTimeAccess);
     return s_safeCTimeAccess;
 }
 
-bool SafeCTimeAccess::safeAccess(
-    std::tm* (*timeAccessFunction)(const std::time_t* time),
-    const std::time_t& time,
-    std::tm* calendarTime) {
+SafeCTimeAccess::SafeCTimeAccess() {
+#ifdef _WIN32
+    _tzset();
+#else
+    tzset();
+#endif
+}
+
+bool SafeCTimeAccess::getGmtime(const std::time_t& time, std::tm* calendarTime) {
     // No logging on errors, because it's known that logging calls this function, which can cause recursion problems.
 
     if (!calendarTime) {
         return false;
     }
 
-    bool succeeded = false;
-    {
-        std::lock_guard<std::mutex> lock{m_timeLock};
-        auto tempCalendarTime = timeAccessFunction(&time);
-        if (tempCalendarTime) {
-            *calendarTime = *tempCalendarTime;
-            succeeded = true;
-        }
-    }
+    // Split into days since the epoch and seconds within the day.
+    auto days = floorDivide(time, SECONDS_PER_DAY);
+    auto secondsOfDay = static_cast<int>(time - days * SECONDS_PER_DAY);
 
-    return succeeded;
-}
+    // Convert days since the epoch to a civil date.  Years are counted from March so that leap days fall at the end.
+    auto daysSinceEraStart = days + DAYS_FROM_ERA_START_TO_EPOCH;
+    auto era = floorDivide(daysSinceEraStart, DAYS_PER_ERA);
+    auto dayOfEra = daysSinceEraStart - era * DAYS_PER_ERA;
+    auto yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    auto dayOfYearFromMarch = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    auto monthFromMarch = (5 * dayOfYearFromMarch + 2) / 153;
+    auto dayOfMonth = dayOfYearFromMarch - (153 * monthFromMarch + 2) / 5 + 1;
+    auto month = monthFromMarch < 10 ? monthFromMarch + 2 : monthFromMarch - 10;
+    auto year = yearOfEra + era * 400 + (month < 2 ? 1 : 0);
 
-bool SafeCTimeAccess::getGmtime(const std::time_t& time, std::tm* calendarTime) {
-    return safeAccess(std::gmtime, time, calendarTime);
+    auto tmYear = year - TM_YEAR_BASE;
+    if (tmYear < std::numeric_limits<int>::min() || tmYear > std::numeric_limits<int>::max()) {
+        return false;
+    }
+
+    *calendarTime = std::tm();
+    calendarTime->tm_sec = secondsOfDay % SECONDS_PER_MINUTE;
+    calendarTime->tm_min = secondsOfDay % SECONDS_PER_HOUR / SECONDS_PER_MINUTE;
+    calendarTime->tm_hour = secondsOfDay / SECONDS_PER_HOUR;
+    calendarTime->tm_mday = static_cast<int>(dayOfMonth);
+    calendarTime->tm_mon = static_cast<int>(month);
+    calendarTime->tm_year = static_cast<int>(tmYear);
+    calendarTime->tm_wday = static_cast<int>(days - floorDivide(days + EPOCH_WEEKDAY, 7) * 7 + EPOCH_WEEKDAY);
+    calendarTime->tm_yday =
+        DAYS_BEFORE_MONTH[month] + static_cast<int>(dayOfMonth) - 1 + (month > 1 && isLeapYear(year) ? 1 : 0);
+    calendarTime->tm_isdst = 0;
+    return true;
 }
 
 bool SafeCTimeAccess::getLocaltime(const std::time_t& time, std::tm* calendarTime) {
-    return safeAccess(std::localtime, time, calendarTime);
+    if (!calendarTime) {
+        return false;
+    }
+#ifdef _WIN32
+    return 0 == localtime_s(calendarTime, &time);
+#else
+    return nullptr != localtime_r(&time, calendarTime);
+#endif
 }
 
 }  // namespace timing
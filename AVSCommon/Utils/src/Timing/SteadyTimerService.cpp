@@ -0,0 +1,84 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/SteadyTimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// The number of service threads of the shared service.
+static const size_t SERVICE_THREAD_COUNT = 2;
+
+std::shared_ptr<SteadyTimerService> SteadyTimerService::instance() {
+    static auto service = new std::shared_ptr<SteadyTimerService>(new SteadyTimerService(SERVICE_THREAD_COUNT));
+    return *service;
+}
+
+SteadyTimerService::SteadyTimerService(size_t threadCount) : m_hasLeader{false} {
+    for (size_t ix = 0; ix < threadCount; ix++) {
+        m_threads.emplace_back(&SteadyTimerService::serviceLoop, this);
+    }
+}
+
+std::chrono::nanoseconds SteadyTimerService::now() const {
+    return std::chrono::steady_clock::now().time_since_epoch();
+}
+
+void SteadyTimerService::onWakeupChangedLocked() {
+    if (m_hasLeader) {
+        m_wheelCondition.notify_one();
+    } else {
+        m_workCondition.notify_one();
+    }
+}
+
+void SteadyTimerService::serviceLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        if (runReadyLocked(lock)) {
+            continue;
+        }
+
+        if (m_hasLeader) {
+            m_workCondition.wait(lock);
+            continue;
+        }
+
+        m_hasLeader = true;
+        m_plannedWakeup = getNextWakeupLocked();
+        if (NEVER == m_plannedWakeup) {
+            m_wheelCondition.wait(lock);
+        } else {
+            m_wheelCondition.wait_until(
+                lock,
+                std::chrono::steady_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_plannedWakeup)));
+        }
+        m_hasLeader = false;
+        m_plannedWakeup = NEVER;
+
+        collectDueLocked(now());
+        if (hasReadyLocked()) {
+            m_workCondition.notify_all();
+        }
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
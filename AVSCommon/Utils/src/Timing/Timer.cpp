@@ -0,0 +1,74 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Timing/Timer.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("Timer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+Timer::Timer(std::shared_ptr<sdkInterfaces::timing::TimerDelegateFactoryInterface> timerDelegateFactory) {
+    if (timerDelegateFactory) {
+        m_timer = timerDelegateFactory->getTimerDelegate();
+    }
+    if (!m_timer) {
+        ACSDK_ERROR(LX("TimerFailed").d("reason", "nullTimerDelegate"));
+    }
+}
+
+Timer::~Timer() {
+    stop();
+}
+
+void Timer::stop() {
+    if (!m_timer) {
+        return;
+    }
+    m_timer->stop();
+
+    // No call can start now, so release what the task holds.  A call that is still running, because stop() was called
+    // from the task, drops its task when it returns, because the generation no longer matches.
+    functional::InlineTask task;
+    {
+        std::lock_guard<std::mutex> lock(m_taskMutex);
+        ++m_taskGeneration;
+        task = std::move(m_task);
+    }
+}
+
+bool Timer::isActive() const {
+    return m_timer && m_timer->isActive();
+}
+
+bool Timer::activate() {
+    return m_timer && m_timer->activate();
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
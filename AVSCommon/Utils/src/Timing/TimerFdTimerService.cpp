@@ -0,0 +1,195 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AVSCommon/Utils/Timing/TimerFdTimerService.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerFdTimerService");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// The number of file descriptors the service waits on.
+static const int EVENT_COUNT = 2;
+
+/// The number of service threads.
+static const size_t SERVICE_THREAD_COUNT = 2;
+
+/// The value of an invalid file descriptor.
+static const int INVALID_FD = -1;
+
+std::shared_ptr<TimerFdTimerService> TimerFdTimerService::instance() {
+    static auto service = [] {
+        std::shared_ptr<TimerFdTimerService> created(new TimerFdTimerService());
+        std::string error;
+        if (!created->init(SERVICE_THREAD_COUNT, &error)) {
+            ACSDK_ERROR(LX("instanceFailed").d("reason", error).d("error", strerror(errno)));
+            created.reset();
+        }
+        return new std::shared_ptr<TimerFdTimerService>(created);
+    }();
+    return *service;
+}
+
+TimerFdTimerService::TimerFdTimerService() :
+        m_epollFd{INVALID_FD},
+        m_timerFd{INVALID_FD},
+        m_eventFd{INVALID_FD},
+        m_hasLeader{false} {
+}
+
+bool TimerFdTimerService::init(size_t threadCount, std::string* error) {
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFd < 0) {
+        *error = "epollCreateFailed";
+        return false;
+    }
+    m_timerFd = timerfd_create(CLOCK_BOOTTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (m_timerFd < 0) {
+        *error = "timerFdCreateFailed";
+        close(m_epollFd);
+        return false;
+    }
+    m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_eventFd < 0) {
+        *error = "eventFdCreateFailed";
+        close(m_timerFd);
+        close(m_epollFd);
+        return false;
+    }
+    for (auto fd : {m_timerFd, m_eventFd}) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            *error = "epollAddFailed";
+            close(m_eventFd);
+            close(m_timerFd);
+            close(m_epollFd);
+            return false;
+        }
+    }
+    for (size_t ix = 0; ix < threadCount; ix++) {
+        m_threads.emplace_back(&TimerFdTimerService::serviceLoop, this);
+    }
+    return true;
+}
+
+std::chrono::nanoseconds TimerFdTimerService::now() const {
+    timespec time{};
+    clock_gettime(CLOCK_BOOTTIME, &time);
+    return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+}
+
+bool TimerFdTimerService::supportsLowPowerMode() const {
+    return true;
+}
+
+void TimerFdTimerService::onWakeupChangedLocked() {
+    if (!m_hasLeader) {
+        m_workCondition.notify_one();
+        return;
+    }
+    uint64_t value = 1;
+    if (write(m_eventFd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+        ACSDK_ERROR(LX("onWakeupChangedFailed").d("reason", "writeFailed").d("error", strerror(errno)));
+    }
+}
+
+void TimerFdTimerService::armLocked(std::chrono::nanoseconds time) {
+    itimerspec spec{};
+    if (time != NEVER) {
+        // A zero it_value disarms the timerfd, so a wakeup at the epoch is made at the first nanosecond instead.
+        time = std::max(time, std::chrono::nanoseconds(1));
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time);
+        spec.it_value.tv_sec = static_cast<time_t>(seconds.count());
+        spec.it_value.tv_nsec = static_cast<long>((time - seconds).count());
+    }
+    if (timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+        ACSDK_ERROR(LX("armFailed").d("reason", "setTimeFailed").d("error", strerror(errno)));
+    }
+}
+
+void TimerFdTimerService::serviceLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        if (runReadyLocked(lock)) {
+            continue;
+        }
+
+        if (m_hasLeader) {
+            m_workCondition.wait(lock);
+            continue;
+        }
+
+        m_hasLeader = true;
+        // The timerfd stays armed while no thread waits on it, so it only needs arming if the wakeup changed.
+        auto wakeup = getNextWakeupLocked();
+        if (wakeup != m_plannedWakeup) {
+            armLocked(wakeup);
+            m_plannedWakeup = wakeup;
+        }
+        lock.unlock();
+        waitForWakeup();
+        lock.lock();
+        m_hasLeader = false;
+
+        collectDueLocked(now());
+        if (hasReadyLocked()) {
+            m_workCondition.notify_all();
+        }
+    }
+}
+
+void TimerFdTimerService::waitForWakeup() {
+    epoll_event events[EVENT_COUNT];
+    auto count = epoll_wait(m_epollFd, events, EVENT_COUNT, -1);
+    if (count < 0 && errno != EINTR) {
+        ACSDK_ERROR(LX("waitForWakeupFailed").d("reason", "epollWaitFailed").d("error", strerror(errno)));
+    }
+    for (int ix = 0; ix < count; ix++) {
+        // Both descriptors hold a counter, which is reset by reading it.
+        uint64_t value;
+        if (read(events[ix].data.fd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+            ACSDK_ERROR(LX("waitForWakeupFailed").d("reason", "readFailed").d("error", strerror(errno)));
+        }
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,396 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <thread>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerService");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// The value of @c maxCount which means to call the task until the timer is stopped.
+static const size_t FOREVER = 0;
+
+/// The resolution of the wheels.  Deadlines are rounded up to it.
+static const std::chrono::nanoseconds WHEEL_RESOLUTION = std::chrono::milliseconds(1);
+
+/// A function that does nothing with the nodes that a wheel advances past.
+static void ignoreNode(TimerWheel::Node*) {
+}
+
+const std::chrono::nanoseconds TimerService::NEVER = std::chrono::nanoseconds::max();
+
+/**
+ * Add a delay to a time, saturating rather than overflowing.
+ *
+ * @param time The time.
+ * @param delay The non-negative delay.
+ * @return The time plus the delay, or the latest time there is.
+ */
+static std::chrono::nanoseconds addDelay(std::chrono::nanoseconds time, std::chrono::nanoseconds delay) {
+    if (delay > std::chrono::nanoseconds::max() - time) {
+        return std::chrono::nanoseconds::max();
+    }
+    return time + delay;
+}
+
+/**
+ * Get the last tick of the wheels at or before a time.
+ *
+ * @param time The time.
+ * @return The tick.
+ */
+static uint64_t toElapsedTick(std::chrono::nanoseconds time) {
+    return time.count() <= 0 ? 0 : static_cast<uint64_t>(time / WHEEL_RESOLUTION);
+}
+
+struct TimerService::Entry : public std::enable_shared_from_this<Entry> {
+    /// Constructor.
+    Entry();
+
+    /// Serializes access to the members below, apart from those guarded by the mutex of the service.
+    std::mutex mutex;
+
+    /// Notified when a call of the task completes.
+    std::condition_variable idleCondition;
+
+    /// Whether the timer is active.
+    bool active;
+
+    /// Whether a call of the task is in progress.
+    bool running;
+
+    /// The thread making the call of the task in progress.
+    std::thread::id runningThread;
+
+    /// Whether a call fell due while an earlier call was still in progress, and is left for that call to make.
+    bool deferred;
+
+    /// The generation of the call left for the call in progress to make, if @c deferred.
+    uint64_t deferredGeneration;
+
+    /// Incremented by every @c start() and @c stop(), so that a call scheduled before either is not made.
+    uint64_t generation;
+
+    /// The time between calls.
+    std::chrono::nanoseconds period;
+
+    /// How @c period is measured.
+    PeriodType periodType;
+
+    /// The number of calls to make, or @c FOREVER.
+    size_t maxCount;
+
+    /// The number of calls made.
+    size_t count;
+
+    /// How late a call may be made.
+    std::chrono::nanoseconds slack;
+
+    /// The task.  Moved out while a call is in progress, so that the task may restart the timer.
+    functional::InlineTask task;
+
+    /// The time the next call is due.
+    std::chrono::nanoseconds deadline;
+
+    /// The node of the timer in @c m_dueWheel.  Guarded by the mutex of the service.
+    TimerNode dueNode;
+
+    /// The node of the timer in @c m_wakeupWheel.  Guarded by the mutex of the service.
+    TimerNode wakeupNode;
+
+    /// The @c generation the timer was last scheduled with.  Guarded by the mutex of the service.
+    uint64_t scheduledGeneration;
+
+    /// The @c deadline the timer was last scheduled with.  Guarded by the mutex of the service.
+    std::chrono::nanoseconds scheduledDeadline;
+
+    /// The order in which the timer was last scheduled, among all the timers of the service.  Guarded by the mutex of
+    /// the service.
+    uint64_t scheduledSequence;
+};
+
+TimerService::Entry::Entry() :
+        active{false},
+        running{false},
+        deferred{false},
+        deferredGeneration{0},
+        generation{0},
+        period{0},
+        periodType{PeriodType::ABSOLUTE},
+        maxCount{FOREVER},
+        count{0},
+        slack{0},
+        deadline{0},
+        scheduledGeneration{0},
+        scheduledDeadline{0},
+        scheduledSequence{0} {
+    dueNode.timer = this;
+    wakeupNode.timer = this;
+}
+
+TimerService::TimerService() :
+        m_plannedWakeup{NEVER},
+        m_dueWheel{WHEEL_RESOLUTION},
+        m_wakeupWheel{WHEEL_RESOLUTION},
+        m_readyHead{0},
+        m_sequence{0} {
+}
+
+TimerService::~TimerService() {
+}
+
+std::shared_ptr<TimerService::Entry> TimerService::createTimer() {
+    return std::make_shared<Entry>();
+}
+
+void TimerService::start(
+    const std::shared_ptr<Entry>& timer,
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    functional::InlineTask task) {
+    if (!task) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "nullTask"));
+        stop(timer);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    timer->generation++;
+    timer->active = true;
+    timer->period = period;
+    timer->periodType = periodType;
+    timer->maxCount = maxCount;
+    timer->count = 0;
+    timer->task = std::move(task);
+    timer->deadline = addDelay(now(), delay);
+    schedule(timer.get());
+}
+
+void TimerService::stop(const std::shared_ptr<Entry>& timer) {
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    timer->generation++;
+    timer->active = false;
+    timer->task = nullptr;
+    cancel(timer.get());
+
+    // Wait for a call in progress to complete, unless this is called from the task itself.
+    auto self = std::this_thread::get_id();
+    timer->idleCondition.wait(lock, [&timer, self] { return !timer->running || timer->runningThread == self; });
+}
+
+bool TimerService::activate(const std::shared_ptr<Entry>& timer) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    if (timer->active) {
+        return false;
+    }
+    timer->active = true;
+    return true;
+}
+
+bool TimerService::isActive(const std::shared_ptr<Entry>& timer) const {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    return timer->active;
+}
+
+void TimerService::setSlack(const std::shared_ptr<Entry>& timer, std::chrono::nanoseconds slack) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    timer->slack = std::max(slack, std::chrono::nanoseconds::zero());
+}
+
+bool TimerService::supportsLowPowerMode() const {
+    return false;
+}
+
+std::chrono::nanoseconds TimerService::getNextWakeupLocked() const {
+    auto tick = m_wakeupWheel.getNextTick();
+    if (TimerWheel::NO_TICK == tick || tick >= static_cast<uint64_t>(NEVER / WHEEL_RESOLUTION)) {
+        return NEVER;
+    }
+    return WHEEL_RESOLUTION * static_cast<int64_t>(tick);
+}
+
+void TimerService::collectDueLocked(std::chrono::nanoseconds time) {
+    auto tick = toElapsedTick(time);
+    auto firstDue = m_ready.size();
+    m_dueWheel.advance(tick, [this](TimerWheel::Node* node) {
+        auto timer = static_cast<TimerNode*>(node)->timer;
+        if (timer->wakeupNode.isLinked()) {
+            m_wakeupWheel.remove(&timer->wakeupNode);
+        }
+        m_ready.emplace_back(timer->shared_from_this(), timer->scheduledGeneration);
+    });
+    // The wheel keeps whole ticks, so put the calls that fell due together in the order of their deadlines.
+    std::sort(
+        m_ready.begin() + firstDue,
+        m_ready.end(),
+        [](const std::pair<std::shared_ptr<Entry>, uint64_t>& lhs,
+           const std::pair<std::shared_ptr<Entry>, uint64_t>& rhs) {
+            if (lhs.first->scheduledDeadline != rhs.first->scheduledDeadline) {
+                return lhs.first->scheduledDeadline < rhs.first->scheduledDeadline;
+            }
+            return lhs.first->scheduledSequence < rhs.first->scheduledSequence;
+        });
+    // Every timer that may wake up by now is also due by now, so this only moves the wheel along.
+    m_wakeupWheel.advance(tick, ignoreNode);
+}
+
+bool TimerService::hasReadyLocked() const {
+    return m_readyHead < m_ready.size();
+}
+
+bool TimerService::runReadyLocked(std::unique_lock<std::mutex>& lock) {
+    if (!hasReadyLocked()) {
+        return false;
+    }
+    auto ready = std::move(m_ready[m_readyHead++]);
+    if (m_readyHead == m_ready.size()) {
+        m_ready.clear();
+        m_readyHead = 0;
+    }
+    lock.unlock();
+    call(ready.first, ready.second);
+    ready.first.reset();
+    lock.lock();
+    return true;
+}
+
+void TimerService::schedule(Entry* timer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    unlinkLocked(timer);
+    if (0 == m_dueWheel.size()) {
+        // Bring idle wheels up to date, so that the timer is placed relative to the present.
+        auto tick = toElapsedTick(now());
+        m_dueWheel.advance(tick, ignoreNode);
+        m_wakeupWheel.advance(tick, ignoreNode);
+    }
+    timer->scheduledGeneration = timer->generation;
+    timer->scheduledDeadline = timer->deadline;
+    timer->scheduledSequence = m_sequence++;
+    m_dueWheel.insert(&timer->dueNode, toTick(timer->deadline));
+    auto wakeup = addDelay(timer->deadline, timer->slack);
+    m_wakeupWheel.insert(&timer->wakeupNode, toTick(wakeup));
+    if (wakeup < m_plannedWakeup) {
+        onWakeupChangedLocked();
+    }
+}
+
+void TimerService::cancel(Entry* timer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    unlinkLocked(timer);
+}
+
+void TimerService::unlinkLocked(Entry* timer) {
+    if (timer->dueNode.isLinked()) {
+        m_dueWheel.remove(&timer->dueNode);
+    }
+    if (timer->wakeupNode.isLinked()) {
+        m_wakeupWheel.remove(&timer->wakeupNode);
+    }
+}
+
+void TimerService::call(const std::shared_ptr<Entry>& timer, uint64_t generation) {
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    if (!timer->active || timer->generation != generation) {
+        return;
+    }
+    if (timer->running) {
+        // The task restarted the timer and has not returned yet.  Leave the call to that thread, so that the calls
+        // of the timer never overlap and stop() waits for both.
+        timer->deferred = true;
+        timer->deferredGeneration = generation;
+        return;
+    }
+    timer->running = true;
+    timer->runningThread = std::this_thread::get_id();
+    auto task = std::move(timer->task);
+    lock.unlock();
+
+    task();
+
+    lock.lock();
+    while (!timer->active || timer->generation != generation) {
+        // Stopped or restarted during the call; make a call of the new generation that fell due meanwhile.
+        if (!timer->deferred || !timer->active || timer->generation != timer->deferredGeneration) {
+            timer->deferred = false;
+            timer->running = false;
+            timer->idleCondition.notify_all();
+            return;
+        }
+        timer->deferred = false;
+        generation = timer->deferredGeneration;
+        task = std::move(timer->task);
+        lock.unlock();
+
+        task();
+
+        lock.lock();
+    }
+    timer->running = false;
+    timer->idleCondition.notify_all();
+    timer->count++;
+    if (timer->maxCount != FOREVER && timer->count >= timer->maxCount) {
+        timer->active = false;
+        return;
+    }
+    timer->task = std::move(task);
+
+    auto time = now();
+    if (PeriodType::RELATIVE == timer->periodType) {
+        timer->deadline = addDelay(time, timer->period);
+    } else {
+        timer->deadline = addDelay(timer->deadline, timer->period);
+        if (timer->deadline < time) {
+            // Skip the calls that were missed while the task ran.
+            if (timer->period.count() > 0) {
+                auto missed = (time - timer->deadline) / timer->period + 1;
+                timer->deadline = addDelay(timer->deadline, timer->period * missed);
+            } else {
+                timer->deadline = time;
+            }
+        }
+    }
+    schedule(timer.get());
+}
+
+uint64_t TimerService::toTick(std::chrono::nanoseconds time) {
+    if (time.count() <= 0) {
+        return 0;
+    }
+    auto tick = time / WHEEL_RESOLUTION;
+    return static_cast<uint64_t>(tick * WHEEL_RESOLUTION < time ? tick + 1 : tick);
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,272 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+constexpr uint64_t TimerWheel::NO_TICK;
+constexpr int TimerWheel::FIRST_LEVEL_BITS;
+constexpr int TimerWheel::UPPER_LEVEL_BITS;
+constexpr int TimerWheel::LEVEL_COUNT;
+constexpr int TimerWheel::FIRST_LEVEL_SIZE;
+constexpr int TimerWheel::UPPER_LEVEL_SIZE;
+constexpr int TimerWheel::SLOT_COUNT;
+constexpr int TimerWheel::FIRST_LEVEL_WORDS;
+constexpr int32_t TimerWheel::NOT_LINKED;
+
+/// The furthest ahead of the next tick that the top level reaches.
+static const uint64_t MAX_DISTANCE = (static_cast<uint64_t>(1) << (8 + 3 * 6)) - 1;
+
+/**
+ * Get the index of the first set bit of a 64 bit word at or after a position.
+ *
+ * @param word The word.
+ * @param from The position.
+ * @return The index of the bit, or -1 if there is none.
+ */
+static int findFirstSet(uint64_t word, int from) {
+    if (from >= 64) {
+        return -1;
+    }
+    word &= ~static_cast<uint64_t>(0) << from;
+    return 0 == word ? -1 : __builtin_ctzll(word);
+}
+
+/**
+ * Get the index of the first set bit of a 64 bit word at or after a position, wrapping around to the start.
+ *
+ * @param word The word, which must not be zero.
+ * @param from The position.
+ * @return The index of the bit.
+ */
+static int findFirstSetCyclic(uint64_t word, int from) {
+    auto bit = findFirstSet(word, from);
+    return bit < 0 ? __builtin_ctzll(word) : bit;
+}
+
+/**
+ * Get the first bit of a level.
+ *
+ * @param level The level.
+ * @return The position in a tick of the bits that index the level.
+ */
+static int getLevelShift(int level) {
+    return 0 == level ? 0 : 8 + (level - 1) * 6;
+}
+
+TimerWheel::Node::Node() : prev{nullptr}, next{nullptr}, tick{0}, slot{NOT_LINKED} {
+}
+
+bool TimerWheel::Node::isLinked() const {
+    return slot != NOT_LINKED;
+}
+
+TimerWheel::TimerWheel(std::chrono::nanoseconds resolution, Clock::time_point start) :
+        m_resolution{std::max(resolution, std::chrono::nanoseconds(1))},
+        m_start{start},
+        m_next{0},
+        m_size{0} {
+    std::fill(std::begin(m_slots), std::end(m_slots), nullptr);
+    std::fill(std::begin(m_firstLevelBitmap), std::end(m_firstLevelBitmap), 0);
+    std::fill(std::begin(m_upperLevelBitmaps), std::end(m_upperLevelBitmaps), 0);
+}
+
+uint64_t TimerWheel::toTick(Clock::time_point time) const {
+    if (time <= m_start) {
+        return 0;
+    }
+    auto elapsed = time - m_start;
+    return static_cast<uint64_t>((elapsed + m_resolution - std::chrono::nanoseconds(1)) / m_resolution);
+}
+
+uint64_t TimerWheel::toElapsedTick(Clock::time_point time) const {
+    if (time <= m_start) {
+        return 0;
+    }
+    return static_cast<uint64_t>((time - m_start) / m_resolution);
+}
+
+TimerWheel::Clock::time_point TimerWheel::toTimePoint(uint64_t tick) const {
+    auto maxTick = static_cast<uint64_t>((Clock::time_point::max() - m_start) / m_resolution);
+    if (tick >= maxTick) {
+        return Clock::time_point::max();
+    }
+    return m_start + std::chrono::duration_cast<Clock::duration>(m_resolution * tick);
+}
+
+void TimerWheel::insert(Node* node, uint64_t tick) {
+    node->tick = tick;
+    place(node);
+    m_size++;
+}
+
+void TimerWheel::remove(Node* node) {
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        m_slots[node->slot] = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+    if (!m_slots[node->slot]) {
+        if (node->slot < FIRST_LEVEL_SIZE) {
+            m_firstLevelBitmap[node->slot / 64] &= ~(static_cast<uint64_t>(1) << (node->slot % 64));
+        } else {
+            auto upperSlot = node->slot - FIRST_LEVEL_SIZE;
+            m_upperLevelBitmaps[1 + upperSlot / UPPER_LEVEL_SIZE] &=
+                ~(static_cast<uint64_t>(1) << (upperSlot % UPPER_LEVEL_SIZE));
+        }
+    }
+    node->prev = nullptr;
+    node->next = nullptr;
+    node->slot = NOT_LINKED;
+    m_size--;
+}
+
+size_t TimerWheel::size() const {
+    return m_size;
+}
+
+uint64_t TimerWheel::getNextTick() const {
+    if (0 == m_size) {
+        return NO_TICK;
+    }
+
+    // A node in the first level at or after the current index is due before anything else can happen.
+    auto index = static_cast<int>(m_next & (FIRST_LEVEL_SIZE - 1));
+    uint64_t result = NO_TICK;
+    for (int word = index / 64; word < FIRST_LEVEL_WORDS; word++) {
+        auto bit = findFirstSet(m_firstLevelBitmap[word], word == index / 64 ? index % 64 : 0);
+        if (bit >= 0) {
+            result = m_next + (word * 64 + bit - index);
+            break;
+        }
+    }
+    if (result != NO_TICK && index != 0) {
+        return result;
+    }
+
+    // Otherwise the first level wraps around before its next node, and the upper levels may cascade nodes that are
+    // due earlier in to it.  The first nonempty slot of each upper level cascades no earlier than its nodes are due.
+    auto boundary = 0 == index ? m_next : (m_next | (FIRST_LEVEL_SIZE - 1)) + 1;
+    if (index != 0) {
+        for (int word = 0; word < FIRST_LEVEL_WORDS; word++) {
+            if (m_firstLevelBitmap[word]) {
+                result = boundary + word * 64 + __builtin_ctzll(m_firstLevelBitmap[word]);
+                break;
+            }
+        }
+    }
+    for (int level = 1; level < LEVEL_COUNT; level++) {
+        if (0 == m_upperLevelBitmaps[level]) {
+            continue;
+        }
+        auto shift = getLevelShift(level);
+        auto span = static_cast<uint64_t>(1) << shift;
+        auto base = (boundary + span - 1) >> shift;
+        auto first = static_cast<int>(base & (UPPER_LEVEL_SIZE - 1));
+        auto slot = findFirstSetCyclic(m_upperLevelBitmaps[level], first);
+        auto cascadeTick = (base + ((slot - first) & (UPPER_LEVEL_SIZE - 1))) << shift;
+        result = std::min(result, cascadeTick);
+    }
+    return result;
+}
+
+void TimerWheel::place(Node* node) {
+    auto tick = std::max(node->tick, m_next);
+    auto distance = tick - m_next;
+    int32_t slot = 0;
+    if (distance < static_cast<uint64_t>(FIRST_LEVEL_SIZE)) {
+        slot = static_cast<int32_t>(tick & (FIRST_LEVEL_SIZE - 1));
+        m_firstLevelBitmap[slot / 64] |= static_cast<uint64_t>(1) << (slot % 64);
+    } else {
+        if (distance > MAX_DISTANCE) {
+            tick = m_next + MAX_DISTANCE;
+            distance = MAX_DISTANCE;
+        }
+        int level = 1;
+        while (level < LEVEL_COUNT - 1 && distance >= (static_cast<uint64_t>(1) << getLevelShift(level + 1))) {
+            level++;
+        }
+        auto upperSlot = static_cast<int32_t>((tick >> getLevelShift(level)) & (UPPER_LEVEL_SIZE - 1));
+        m_upperLevelBitmaps[level] |= static_cast<uint64_t>(1) << upperSlot;
+        slot = FIRST_LEVEL_SIZE + (level - 1) * UPPER_LEVEL_SIZE + upperSlot;
+    }
+    node->slot = slot;
+    node->prev = nullptr;
+    node->next = m_slots[slot];
+    if (node->next) {
+        node->next->prev = node;
+    }
+    m_slots[slot] = node;
+}
+
+void TimerWheel::cascade() {
+    for (int level = 1; level < LEVEL_COUNT; level++) {
+        auto upperSlot = static_cast<int32_t>((m_next >> getLevelShift(level)) & (UPPER_LEVEL_SIZE - 1));
+        auto node = takeSlot(FIRST_LEVEL_SIZE + (level - 1) * UPPER_LEVEL_SIZE + upperSlot);
+        while (node) {
+            auto next = node->next;
+            place(node);
+            m_size++;
+            node = next;
+        }
+        if (upperSlot != 0) {
+            break;
+        }
+    }
+}
+
+TimerWheel::Node* TimerWheel::takeSlot(int32_t slot) {
+    auto first = m_slots[slot];
+    if (!first) {
+        return nullptr;
+    }
+    m_slots[slot] = nullptr;
+    if (slot < FIRST_LEVEL_SIZE) {
+        m_firstLevelBitmap[slot / 64] &= ~(static_cast<uint64_t>(1) << (slot % 64));
+    } else {
+        auto upperSlot = slot - FIRST_LEVEL_SIZE;
+        m_upperLevelBitmaps[1 + upperSlot / UPPER_LEVEL_SIZE] &=
+            ~(static_cast<uint64_t>(1) << (upperSlot % UPPER_LEVEL_SIZE));
+    }
+    size_t count = 0;
+    for (auto node = first; node; node = node->next) {
+        node->slot = NOT_LINKED;
+        count++;
+    }
+    m_size -= count;
+    return first;
+}
+
+void TimerWheel::skipIdleTicks(uint64_t limit) {
+    auto next = getNextTick();
+    if (next > m_next) {
+        m_next = std::min(next, limit);
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
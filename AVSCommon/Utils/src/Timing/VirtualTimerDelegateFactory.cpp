@@ -0,0 +1,50 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/VirtualTimerDelegateFactory.h"
+#include "AVSCommon/Utils/Timing/WheelTimerDelegate.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+VirtualTimerDelegateFactory::VirtualTimerDelegateFactory() : m_service{std::make_shared<VirtualTimerService>()} {
+}
+
+bool VirtualTimerDelegateFactory::supportsLowPowerMode() {
+    return m_service->supportsLowPowerMode();
+}
+
+std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> VirtualTimerDelegateFactory::getTimerDelegate() {
+    return std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface>(new WheelTimerDelegate(m_service));
+}
+
+std::chrono::nanoseconds VirtualTimerDelegateFactory::now() const {
+    return m_service->now();
+}
+
+void VirtualTimerDelegateFactory::advance(std::chrono::nanoseconds duration) {
+    m_service->advance(duration);
+}
+
+void VirtualTimerDelegateFactory::runUntilIdle() {
+    m_service->runUntilIdle();
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
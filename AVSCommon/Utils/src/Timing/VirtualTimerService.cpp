@@ -0,0 +1,81 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AVSCommon/Utils/Timing/VirtualTimerService.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("VirtualTimerService");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+VirtualTimerService::VirtualTimerService() : m_now{0} {
+}
+
+std::chrono::nanoseconds VirtualTimerService::now() const {
+    return std::chrono::nanoseconds(m_now.load());
+}
+
+void VirtualTimerService::advance(std::chrono::nanoseconds duration) {
+    if (duration < std::chrono::nanoseconds::zero()) {
+        ACSDK_ERROR(LX("advanceFailed").d("reason", "negativeDuration"));
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto time = now();
+    time = duration > NEVER - time ? NEVER : time + duration;
+    runUntilLocked(lock, time);
+    m_now = time.count();
+}
+
+void VirtualTimerService::runUntilIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    runUntilLocked(lock, NEVER);
+}
+
+void VirtualTimerService::onWakeupChangedLocked() {
+    // The calls are only made by advance() and runUntilIdle(), which check for wakeups after each one.
+}
+
+void VirtualTimerService::runUntilLocked(std::unique_lock<std::mutex>& lock, std::chrono::nanoseconds time) {
+    while (true) {
+        while (runReadyLocked(lock)) {
+        }
+        auto wakeup = getNextWakeupLocked();
+        if (NEVER == wakeup || wakeup > time) {
+            return;
+        }
+        if (wakeup > now()) {
+            m_now = wakeup.count();
+        }
+        collectDueLocked(now());
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
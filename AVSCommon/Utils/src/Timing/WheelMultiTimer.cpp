@@ -0,0 +1,218 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <limits>
+
+#include "AVSCommon/Utils/Logger/LogContext.h"
+#include "AVSCommon/Utils/Timing/WheelMultiTimer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// How long the timer thread waits for a task to be submitted, once none is pending, before it exits.
+static const std::chrono::milliseconds GRACE_PERIOD(1000);
+
+/// The number of slots the pool grows by.
+static const uint32_t SLOTS_PER_CHUNK = 256;
+
+/// The value of @c m_firstFree and @c Slot::nextFree at the end of the free list.
+static const uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+/// The number of bits of a token that hold the index of its slot.  The bits above hold the generation.
+static const int TOKEN_INDEX_BITS = 32;
+
+std::shared_ptr<WheelMultiTimer> WheelMultiTimer::createMultiTimer() {
+    return std::make_shared<WheelMultiTimer>();
+}
+
+WheelMultiTimer::WheelMultiTimer() :
+        m_slotCount{0},
+        m_firstFree{NO_SLOT},
+        m_firstDue{nullptr},
+        m_lastDue{nullptr},
+        m_wakeTick{TimerWheel::NO_TICK},
+        m_isRunning{false},
+        m_isBeingDestroyed{false} {
+}
+
+WheelMultiTimer::~WheelMultiTimer() {
+    {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        m_isBeingDestroyed = true;
+        m_waitCondition.notify_all();
+    }
+    if (m_timerThread.joinable()) {
+        m_timerThread.join();
+    }
+}
+
+WheelMultiTimer::Token WheelMultiTimer::submitTask(
+    const std::chrono::milliseconds& delay,
+    functional::InlineTask task) {
+    // Run the task in the log context of the submitting thread, as Timer does.  The task is move-only, so it is shared
+    // to fit in the copyable function that LogContext::bind() takes.  Only done when there is a context to bind.
+    if (!logger::LogContext::getText().empty()) {
+        auto sharedTask = std::make_shared<functional::InlineTask>(std::move(task));
+        task = logger::LogContext::bind([sharedTask]() { (*sharedTask)(); });
+    }
+    auto time = TimerWheel::Clock::now() + delay;
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    auto slot = allocateSlotLocked();
+    slot->task = std::move(task);
+    auto tick = m_wheel.toTick(time);
+    m_wheel.insert(slot, tick);
+
+    if (!m_isRunning) {
+        // A thread that exited after its grace period has already released the mutex for the last time.
+        if (m_timerThread.joinable()) {
+            m_timerThread.join();
+        }
+        m_isRunning = true;
+        m_timerThread = std::thread(&WheelMultiTimer::timerLoop, this);
+    } else if (tick < m_wakeTick) {
+        m_waitCondition.notify_one();
+    }
+    return (static_cast<Token>(slot->generation) << TOKEN_INDEX_BITS) | slot->index;
+}
+
+void WheelMultiTimer::cancelTask(Token token) {
+    functional::InlineTask task;
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    auto slot = findSlotLocked(token);
+    if (!slot) {
+        return;
+    }
+    if (slot->isLinked()) {
+        m_wheel.remove(slot);
+    } else {
+        removeDueLocked(slot);
+    }
+    // Destroy the task after the mutex is released.
+    task = std::move(slot->task);
+    releaseSlotLocked(slot);
+}
+
+void WheelMultiTimer::timerLoop() {
+    std::unique_lock<std::mutex> lock(m_waitMutex);
+    while (!m_isBeingDestroyed) {
+        if (m_firstDue) {
+            auto slot = static_cast<Slot*>(m_firstDue);
+            removeDueLocked(slot);
+            auto task = std::move(slot->task);
+            releaseSlotLocked(slot);
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+            continue;
+        }
+
+        m_wakeTick = m_wheel.getNextTick();
+        if (TimerWheel::NO_TICK == m_wakeTick) {
+            if (!m_waitCondition.wait_for(
+                    lock, GRACE_PERIOD, [this] { return m_wheel.size() > 0 || m_isBeingDestroyed; })) {
+                break;
+            }
+            continue;
+        }
+        if (m_wakeTick > m_wheel.toElapsedTick(TimerWheel::Clock::now())) {
+            m_waitCondition.wait_until(lock, m_wheel.toTimePoint(m_wakeTick));
+        }
+        m_wakeTick = TimerWheel::NO_TICK;
+        m_wheel.advance(m_wheel.toElapsedTick(TimerWheel::Clock::now()), [this](TimerWheel::Node* node) {
+            pushDueLocked(static_cast<Slot*>(node));
+        });
+    }
+    m_isRunning = false;
+}
+
+WheelMultiTimer::Slot* WheelMultiTimer::allocateSlotLocked() {
+    if (NO_SLOT == m_firstFree) {
+        std::unique_ptr<Slot[]> chunk(new Slot[SLOTS_PER_CHUNK]);
+        for (uint32_t ix = 0; ix < SLOTS_PER_CHUNK; ix++) {
+            auto& slot = chunk[ix];
+            slot.index = m_slotCount + ix;
+            slot.generation = 0;
+            slot.isDue = false;
+            slot.nextFree = ix + 1 < SLOTS_PER_CHUNK ? slot.index + 1 : NO_SLOT;
+        }
+        m_chunks.push_back(std::move(chunk));
+        m_firstFree = m_slotCount;
+        m_slotCount += SLOTS_PER_CHUNK;
+    }
+    auto slot = getSlot(m_firstFree);
+    m_firstFree = slot->nextFree;
+    slot->nextFree = NO_SLOT;
+    return slot;
+}
+
+void WheelMultiTimer::releaseSlotLocked(Slot* slot) {
+    slot->generation++;
+    slot->task = nullptr;
+    slot->nextFree = m_firstFree;
+    m_firstFree = slot->index;
+}
+
+WheelMultiTimer::Slot* WheelMultiTimer::findSlotLocked(Token token) {
+    auto index = static_cast<uint32_t>(token);
+    if (index >= m_slotCount) {
+        return nullptr;
+    }
+    auto slot = getSlot(index);
+    auto generation = static_cast<uint32_t>(token >> TOKEN_INDEX_BITS);
+    if (slot->generation != generation || (!slot->isLinked() && !slot->isDue)) {
+        return nullptr;
+    }
+    return slot;
+}
+
+WheelMultiTimer::Slot* WheelMultiTimer::getSlot(uint32_t index) {
+    return &m_chunks[index / SLOTS_PER_CHUNK][index % SLOTS_PER_CHUNK];
+}
+
+void WheelMultiTimer::pushDueLocked(Slot* slot) {
+    slot->isDue = true;
+    slot->prev = m_lastDue;
+    slot->next = nullptr;
+    if (m_lastDue) {
+        m_lastDue->next = slot;
+    } else {
+        m_firstDue = slot;
+    }
+    m_lastDue = slot;
+}
+
+void WheelMultiTimer::removeDueLocked(Slot* slot) {
+    if (slot->prev) {
+        slot->prev->next = slot->next;
+    } else {
+        m_firstDue = slot->next;
+    }
+    if (slot->next) {
+        slot->next->prev = slot->prev;
+    } else {
+        m_lastDue = slot->prev;
+    }
+    slot->prev = nullptr;
+    slot->next = nullptr;
+    slot->isDue = false;
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,65 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/SteadyTimerService.h"
+#include "AVSCommon/Utils/Timing/WheelTimerDelegate.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+WheelTimerDelegate::WheelTimerDelegate() : WheelTimerDelegate(SteadyTimerService::instance()) {
+}
+
+WheelTimerDelegate::WheelTimerDelegate(std::shared_ptr<TimerService> service, std::chrono::nanoseconds slack) :
+        m_service{std::move(service)},
+        m_timer{m_service->createTimer()} {
+    m_service->setSlack(m_timer, slack);
+}
+
+WheelTimerDelegate::~WheelTimerDelegate() {
+    stop();
+}
+
+void WheelTimerDelegate::start(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    m_service->start(m_timer, delay, period, periodType, maxCount, std::move(task));
+}
+
+void WheelTimerDelegate::stop() {
+    m_service->stop(m_timer);
+}
+
+bool WheelTimerDelegate::activate() {
+    return m_service->activate(m_timer);
+}
+
+bool WheelTimerDelegate::isActive() const {
+    return m_service->isActive(m_timer);
+}
+
+void WheelTimerDelegate::setSlack(std::chrono::nanoseconds slack) {
+    m_service->setSlack(m_timer, slack);
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,43 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/SteadyTimerService.h"
+#include "AVSCommon/Utils/Timing/WheelTimerDelegate.h"
+#include "AVSCommon/Utils/Timing/WheelTimerDelegateFactory.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+WheelTimerDelegateFactory::WheelTimerDelegateFactory(
+    std::shared_ptr<TimerService> service,
+    std::chrono::nanoseconds slack) :
+        m_service{service ? std::move(service) : SteadyTimerService::instance()},
+        m_slack{slack} {
+}
+
+bool WheelTimerDelegateFactory::supportsLowPowerMode() {
+    return m_service->supportsLowPowerMode();
+}
+
+std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> WheelTimerDelegateFactory::getTimerDelegate() {
+    return std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface>(new WheelTimerDelegate(m_service, m_slack));
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,253 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Logger/BacktraceBuffer.h"
+#include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+#include "AVSCommon/Utils/Logger/ModuleLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// Configuration key of the module logger under test.
+static const std::string MODULE_KEY = "backtraceBufferTest";
+
+/// Configuration key of the module logger under test with several sinks.
+static const std::string SINKS_MODULE_KEY = "backtraceBufferSinksTest";
+
+/// Configuration of the module loggers under test, which forward WARN and above and buffer INFO.
+// clang-format off
+static const std::string CONFIGURATION = R"(
+{
+    "backtraceBufferTest" : {
+        "logLevel" : "WARN",
+        "backtrace" : {
+            "logLevel" : "INFO",
+            "flushLevel" : "ERROR",
+            "entryCount" : 4
+        }
+    },
+    "backtraceBufferSinksTest" : {
+        "logLevel" : "WARN",
+        "backtrace" : {
+            "logLevel" : "INFO",
+            "flushLevel" : "ERROR",
+            "entryCount" : 4
+        }
+    }
+}
+)";
+// clang-format on
+
+/// Moniker of the thread entries are added from.
+static const char* THREAD_MONIKER = "1";
+
+/// How old entries may be and still be flushed, in the tests that use a @c BacktraceBuffer directly.
+static const std::chrono::milliseconds MAX_AGE(1000);
+
+/**
+ * A @c Logger that keeps the level and text of the entries it is sent.
+ */
+class TestLogger : public Logger {
+public:
+    /// Constructor.
+    TestLogger() : Logger(Level::DEBUG9) {
+    }
+
+    void emit(
+        Level level,
+        std::chrono::system_clock::time_point /*time*/,
+        const char* /*threadMoniker*/,
+        const char* text) override {
+        std::function<void()> onEmit;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_lines.push_back(convertLevelToChar(level) + std::string(" ") + text);
+            onEmit = m_onEmit;
+        }
+        if (onEmit) {
+            onEmit();
+        }
+    }
+
+    /**
+     * Take the lines emitted so far.
+     *
+     * @return The lines emitted since this was last called, each prefixed with the letter of its level.
+     */
+    std::vector<std::string> takeLines() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> lines;
+        lines.swap(m_lines);
+        return lines;
+    }
+
+    /**
+     * Set a function to call each time an entry is emitted.
+     *
+     * @param onEmit The function.
+     */
+    void setOnEmit(std::function<void()> onEmit) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_onEmit = onEmit;
+    }
+
+private:
+    /// Serializes access to @c m_lines and @c m_onEmit.
+    std::mutex m_mutex;
+
+    /// The lines emitted.
+    std::vector<std::string> m_lines;
+
+    /// Called each time an entry is emitted.
+    std::function<void()> m_onEmit;
+};
+
+/// Test fixture for @c BacktraceBuffer.
+class BacktraceBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_sink = std::make_shared<TestLogger>();
+    }
+
+    void TearDown() override {
+        LogEntry::setCaptureMode(LogEntry::CaptureMode::TEXT);
+        configuration::ConfigurationNode::uninitialize();
+    }
+
+    /// The sink entries are flushed to.
+    std::shared_ptr<TestLogger> m_sink;
+};
+
+/// Verify that a flush emits the most recent entries, oldest first, and empties the buffer.
+TEST_F(BacktraceBufferTest, test_flushEmitsMostRecentEntriesInOrder) {
+    BacktraceBuffer buffer(Level::DEBUG9, Level::ERROR, 3, MAX_AGE);
+    auto now = std::chrono::system_clock::now();
+    buffer.add(Level::DEBUG0, now, THREAD_MONIKER, "one");
+    buffer.add(Level::INFO, now, THREAD_MONIKER, "two");
+    buffer.add(Level::DEBUG0, now, THREAD_MONIKER, "three");
+    buffer.add(Level::WARN, now, THREAD_MONIKER, "four");
+
+    buffer.flush(now, m_sink.get());
+    std::vector<std::string> expected = {"I two", "0 three", "W four"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+
+    buffer.flush(now, m_sink.get());
+    EXPECT_TRUE(m_sink->takeLines().empty());
+}
+
+/// Verify that a flush drops entries older than the maximum age.
+TEST_F(BacktraceBufferTest, test_flushDropsOldEntries) {
+    BacktraceBuffer buffer(Level::DEBUG9, Level::ERROR, 4, MAX_AGE);
+    auto now = std::chrono::system_clock::now();
+    buffer.add(Level::INFO, now - MAX_AGE * 2, THREAD_MONIKER, "old");
+    buffer.add(Level::INFO, now, THREAD_MONIKER, "new");
+
+    buffer.flush(now, m_sink.get());
+    std::vector<std::string> expected = {"I new"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+}
+
+/// Verify that an entry captured as a record is rendered on flush, after the strings it pointed to have changed.
+TEST_F(BacktraceBufferTest, test_recordRenderedOnFlush) {
+    LogEntry::setCaptureMode(LogEntry::CaptureMode::BINARY);
+    BacktraceBuffer buffer(Level::DEBUG9, Level::ERROR, 4, MAX_AGE);
+    auto now = std::chrono::system_clock::now();
+    char key[] = "key";
+    buffer.add(Level::INFO, now, THREAD_MONIKER, LogEntry("source", "event").d(key, "value").m("message"));
+    key[0] = 'X';
+
+    buffer.flush(now, m_sink.get());
+    std::vector<std::string> expected = {"I source:event:key=value:message"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+}
+
+/// Verify that entries are emitted without the buffer locked, so that the sink may add to it.
+TEST_F(BacktraceBufferTest, test_flushEmitsWithoutLock) {
+    BacktraceBuffer buffer(Level::DEBUG9, Level::ERROR, 4, MAX_AGE);
+    auto now = std::chrono::system_clock::now();
+    buffer.add(Level::INFO, now, THREAD_MONIKER, "one");
+    m_sink->setOnEmit([&buffer, now] { buffer.add(Level::INFO, now, THREAD_MONIKER, "added"); });
+
+    buffer.flush(now, m_sink.get());
+    m_sink->setOnEmit(nullptr);
+    std::vector<std::string> expected = {"I one"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+
+    buffer.flush(now, m_sink.get());
+    expected = {"I added"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+}
+
+/// Verify that a module logger buffers entries below its level, and forwards them ahead of an error.
+TEST_F(BacktraceBufferTest, test_errorTriggersFlush) {
+    auto stream = std::make_shared<std::stringstream>(CONFIGURATION);
+    ASSERT_TRUE(configuration::ConfigurationNode::initialize({stream}));
+    LoggerSinkManager::instance().initialize(m_sink);
+    // Never destroyed, like the module loggers of the SDK, which stay registered with the sink manager.
+    static ModuleLogger logger(MODULE_KEY);
+    // Drop anything the sink was sent while it was set up, such as warnings about its level.
+    m_sink->takeLines();
+
+    logger.log(Level::INFO, LogEntry("source", "buffered"));
+    logger.log(Level::WARN, LogEntry("source", "forwarded"));
+    std::vector<std::string> expected = {"W source:forwarded"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+
+    logger.log(Level::ERROR, LogEntry("source", "failed"));
+    expected = {"I source:buffered", "E source:failed"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+}
+
+/// Verify that buffered entries reach every sink added with @c LoggerSinkManager::addSink(), whatever their levels.
+TEST_F(BacktraceBufferTest, test_errorFlushesToAddedSinks) {
+    auto stream = std::make_shared<std::stringstream>(CONFIGURATION);
+    ASSERT_TRUE(configuration::ConfigurationNode::initialize({stream}));
+    LoggerSinkManager::instance().initialize(m_sink);
+    m_sink->setLevel(Level::WARN);
+    auto addedSink = std::make_shared<TestLogger>();
+    ASSERT_TRUE(LoggerSinkManager::instance().addSink(addedSink, Level::WARN));
+    // Never destroyed, like the module loggers of the SDK, which stay registered with the sink manager.
+    static ModuleLogger logger(SINKS_MODULE_KEY);
+    m_sink->takeLines();
+    addedSink->takeLines();
+
+    logger.log(Level::INFO, LogEntry("source", "buffered"));
+    EXPECT_TRUE(m_sink->takeLines().empty());
+    EXPECT_TRUE(addedSink->takeLines().empty());
+
+    logger.log(Level::ERROR, LogEntry("source", "failed"));
+    std::vector<std::string> expected = {"I source:buffered", "E source:failed"};
+    EXPECT_EQ(expected, m_sink->takeLines());
+    EXPECT_EQ(expected, addedSink->takeLines());
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
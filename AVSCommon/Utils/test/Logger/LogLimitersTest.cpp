@@ -0,0 +1,173 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// Send the entries of this test straight to the sink defined below, rather than through a ModuleLogger.
+#undef ACSDK_LOG_MODULE
+#define ACSDK_LOG_SINK Test
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LogLimitersTest");
+
+/// How long to wait for the summary of a call site that has stopped logging.
+static const std::chrono::seconds SUMMARY_TIMEOUT(5);
+
+/**
+ * A @c Logger that keeps the text of the entries it is sent.
+ */
+class TestLogger : public Logger {
+public:
+    /// Constructor.
+    TestLogger() : Logger(Level::DEBUG9) {
+    }
+
+    void emit(
+        Level /*level*/,
+        std::chrono::system_clock::time_point /*time*/,
+        const char* /*threadMoniker*/,
+        const char* text) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_lines.push_back(text);
+    }
+
+    /**
+     * Take the lines emitted so far.
+     *
+     * @return The lines emitted since this was last called.
+     */
+    std::vector<std::string> takeLines() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> lines;
+        lines.swap(m_lines);
+        return lines;
+    }
+
+private:
+    /// Serializes access to @c m_lines.
+    std::mutex m_mutex;
+
+    /// The lines emitted.
+    std::vector<std::string> m_lines;
+};
+
+/**
+ * Get the @c TestLogger that the entries of this test are sent to.
+ *
+ * @return The @c TestLogger.
+ */
+static std::shared_ptr<TestLogger> getTestLoggerInstance() {
+    static auto logger = std::make_shared<TestLogger>();
+    return logger;
+}
+
+}  // namespace test
+
+std::shared_ptr<Logger> getTestLogger() {
+    return test::getTestLoggerInstance();
+}
+
+namespace test {
+
+/// Test fixture for the log limiters.
+class LogLimitersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        getTestLoggerInstance()->takeLines();
+    }
+
+    void TearDown() override {
+        LogEntry::setCaptureMode(LogEntry::CaptureMode::TEXT);
+    }
+};
+
+/// Verify that a pair inserted after the message is rendered ahead of it.
+TEST_F(LogLimitersTest, test_insertBeforeMessage) {
+    EXPECT_STREQ(
+        "source:event:key=value,suppressed=3:message",
+        LogEntry("source", "event").d("key", "value").m("message").insertBeforeMessage("suppressed", 3).c_str());
+    EXPECT_STREQ(
+        "source:event:suppressed=3:message",
+        LogEntry("source", "event").m("message").insertBeforeMessage("suppressed", 3).c_str());
+    EXPECT_STREQ(
+        "source:event:key=value,suppressed=3",
+        LogEntry("source", "event").d("key", "value").insertBeforeMessage("suppressed", 3).c_str());
+}
+
+/// Verify that a pair inserted after the message is rendered ahead of it when the entry is captured as a record.
+TEST_F(LogLimitersTest, test_insertBeforeMessageBinary) {
+    LogEntry::setCaptureMode(LogEntry::CaptureMode::BINARY);
+    EXPECT_STREQ(
+        "source:event:key=value,suppressed=3:message",
+        LogEntry("source", "event").d("key", "value").m("message").insertBeforeMessage("suppressed", 3).c_str());
+    EXPECT_STREQ(
+        "source:event:suppressed=3:message",
+        LogEntry("source", "event").m("message").insertBeforeMessage("suppressed", 3).c_str());
+}
+
+/// Verify that the number of suppressed entries is logged ahead of the message of the next entry let through.
+TEST_F(LogLimitersTest, test_suppressedCountPrecedesMessage) {
+    for (int ix = 0; ix < 5; ix++) {
+        ACSDK_LOG_EVERY_N(Level::INFO, 2, LogEntry(TAG, "event").d("key", "value").m("message"));
+    }
+    std::vector<std::string> expected = {"LogLimitersTest:event:key=value:message",
+                                         "LogLimitersTest:event:key=value,suppressed=1:message",
+                                         "LogLimitersTest:event:key=value,suppressed=1:message"};
+    EXPECT_EQ(expected, getTestLoggerInstance()->takeLines());
+}
+
+/// Verify that the number of suppressed entries is logged in a summary once the call site stops logging.
+TEST_F(LogLimitersTest, test_summaryAfterStormStops) {
+    for (int ix = 0; ix < 3; ix++) {
+        ACSDK_LOG_RATE(Level::WARN, 1, LogEntry(TAG, "storm").m("message"));
+    }
+    auto lines = getTestLoggerInstance()->takeLines();
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_EQ("LogLimitersTest:storm::message", lines[0]);
+
+    auto deadline = std::chrono::steady_clock::now() + SUMMARY_TIMEOUT;
+    while (lines.size() < 2) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        auto more = getTestLoggerInstance()->takeLines();
+        lines.insert(lines.end(), more.begin(), more.end());
+    }
+    ASSERT_EQ(2u, lines.size());
+    const std::string prefix = "LogLimiter:entriesSuppressed:file=";
+    const std::string suffix = ",suppressed=2";
+    EXPECT_EQ(0u, lines[1].compare(0, prefix.size(), prefix)) << lines[1];
+    ASSERT_GT(lines[1].size(), suffix.size());
+    EXPECT_EQ(0u, lines[1].compare(lines[1].size() - suffix.size(), suffix.size(), suffix)) << lines[1];
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
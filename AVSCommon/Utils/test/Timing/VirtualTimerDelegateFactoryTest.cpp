@@ -0,0 +1,116 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/VirtualTimerDelegateFactory.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+/// Test fixture for timers driven by a @c VirtualTimerDelegateFactory.
+class VirtualTimerDelegateFactoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_factory = std::make_shared<VirtualTimerDelegateFactory>();
+    }
+
+    /// The factory of the timers under test.
+    std::shared_ptr<VirtualTimerDelegateFactory> m_factory;
+};
+
+/// Verify that @c advance() makes the calls that fall due, in deadline order, and only those.
+TEST_F(VirtualTimerDelegateFactoryTest, test_advanceCallsDueTimersInOrder) {
+    std::vector<std::string> calls;
+    Timer late(m_factory);
+    Timer early(m_factory);
+    Timer sameDeadline(m_factory);
+    late.start(std::chrono::milliseconds(30), [&calls] { calls.push_back("late"); });
+    early.start(std::chrono::milliseconds(10), [&calls] { calls.push_back("early"); });
+    sameDeadline.start(std::chrono::milliseconds(10), [&calls] { calls.push_back("sameDeadline"); });
+
+    m_factory->advance(std::chrono::milliseconds(9));
+    EXPECT_TRUE(calls.empty());
+    EXPECT_EQ(std::chrono::milliseconds(9), m_factory->now());
+
+    m_factory->advance(std::chrono::milliseconds(1));
+    EXPECT_EQ(std::vector<std::string>({"early", "sameDeadline"}), calls);
+    EXPECT_TRUE(late.isActive());
+
+    m_factory->advance(std::chrono::milliseconds(100));
+    EXPECT_EQ(std::vector<std::string>({"early", "sameDeadline", "late"}), calls);
+    EXPECT_EQ(std::chrono::milliseconds(110), m_factory->now());
+    EXPECT_FALSE(late.isActive());
+}
+
+/// Verify that @c advance() makes every call of a periodic timer that falls due.
+TEST_F(VirtualTimerDelegateFactoryTest, test_advancePeriodicTimer) {
+    int calls = 0;
+    Timer timer(m_factory);
+    timer.start(
+        std::chrono::seconds(1), std::chrono::seconds(1), Timer::PeriodType::ABSOLUTE, Timer::getForever(), [&calls] {
+            calls++;
+        });
+    m_factory->advance(std::chrono::minutes(10));
+    EXPECT_EQ(600, calls);
+    EXPECT_TRUE(timer.isActive());
+    timer.stop();
+    EXPECT_FALSE(timer.isActive());
+}
+
+/// Verify that @c runUntilIdle() follows a timer that restarts itself, without waiting in real time.
+TEST_F(VirtualTimerDelegateFactoryTest, test_runUntilIdleFollowsRestartedTimer) {
+    Timer timer(m_factory);
+    int attempts = 0;
+    std::function<void()> retry = [&] {
+        if (++attempts < 10) {
+            // A one-shot timer is active until its call returns, so it is stopped before it is restarted.
+            timer.stop();
+            timer.start(std::chrono::seconds(1 << attempts), retry);
+        }
+    };
+    timer.start(std::chrono::seconds(1), retry);
+
+    m_factory->runUntilIdle();
+    EXPECT_EQ(10, attempts);
+    EXPECT_EQ(std::chrono::seconds(1023), m_factory->now());
+    EXPECT_FALSE(timer.isActive());
+}
+
+/// Verify that the future returned by @c Timer::start() is ready once the virtual clock passes its deadline.
+TEST_F(VirtualTimerDelegateFactoryTest, test_futureReadyAfterRunUntilIdle) {
+    Timer timer(m_factory);
+    auto future = timer.start(std::chrono::hours(1), [] { return 3; });
+    EXPECT_EQ(std::future_status::timeout, future.wait_for(std::chrono::seconds(0)));
+    m_factory->runUntilIdle();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(3, future.get());
+    EXPECT_EQ(std::chrono::hours(1), m_factory->now());
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
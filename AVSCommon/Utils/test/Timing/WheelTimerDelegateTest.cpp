@@ -0,0 +1,126 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Timing/WheelTimerDelegate.h"
+#include "AVSCommon/Utils/Timing/WheelTimerDelegateFactory.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+/// How long the tasks of the tests keep running after they restart their timer.
+static const std::chrono::milliseconds TASK_DURATION(100);
+
+/// How long to wait for a call that is due.
+static const std::chrono::seconds CALL_TIMEOUT(5);
+
+/// Verify that @c stop() waits for the task to return after the task restarts its own timer.
+TEST(WheelTimerDelegateTest, test_stopAfterRestartFromTaskWaitsForCalls) {
+    WheelTimerDelegateFactory factory;
+    auto delegate = factory.getTimerDelegate();
+    auto timer = delegate.get();
+    std::atomic<int> inProgress{0};
+    std::promise<void> restarted;
+
+    auto restartTask = [&inProgress] {
+        inProgress++;
+        // Outlast the task that restarted the timer.
+        std::this_thread::sleep_for(TASK_DURATION * 3);
+        inProgress--;
+    };
+    timer->start(
+        std::chrono::nanoseconds::zero(),
+        std::chrono::nanoseconds::zero(),
+        WheelTimerDelegate::PeriodType::ABSOLUTE,
+        1,
+        [timer, &inProgress, &restarted, restartTask] {
+            inProgress++;
+            timer->stop();
+            timer->start(
+                std::chrono::nanoseconds::zero(),
+                std::chrono::nanoseconds::zero(),
+                WheelTimerDelegate::PeriodType::ABSOLUTE,
+                1,
+                restartTask);
+            // Give the call of the restarted timer time to fall due before the timer is stopped.
+            std::this_thread::sleep_for(TASK_DURATION);
+            restarted.set_value();
+            std::this_thread::sleep_for(TASK_DURATION);
+            inProgress--;
+        });
+
+    ASSERT_EQ(std::future_status::ready, restarted.get_future().wait_for(CALL_TIMEOUT));
+    timer->stop();
+    EXPECT_EQ(0, inProgress);
+    EXPECT_FALSE(timer->isActive());
+
+    // A call made after the restart must not be in progress once stop() has returned either.
+    std::this_thread::sleep_for(TASK_DURATION * 3);
+    EXPECT_EQ(0, inProgress);
+}
+
+/// Verify that a call of a timer restarted from its task is made once the task returns.
+TEST(WheelTimerDelegateTest, test_restartFromTaskCallsAgain) {
+    WheelTimerDelegateFactory factory;
+    auto delegate = factory.getTimerDelegate();
+    auto timer = delegate.get();
+    std::atomic<int> inProgress{0};
+    std::atomic<bool> overlapped{false};
+    std::promise<void> restartCalled;
+
+    auto restartTask = [&inProgress, &overlapped, &restartCalled] {
+        if (++inProgress > 1) {
+            overlapped = true;
+        }
+        inProgress--;
+        restartCalled.set_value();
+    };
+    timer->start(
+        std::chrono::nanoseconds::zero(),
+        std::chrono::nanoseconds::zero(),
+        WheelTimerDelegate::PeriodType::ABSOLUTE,
+        1,
+        [timer, &inProgress, restartTask] {
+            inProgress++;
+            timer->start(
+                std::chrono::nanoseconds::zero(),
+                std::chrono::nanoseconds::zero(),
+                WheelTimerDelegate::PeriodType::ABSOLUTE,
+                1,
+                restartTask);
+            std::this_thread::sleep_for(TASK_DURATION);
+            inProgress--;
+        });
+
+    ASSERT_EQ(std::future_status::ready, restartCalled.get_future().wait_for(CALL_TIMEOUT));
+    timer->stop();
+    EXPECT_FALSE(overlapped);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
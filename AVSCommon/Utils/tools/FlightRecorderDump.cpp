@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Prints the entries in a @c FlightRecorder file, oldest first, in the format of the console log.  The file may be
+ * that of a running process, or one left behind by a process that has exited or crashed.  If the process crashed,
+ * the point of the crash is marked among the entries.
+ *
+ * Usage: FlightRecorderDump [path]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "AVSCommon/Utils/Logger/FlightRecorder.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+/// Path read if none is given.
+static const char* DEFAULT_PATH = "/dev/shm/avsFlightRecorder";
+
+/// Suffix of lines for entries that were still being written.
+static const char* TORN_SUFFIX = " [torn]";
+
+/**
+ * Print a line in the format of the console log.
+ *
+ * @param formatter The formatter.
+ * @param level The severity level of the line.
+ * @param time The time of the line.
+ * @param threadMoniker The moniker of the thread the line is from.
+ * @param text The text of the line.
+ * @param suffix Text to append to the line.
+ */
+static void printLine(
+    LogStringFormatter& formatter,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text,
+    const char* suffix) {
+    std::string line;
+    formatter.format(level, time, threadMoniker, text, &line);
+    printf("%s%s\n", line.c_str(), suffix);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [path]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::string path = argc > 1 ? argv[1] : DEFAULT_PATH;
+
+    FlightRecorder::Snapshot snapshot;
+    std::string error;
+    if (!FlightRecorder::read(path, &snapshot, &error)) {
+        fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    printf("pid %d: %zu entries", snapshot.pid, snapshot.entries.size());
+    if (snapshot.droppedCount > 0) {
+        printf(", %llu dropped", static_cast<unsigned long long>(snapshot.droppedCount));
+    }
+    if (snapshot.crashSignal != 0) {
+        printf(", crashed with signal %d (%s)", snapshot.crashSignal, strsignal(snapshot.crashSignal));
+    }
+    printf("\n");
+
+    LogStringFormatter formatter;
+    std::string crashText = "FlightRecorder:crashed:signal=" + std::to_string(snapshot.crashSignal);
+    bool crashPrinted = (0 == snapshot.crashSignal);
+    for (auto& entry : snapshot.entries) {
+        if (!crashPrinted && snapshot.crashTime < entry.time) {
+            printLine(formatter, Level::CRITICAL, snapshot.crashTime, "", crashText.c_str(), "");
+            crashPrinted = true;
+        }
+        printLine(
+            formatter,
+            entry.level,
+            entry.time,
+            entry.threadMoniker.c_str(),
+            entry.text.c_str(),
+            entry.torn ? TORN_SUFFIX : "");
+    }
+    if (!crashPrinted) {
+        printLine(formatter, Level::CRITICAL, snapshot.crashTime, "", crashText.c_str(), "");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Lists and changes the levels of the modules of a running process through its @c LogControl file.  A level set
+ * with this tool overrides the configured levels of the module and of the sink until it is cleared, and takes effect
+ * on the next entry the module logs.
+ *
+ * Usage: LogLevelControl [--path path | --pid pid] [list]
+ *        LogLevelControl [--path path | --pid pid] set <module|all> <level>
+ *        LogLevelControl [--path path | --pid pid] clear <module|all>
+ *
+ * Without @c --path or @c --pid, the tool uses the file of the one running process with a file at the default path.
+ */
+
+#include <dirent.h>
+#include <signal.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/LogControl.h"
+
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+/// The directory of the default path of the file.
+static const char* DEFAULT_DIRECTORY = "/dev/shm";
+
+/// The name of the file at the default path, to which a '.' and the identifier of the process are appended.
+static const std::string DEFAULT_NAME_PREFIX = "avsLogControl.";
+
+/// Module name that selects every module.
+static const std::string ALL_MODULES = "all";
+
+/**
+ * Print how to use the tool.
+ *
+ * @param program The name of the program.
+ * @return @c EXIT_FAILURE.
+ */
+static int usage(const char* program) {
+    fprintf(stderr, "usage: %s [--path path | --pid pid] [list]\n", program);
+    fprintf(stderr, "       %s [--path path | --pid pid] set <module|all> <level>\n", program);
+    fprintf(stderr, "       %s [--path path | --pid pid] clear <module|all>\n", program);
+    return EXIT_FAILURE;
+}
+
+/**
+ * Get the default path of the file of a process.
+ *
+ * @param pid The identifier of the process.
+ * @return The path.
+ */
+static std::string getDefaultPath(const std::string& pid) {
+    return std::string(DEFAULT_DIRECTORY) + "/" + DEFAULT_NAME_PREFIX + pid;
+}
+
+/**
+ * Find the file of the one running process with a file at the default path.
+ *
+ * @param[out] path The path of the file.
+ * @return Whether exactly one such file was found.
+ */
+static bool findDefaultPath(std::string* path) {
+    auto directory = opendir(DEFAULT_DIRECTORY);
+    if (!directory) {
+        fprintf(stderr, "%s: %s\n", DEFAULT_DIRECTORY, strerror(errno));
+        return false;
+    }
+    std::vector<std::string> paths;
+    while (auto entry = readdir(directory)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, DEFAULT_NAME_PREFIX.size(), DEFAULT_NAME_PREFIX) != 0) {
+            continue;
+        }
+        auto pid = atoi(name.c_str() + DEFAULT_NAME_PREFIX.size());
+        if (pid > 0 && (kill(pid, 0) == 0 || EPERM == errno)) {
+            paths.push_back(std::string(DEFAULT_DIRECTORY) + "/" + name);
+        }
+    }
+    closedir(directory);
+    if (paths.size() != 1) {
+        fprintf(stderr, "%zu running processes have a log control file, use --pid or --path\n", paths.size());
+        return false;
+    }
+    *path = paths[0];
+    return true;
+}
+
+/**
+ * Get the name of a level for printing.
+ *
+ * @param level The level.
+ * @return The name of the level, or @c "-" for @c Level::UNKNOWN.
+ */
+static std::string getName(Level level) {
+    return Level::UNKNOWN == level ? "-" : convertLevelToName(level);
+}
+
+/**
+ * Print the modules of a file.
+ *
+ * @param path The path of the file.
+ * @return The exit status.
+ */
+static int list(const std::string& path) {
+    int32_t pid = 0;
+    std::vector<LogControl::Module> modules;
+    std::string error;
+    if (!LogControl::readModules(path, &pid, &modules, &error)) {
+        fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+        return EXIT_FAILURE;
+    }
+    printf("pid %d: %zu modules", pid, modules.size());
+    if (kill(pid, 0) != 0 && ESRCH == errno) {
+        printf(" (process not running)");
+    }
+    printf("\n%-*s %-8s %-8s %-8s %-8s\n", static_cast<int>(LogControl::MAX_MODULE_NAME_LENGTH), "module", "build",
+           "forward", "config", "override");
+    for (const auto& module : modules) {
+        printf("%-*s %-8s %-8s %-8s %-8s\n", static_cast<int>(LogControl::MAX_MODULE_NAME_LENGTH),
+               module.name.c_str(), getName(module.level).c_str(), getName(module.forwardLevel).c_str(),
+               getName(module.configuredLevel).c_str(), getName(module.overrideLevel).c_str());
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Set or clear the override of one module, or of every module.
+ *
+ * @param path The path of the file.
+ * @param name The name of the module, or @c ALL_MODULES.
+ * @param level The level to override with, or @c Level::UNKNOWN to clear the override.
+ * @return The exit status.
+ */
+static int setOverride(const std::string& path, const std::string& name, Level level) {
+    std::vector<std::string> names;
+    std::string error;
+    if (ALL_MODULES == name) {
+        int32_t pid = 0;
+        std::vector<LogControl::Module> modules;
+        if (!LogControl::readModules(path, &pid, &modules, &error)) {
+            fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+            return EXIT_FAILURE;
+        }
+        for (const auto& module : modules) {
+            names.push_back(module.name);
+        }
+    } else {
+        names.push_back(name);
+    }
+    for (const auto& moduleName : names) {
+        if (!LogControl::setOverride(path, moduleName, level, &error)) {
+            fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+    std::string path;
+    std::vector<std::string> args;
+    for (int ix = 1; ix < argc; ix++) {
+        if (strcmp(argv[ix], "--path") == 0 && ix + 1 < argc) {
+            path = argv[++ix];
+        } else if (strcmp(argv[ix], "--pid") == 0 && ix + 1 < argc) {
+            path = getDefaultPath(argv[++ix]);
+        } else {
+            args.push_back(argv[ix]);
+        }
+    }
+    if (path.empty() && !findDefaultPath(&path)) {
+        return EXIT_FAILURE;
+    }
+
+    if (args.empty() || (args.size() == 1 && "list" == args[0])) {
+        return list(path);
+    }
+    if (args.size() == 3 && "set" == args[0]) {
+        auto level = convertNameToLevel(args[2]);
+        if (Level::UNKNOWN == level) {
+            fprintf(stderr, "unknown level: %s\n", args[2].c_str());
+            return EXIT_FAILURE;
+        }
+        return setOverride(path, args[1], level);
+    }
+    if (args.size() == 2 && "clear" == args[0]) {
+        return setOverride(path, args[1], Level::UNKNOWN);
+    }
+    return usage(argv[0]);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Prints the entries of a log file that are selected by source, event, metadata key and time.  Entries from any of
+ * the given sources and with any of the given events are selected, if they have all of the given keys (with the
+ * given values, if any) and were logged in the given range of times.  Times are UTC, like those in the log.
+ *
+ * With --index, the sidecar index of the file is used to skip blocks of the file, and is written first if there is
+ * none or the file has changed since it was written.
+ *
+ * Usage: LogQuery [--source S]... [--event E]... [--key K[=V]]... [--from T] [--to T] [--threads N] [--index]
+ *                 [--count] path
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/LogFileScanner.h"
+
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+/// Size of the buffer for standard output.
+static const size_t OUTPUT_BUFFER_SIZE = 1024 * 1024;
+
+/**
+ * Print how to use this tool.
+ *
+ * @param name The name this tool was run as.
+ */
+static void printUsage(const char* name) {
+    fprintf(
+        stderr,
+        "usage: %s [--source S]... [--event E]... [--key K[=V]]... [--from T] [--to T] [--threads N] [--index]\n"
+        "       [--count] path\n"
+        "Times are \"YYYY-MM-DD HH:MM:SS[.mmm]\" in UTC.  --from is inclusive and --to is exclusive.\n",
+        name);
+}
+
+/**
+ * Parse a time given on the command line.
+ *
+ * @param text The time.
+ * @param[out] milliseconds The time, in milliseconds since the epoch.
+ * @return Whether @c text is a time.
+ */
+static bool parseTimeArgument(const char* text, int64_t* milliseconds) {
+    if (!parseLogTime(text, strlen(text), milliseconds)) {
+        fprintf(stderr, "invalid time: %s\n", text);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    LogFilter filter;
+    size_t threadCount = 0;
+    bool useIndex = false;
+    bool countOnly = false;
+    const char* path = nullptr;
+    for (int ix = 1; ix < argc; ix++) {
+        std::string argument = argv[ix];
+        bool hasValue = ix + 1 < argc;
+        if ("--index" == argument) {
+            useIndex = true;
+        } else if ("--count" == argument) {
+            countOnly = true;
+        } else if ("--source" == argument && hasValue) {
+            filter.sources.push_back(argv[++ix]);
+        } else if ("--event" == argument && hasValue) {
+            filter.events.push_back(argv[++ix]);
+        } else if ("--key" == argument && hasValue) {
+            std::string key = argv[++ix];
+            auto separator = key.find('=');
+            LogFilter::KeyFilter keyFilter;
+            keyFilter.key = key.substr(0, separator);
+            keyFilter.hasValue = std::string::npos != separator;
+            keyFilter.value = keyFilter.hasValue ? key.substr(separator + 1) : "";
+            filter.keys.push_back(keyFilter);
+        } else if ("--from" == argument && hasValue) {
+            if (!parseTimeArgument(argv[++ix], &filter.from)) {
+                return EXIT_FAILURE;
+            }
+        } else if ("--to" == argument && hasValue) {
+            if (!parseTimeArgument(argv[++ix], &filter.to)) {
+                return EXIT_FAILURE;
+            }
+        } else if ("--threads" == argument && hasValue) {
+            threadCount = strtoul(argv[++ix], nullptr, 10);
+        } else if (!path && '-' != argument[0]) {
+            path = argv[ix];
+        } else {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (!path) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string error;
+    auto scanner = LogFileScanner::open(path, &error);
+    if (!scanner) {
+        fprintf(stderr, "%s: %s\n", path, error.c_str());
+        return EXIT_FAILURE;
+    }
+    if (useIndex && !scanner->loadIndex(&error)) {
+        fprintf(stderr, "%s; indexing %s\n", error.c_str(), path);
+        if (!scanner->writeIndex(threadCount, &error)) {
+            // The index is still used for this query, it just is not saved for the next.
+            fprintf(stderr, "%s\n", error.c_str());
+        }
+    }
+
+    std::vector<LogSpan> matches;
+    scanner->scan(filter, threadCount, &matches);
+    if (countOnly) {
+        printf("%zu\n", matches.size());
+        return EXIT_SUCCESS;
+    }
+    static char buffer[OUTPUT_BUFFER_SIZE];
+    setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+    for (auto& match : matches) {
+        fwrite(match.data, 1, match.size, stdout);
+        fputc('\n', stdout);
+    }
+    fflush(stdout);
+    return ferror(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}